@@ -78,6 +78,28 @@ http://www.sofaconventions.org
 #include "../src/SOFAUnits.h"
 #include "../src/SOFAVersion.h"
 #include "../src/SOFAHelper.h"
+#include "../src/SOFAKdTree.h"
+#include "../src/SOFASourcePositionIndex.h"
+#include "../src/SOFASphereTriangulation.h"
+#include "../src/SOFAHRIRInterpolator.h"
+#include "../src/SOFAFFT.h"
+#include "../src/SOFAConvolver.h"
+#include "../src/SOFADataset.h"
+#include "../src/SOFADatasetCache.h"
+#include "../src/SOFAHRTFImage.h"
+#include "../src/SOFAHRTFSpectra.h"
+#include "../src/SOFASharedFile.h"
+#include "../src/SOFAMeasurementPrefetcher.h"
+#include "../src/SOFAHRTFDatabase.h"
+#include "../src/SOFAWriter.h"
+#include "../src/SOFAPositionArrays.h"
+#include "../src/SOFAListenerRotation.h"
+#include "../src/SOFADirectionLookupTable.h"
+#include "../src/SOFAListenerPositionIndex.h"
+#include "../src/SOFADRIRInterpolator.h"
+#include "../src/SOFAHeadOrientationIndex.h"
+#include "../src/SOFAMinimumPhaseHRIR.h"
+#include "../src/SOFASphericalHarmonicHRIR.h"
 
 //==============================================================================
 /// private files
@@ -89,6 +111,7 @@ http://www.sofaconventions.org
 //#include "../src/SOFAEmitter.h"
 //#include "../src/SOFAListener.h"
 //#include "../src/SOFANcUtils.h"
+//#include "../src/SOFANcCatalogue.h"
 //#include "../src/SOFAPosition.h"
 //#include "../src/SOFAReceiver.h"
 //#include "../src/SOFASource.h"
@@ -0,0 +1,252 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFACacheFile.cpp
+ *   @brief      Binary cache files computed from a SOFA file, and stored next to it
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFACacheFile.h"
+#include "../src/SOFAHostArchitecture.h"
+#include <fstream>
+#include <vector>
+#include <cstring>
+#include <cstdio>
+#include <sys/stat.h>
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    static const std::uint32_t cacheFileByteOrder = 0x01020304;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the size and the modification time of a file
+ *  @param[out]     size : in bytes
+ *  @param[out]     modificationTime : in nanoseconds (the resolution is the one of the
+ *                  file system, and one second on Windows)
+ *  @param[in]      path : path of the file
+ *  @return         false if the file does not exist
+ *
+ */
+/************************************************************************************/
+bool CacheFile::GetFileStatus(long long &size,
+                              long long &modificationTime,
+                              const std::string &path)
+{
+    struct stat status;
+
+    if( stat( path.c_str(), &status ) != 0 )
+    {
+        return false;
+    }
+
+    size                = (long long) status.st_size;
+#if ( SOFA_MAC == 1 )
+    modificationTime    = (long long) status.st_mtimespec.tv_sec * 1000000000LL + (long long) status.st_mtimespec.tv_nsec;
+#elif ( SOFA_UNIX == 1 )
+    modificationTime    = (long long) status.st_mtim.tv_sec * 1000000000LL + (long long) status.st_mtim.tv_nsec;
+#else
+    modificationTime    = (long long) status.st_mtime * 1000000000LL;
+#endif
+
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the header of a cache file
+ *  @param[in]      magic : identifies the kind of cache file (8 characters)
+ *  @param[in]      version : version of the layout of this kind of file
+ *  @param[in]      sofaFileSize : size of the SOFA file the data is computed from
+ *  @param[in]      sofaModificationTime : modification time of the SOFA file
+ *
+ */
+/************************************************************************************/
+CacheFile::Header CacheFile::MakeHeader(const char magic[8],
+                                        const std::uint32_t version,
+                                        const long long sofaFileSize,
+                                        const long long sofaModificationTime) SOFA_NOEXCEPT
+{
+    CacheFile::Header header;
+    std::memset( &header, 0, sizeof( CacheFile::Header ) );
+
+    std::memcpy( header.magic, magic, sizeof( header.magic ) );
+    header.version              = version;
+    header.byteOrder            = sofaLocal::cacheFileByteOrder;
+    header.sofaFileSize         = sofaFileSize;
+    header.sofaModificationTime = sofaModificationTime;
+
+    return header;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Writes a cache file
+ *  @param[in]      path : path of the file to write
+ *  @param[in]      header : see MakeHeader()
+ *  @param[in]      layout : the dimensions and options of the data (compared when reading)
+ *  @param[in]      layoutSize : in bytes
+ *  @param[in]      blocks : the data blocks, written one after the other
+ *  @param[in]      numBlocks : number of data blocks
+ *
+ *  @details        The file is first written to "<path>.tmp", then renamed to path.
+ *                  Returns false if the file can not be written
+ */
+/************************************************************************************/
+bool CacheFile::Write(const std::string &path,
+                      const CacheFile::Header &header,
+                      const void *layout,
+                      const std::size_t layoutSize,
+                      const CacheFile::ConstBlock *blocks,
+                      const std::size_t numBlocks)
+{
+    const std::string temporaryPath = path + ".tmp";
+
+    {
+        std::ofstream output( temporaryPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+
+        if( output.is_open() == false )
+        {
+            return false;
+        }
+
+        output.write( reinterpret_cast< const char * >( &header ), sizeof( CacheFile::Header ) );
+        output.write( reinterpret_cast< const char * >( layout ), (std::streamsize) layoutSize );
+
+        for( std::size_t i = 0; i < numBlocks; i++ )
+        {
+            if( blocks[i].size > 0 )
+            {
+                output.write( reinterpret_cast< const char * >( blocks[i].data ), (std::streamsize) blocks[i].size );
+            }
+        }
+
+        output.close();
+
+        if( output.good() == false )
+        {
+            std::remove( temporaryPath.c_str() );
+            return false;
+        }
+    }
+
+    if( std::rename( temporaryPath.c_str(), path.c_str() ) != 0 )
+    {
+        /// on Windows, rename does not replace an existing file
+        std::remove( path.c_str() );
+
+        if( std::rename( temporaryPath.c_str(), path.c_str() ) != 0 )
+        {
+            std::remove( temporaryPath.c_str() );
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads a cache file, if it is up to date
+ *  @param[in]      path : path of the file to read
+ *  @param[in]      header : the expected header (see MakeHeader())
+ *  @param[in]      layout : the expected layout
+ *  @param[in]      layoutSize : in bytes
+ *  @param[in]      blocks : the data blocks to fill, in the order they were written
+ *  @param[in]      numBlocks : number of data blocks
+ *
+ *  @details        Returns false if the file does not exist, is not up to date or is truncated
+ *                  (the blocks may then have been partially filled)
+ */
+/************************************************************************************/
+bool CacheFile::Read(const std::string &path,
+                     const CacheFile::Header &header,
+                     const void *layout,
+                     const std::size_t layoutSize,
+                     const CacheFile::Block *blocks,
+                     const std::size_t numBlocks)
+{
+    std::ifstream input( path.c_str(), std::ios::in | std::ios::binary );
+
+    if( input.is_open() == false )
+    {
+        return false;
+    }
+
+    CacheFile::Header fileHeader;
+
+    if( input.read( reinterpret_cast< char * >( &fileHeader ), sizeof( CacheFile::Header ) ).good() == false
+       || std::memcmp( &fileHeader, &header, sizeof( CacheFile::Header ) ) != 0 )
+    {
+        return false;
+    }
+
+    std::vector< char > fileLayout( layoutSize );
+
+    if( layoutSize > 0 )
+    {
+        if( input.read( &fileLayout[0], (std::streamsize) layoutSize ).good() == false
+           || std::memcmp( &fileLayout[0], layout, layoutSize ) != 0 )
+        {
+            return false;
+        }
+    }
+
+    for( std::size_t i = 0; i < numBlocks; i++ )
+    {
+        if( blocks[i].size > 0 )
+        {
+            input.read( reinterpret_cast< char * >( blocks[i].data ), (std::streamsize) blocks[i].size );
+
+            if( input.gcount() != (std::streamsize) blocks[i].size )
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,127 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFACacheFile.h
+ *   @brief      Binary cache files computed from a SOFA file, and stored next to it
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_CACHE_FILE_H__
+#define _SOFA_CACHE_FILE_H__
+
+#include "../src/SOFAPlatform.h"
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace sofa
+{
+
+    /************************************************************************************/
+    /*!
+     *  @brief          Utility functions to write and read the cache files of HRTFSpectra
+     *                  and MinimumPhaseHRIR (internal use)
+     *
+     *  @details        A cache file holds a Header, a layout block (the dimensions and options
+     *                  the data was computed with) and the data blocks, in native byte order.
+     *                  It is up to date when its header and layout match the expected ones :
+     *                  same kind of file, same version, same byte order, same size and modification
+     *                  time of the SOFA file, same layout.
+     *
+     *                  The file is written under a temporary name, then renamed, so that a
+     *                  concurrent reader never sees a partial file, and a crash never leaves one.
+     */
+    /************************************************************************************/
+    namespace CacheFile
+    {
+        /// the header of a cache file
+        struct Header
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t byteOrder;
+            std::int64_t sofaFileSize;
+            std::int64_t sofaModificationTime;
+        };
+
+        /// a block of data to be written
+        struct ConstBlock
+        {
+            const void *data;
+            std::size_t size;                   ///< in bytes
+        };
+
+        /// a block of data to be read
+        struct Block
+        {
+            void *data;
+            std::size_t size;                   ///< in bytes
+        };
+
+        bool GetFileStatus(long long &size,
+                           long long &modificationTime,
+                           const std::string &path);
+
+        sofa::CacheFile::Header MakeHeader(const char magic[8],
+                                           const std::uint32_t version,
+                                           const long long sofaFileSize,
+                                           const long long sofaModificationTime) SOFA_NOEXCEPT;
+
+        bool Write(const std::string &path,
+                   const sofa::CacheFile::Header &header,
+                   const void *layout,
+                   const std::size_t layoutSize,
+                   const sofa::CacheFile::ConstBlock *blocks,
+                   const std::size_t numBlocks);
+
+        bool Read(const std::string &path,
+                  const sofa::CacheFile::Header &header,
+                  const void *layout,
+                  const std::size_t layoutSize,
+                  const sofa::CacheFile::Block *blocks,
+                  const std::size_t numBlocks);
+    }
+
+}
+
+#endif /* _SOFA_CACHE_FILE_H__ */
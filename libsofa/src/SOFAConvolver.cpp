@@ -0,0 +1,738 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAConvolver.cpp
+ *   @brief      Partitioned convolution with the impulse responses of a SOFA file
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAConvolver.h"
+#include "../src/SOFAFFT.h"
+#include "../src/SOFAFile.h"
+#include "../src/SOFAHRTFSpectra.h"
+#include "../src/SOFAExceptions.h"
+#include <algorithm>
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    inline bool isPowerOfTwo(const std::size_t value) SOFA_NOEXCEPT
+    {
+        return ( value > 0 && ( value & ( value - 1 ) ) == 0 );
+    }
+
+    inline std::size_t nextPowerOfTwo(const std::size_t value) SOFA_NOEXCEPT
+    {
+        std::size_t result = 1;
+
+        while( result < value )
+        {
+            result <<= 1;
+        }
+
+        return result;
+    }
+
+    /// accumulates the product of two spectra : y += a * b
+    inline void complexMultiplyAdd(std::complex< float > *y,
+                                   const std::complex< float > *a,
+                                   const std::complex< float > *b,
+                                   const std::size_t numBins) SOFA_NOEXCEPT
+    {
+        /// std::complex< float > is layout-compatible with float[2]
+        float *yy       = reinterpret_cast< float * >( y );
+        const float *aa = reinterpret_cast< const float * >( a );
+        const float *bb = reinterpret_cast< const float * >( b );
+
+        for( std::size_t k = 0; k < numBins; k++ )
+        {
+            const float re = aa[ 2 * k ] * bb[ 2 * k ]     - aa[ 2 * k + 1 ] * bb[ 2 * k + 1 ];
+            const float im = aa[ 2 * k ] * bb[ 2 * k + 1 ] + aa[ 2 * k + 1 ] * bb[ 2 * k ];
+
+            yy[ 2 * k ]     += re;
+            yy[ 2 * k + 1 ] += im;
+        }
+    }
+}
+
+//==============================================================================
+// PartitionedFilterSet
+//==============================================================================
+
+/************************************************************************************/
+/*!
+ *  @brief          Loads and partitions the Data.IR impulse responses of a file
+ *  @param[in]      file : a SOFA file with a Data.IR variable (e.g. SimpleFreeFieldHRIR,
+ *                  SingleRoomDRIR, MultiSpeakerBRIR)
+ *  @param[in]      blockSize : size of the audio blocks (power of 2)
+ *  @param[in]      maxBlockSize : maximum size of the partitions (power of 2), for the non-uniform
+ *                  layout. Use 0 (or blockSize) for a uniform layout
+ *
+ *  @details        Throws an exception if Data.IR can not be read
+ */
+/************************************************************************************/
+PartitionedFilterSet::PartitionedFilterSet(const sofa::File &file,
+                                           const std::size_t blockSize_,
+                                           const std::size_t maxBlockSize)
+: numFilters( 0 )
+, filterLength( 0 )
+, blockSize( blockSize_ )
+, filterStride( 0 )
+, segments()
+, spectra()
+{
+    if( file.HasVariable( "Data.IR" ) == false )
+    {
+        SOFA_THROW( "missing 'Data.IR' variable" );
+    }
+
+    std::vector< std::size_t > dims;
+    file.GetVariableDimensions( dims, "Data.IR" );
+
+    if( dims.size() < 2 )
+    {
+        SOFA_THROW( "invalid 'Data.IR' dimensions" );
+    }
+
+    numFilters   = 1;
+    filterLength = dims.back();
+
+    for( std::size_t i = 0; i < dims.size() - 1; i++ )
+    {
+        numFilters *= dims[i];
+    }
+
+    std::vector< double > values;
+
+    if( file.GetValues( values, "Data.IR" ) == false || values.size() != numFilters * filterLength )
+    {
+        SOFA_THROW( "invalid 'Data.IR' variable" );
+    }
+
+    initializeLayout( maxBlockSize );
+    computeSpectra( ( values.empty() == false ) ? &values[0] : (const double *) NULL );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Partitions a set of filters
+ *  @param[in]      filters : the filters [ numFilters filterLength ]
+ *  @param[in]      numFilters : number of filters
+ *  @param[in]      filterLength : number of samples of each filter
+ *  @param[in]      blockSize : size of the audio blocks (power of 2)
+ *  @param[in]      maxBlockSize : maximum size of the partitions (power of 2), for the non-uniform
+ *                  layout. Use 0 (or blockSize) for a uniform layout
+ *
+ */
+/************************************************************************************/
+PartitionedFilterSet::PartitionedFilterSet(const double *filters,
+                                           const std::size_t numFilters_,
+                                           const std::size_t filterLength_,
+                                           const std::size_t blockSize_,
+                                           const std::size_t maxBlockSize)
+: numFilters( numFilters_ )
+, filterLength( filterLength_ )
+, blockSize( blockSize_ )
+, filterStride( 0 )
+, segments()
+, spectra()
+{
+    initializeLayout( maxBlockSize );
+    computeSpectra( filters );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Partitions a set of filters
+ *  @param[in]      filters : the filters [ numFilters filterLength ]
+ *  @param[in]      numFilters : number of filters
+ *  @param[in]      filterLength : number of samples of each filter
+ *  @param[in]      blockSize : size of the audio blocks (power of 2)
+ *  @param[in]      maxBlockSize : maximum size of the partitions (power of 2), for the non-uniform
+ *                  layout. Use 0 (or blockSize) for a uniform layout
+ *
+ */
+/************************************************************************************/
+PartitionedFilterSet::PartitionedFilterSet(const float *filters,
+                                           const std::size_t numFilters_,
+                                           const std::size_t filterLength_,
+                                           const std::size_t blockSize_,
+                                           const std::size_t maxBlockSize)
+: numFilters( numFilters_ )
+, filterLength( filterLength_ )
+, blockSize( blockSize_ )
+, filterStride( 0 )
+, segments()
+, spectra()
+{
+    initializeLayout( maxBlockSize );
+    computeSpectra( filters );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Uses precomputed spectra, with a uniform layout (no FFT is performed)
+ *  @param[in]      spectra : the spectra of the impulse responses of a SimpleFreeFieldHRIR
+ *                  or SimpleHeadphoneIR file; the block size is the one of the spectra
+ *
+ */
+/************************************************************************************/
+PartitionedFilterSet::PartitionedFilterSet(const sofa::HRTFSpectra &hrtfSpectra)
+: numFilters( hrtfSpectra.GetNumMeasurements() * hrtfSpectra.GetNumReceivers() )
+, filterLength( hrtfSpectra.GetNumDataSamples() )
+, blockSize( hrtfSpectra.GetBlockSize() )
+, filterStride( 0 )
+, segments()
+, spectra()
+{
+    initializeLayout( 0 );
+
+    SOFA_ASSERT( segments.size() == 1 && segments[0].numPartitions == hrtfSpectra.GetNumPartitions() );
+
+    spectra.resize( numFilters * filterStride );
+
+    const std::size_t numReceivers  = hrtfSpectra.GetNumReceivers();
+    const std::size_t numBins       = hrtfSpectra.GetNumBins();
+
+    for( std::size_t f = 0; f < numFilters; f++ )
+    {
+        for( std::size_t p = 0; p < segments[0].numPartitions; p++ )
+        {
+            const Complex *spectrum = hrtfSpectra.GetSpectrum( f / numReceivers, f % numReceivers, p );
+
+            std::copy( spectrum, spectrum + numBins, &spectra[ f * filterStride + p * numBins ] );
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+PartitionedFilterSet::~PartitionedFilterSet()
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes the size and position of the partitions
+ *
+ *  @details        A segment of partitions of size B' can only start at an offset >= B' - B
+ *                  (B being the audio block size), since its output is available B' - B samples
+ *                  after the output of the first segment. Doubling the size every two partitions
+ *                  satisfies this constraint.
+ */
+/************************************************************************************/
+void PartitionedFilterSet::initializeLayout(const std::size_t maxBlockSize_)
+{
+    const std::size_t maxBlockSize = ( maxBlockSize_ == 0 ) ? blockSize : maxBlockSize_;
+
+    if( sofaLocal::isPowerOfTwo( blockSize ) == false
+       || sofaLocal::isPowerOfTwo( maxBlockSize ) == false
+       || maxBlockSize < blockSize )
+    {
+        SOFA_THROW( "invalid block size (should be a power of 2)" );
+    }
+
+    std::size_t offset            = 0;
+    std::size_t partitionSize     = blockSize;
+    filterStride                  = 0;
+
+    /// even an empty filter gets one partition, so that the convolver always has one stage
+    do
+    {
+        const std::size_t remaining = ( filterLength > offset ) ? filterLength - offset : 0;
+
+        std::size_t numPartitions = ( remaining + partitionSize - 1 ) / partitionSize;
+
+        if( partitionSize < maxBlockSize )
+        {
+            numPartitions = std::min( numPartitions, (std::size_t) 2 );
+        }
+
+        numPartitions = std::max( numPartitions, (std::size_t) 1 );
+
+        Segment segment;
+        segment.blockSize      = partitionSize;
+        segment.offset         = offset;
+        segment.numPartitions  = numPartitions;
+        segment.spectrumOffset = filterStride;
+
+        segments.push_back( segment );
+
+        filterStride += numPartitions * ( partitionSize + 1 );
+        offset       += numPartitions * partitionSize;
+
+        if( partitionSize < maxBlockSize )
+        {
+            partitionSize *= 2;
+        }
+    }
+    while( offset < filterLength );
+}
+
+template< typename Type >
+void PartitionedFilterSet::computeSpectra(const Type *filters)
+{
+    spectra.assign( numFilters * filterStride, Complex( 0.0f, 0.0f ) );
+
+    for( std::size_t s = 0; s < segments.size(); s++ )
+    {
+        const Segment &segment = segments[s];
+
+        sofa::FFT< float > fft( 2 * segment.blockSize );
+        std::vector< float > buffer( 2 * segment.blockSize );
+
+        for( std::size_t f = 0; f < numFilters; f++ )
+        {
+            const Type *filter = filters + f * filterLength;
+
+            for( std::size_t p = 0; p < segment.numPartitions; p++ )
+            {
+                const std::size_t start = segment.offset + p * segment.blockSize;
+
+                /// the partition is zero-padded to twice its size (overlap-save)
+                std::fill( buffer.begin(), buffer.end(), 0.0f );
+
+                for( std::size_t n = 0; n < segment.blockSize && start + n < filterLength; n++ )
+                {
+                    buffer[n] = (float) filter[ start + n ];
+                }
+
+                Complex *spectrum = &spectra[ f * filterStride + segment.spectrumOffset + p * ( segment.blockSize + 1 ) ];
+
+                fft.Forward( &buffer[0], spectrum );
+            }
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of filters
+ *
+ */
+/************************************************************************************/
+std::size_t PartitionedFilterSet::GetNumFilters() const SOFA_NOEXCEPT
+{
+    return numFilters;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of samples of each filter
+ *
+ */
+/************************************************************************************/
+std::size_t PartitionedFilterSet::GetFilterLength() const SOFA_NOEXCEPT
+{
+    return filterLength;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the size of the audio blocks
+ *
+ */
+/************************************************************************************/
+std::size_t PartitionedFilterSet::GetBlockSize() const SOFA_NOEXCEPT
+{
+    return blockSize;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if all the partitions have the size of the audio block
+ *
+ */
+/************************************************************************************/
+bool PartitionedFilterSet::IsUniform() const SOFA_NOEXCEPT
+{
+    return ( segments.size() == 1 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of segments of the layout
+ *
+ */
+/************************************************************************************/
+std::size_t PartitionedFilterSet::GetNumSegments() const SOFA_NOEXCEPT
+{
+    return segments.size();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns one segment of the layout
+ *
+ */
+/************************************************************************************/
+const PartitionedFilterSet::Segment & PartitionedFilterSet::GetSegment(const std::size_t segmentIndex) const SOFA_NOEXCEPT
+{
+    SOFA_ASSERT( segmentIndex < segments.size() );
+
+    return segments[segmentIndex];
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the spectrum of one partition (blockSize + 1 bins of the segment)
+ *
+ */
+/************************************************************************************/
+const PartitionedFilterSet::Complex * PartitionedFilterSet::GetSpectrum(const std::size_t filterIndex,
+                                                                      const std::size_t segmentIndex,
+                                                                      const std::size_t partitionIndex) const SOFA_NOEXCEPT
+{
+    SOFA_ASSERT( filterIndex < numFilters );
+    SOFA_ASSERT( segmentIndex < segments.size() );
+    SOFA_ASSERT( partitionIndex < segments[segmentIndex].numPartitions );
+
+    const Segment &segment = segments[segmentIndex];
+
+    return &spectra[ filterIndex * filterStride + segment.spectrumOffset + partitionIndex * ( segment.blockSize + 1 ) ];
+}
+
+//==============================================================================
+// Convolver::Stage
+//==============================================================================
+
+/************************************************************************************/
+/*!
+ *  @class          Convolver::Stage
+ *  @brief          Uniformly partitioned overlap-save convolution of one segment
+ *
+ */
+/************************************************************************************/
+class Convolver::Stage
+{
+public:
+    typedef sofa::PartitionedFilterSet::Complex Complex;
+
+    Stage(const sofa::PartitionedFilterSet &filters_, const std::size_t segmentIndex_, const std::size_t filter_)
+    : filters( filters_ )
+    , segmentIndex( segmentIndex_ )
+    , blockSize( filters_.GetSegment( segmentIndex_ ).blockSize )
+    , numPartitions( filters_.GetSegment( segmentIndex_ ).numPartitions )
+    , numBins( filters_.GetSegment( segmentIndex_ ).blockSize + 1 )
+    , fft( 2 * filters_.GetSegment( segmentIndex_ ).blockSize )
+    , input( 2 * blockSize, 0.0f )
+    , fill( 0 )
+    , delayLine( numPartitions * numBins )
+    , head( 0 )
+    , accumulator( numBins )
+    , current( 2 * blockSize, 0.0f )
+    , next( 2 * blockSize, 0.0f )
+    , filter( filter_ )
+    {
+        Reset();
+    }
+
+    void Reset() SOFA_NOEXCEPT
+    {
+        std::fill( input.begin(), input.end(), 0.0f );
+        std::fill( delayLine.begin(), delayLine.end(), Complex( 0.0f, 0.0f ) );
+        fill = 0;
+        head = 0;
+    }
+
+    /// appends input samples; returns true when a block of the stage is complete
+    bool Push(const float *samples, const std::size_t numSamples) SOFA_NOEXCEPT
+    {
+        std::copy( samples, samples + numSamples, input.begin() + blockSize + fill );
+        fill += numSamples;
+
+        return ( fill == blockSize );
+    }
+
+    /// convolves the last block, and adds the result to the accumulator of the convolver
+    void Compute(const std::size_t targetFilter,
+                 float *output,
+                 const std::size_t outputMask,
+                 const std::size_t outputPosition) SOFA_NOEXCEPT
+    {
+        /// the delay line holds the spectra of the last numPartitions blocks (overlapping by 50%)
+        head = ( head + numPartitions - 1 ) % numPartitions;
+        fft.Forward( &input[0], &delayLine[ head * numBins ] );
+
+        std::copy( input.begin() + blockSize, input.end(), input.begin() );
+        fill = 0;
+
+        convolve( filter, current );
+
+        if( targetFilter != filter )
+        {
+            convolve( targetFilter, next );
+
+            /// linear crossfade between the former and the new filter
+            const float increment = 1.0f / (float) blockSize;
+
+            for( std::size_t n = 0; n < blockSize; n++ )
+            {
+                const float gain = (float) ( n + 1 ) * increment;
+
+                current[ blockSize + n ] += gain * ( next[ blockSize + n ] - current[ blockSize + n ] );
+            }
+
+            filter = targetFilter;
+        }
+
+        /// overlap-save : only the second half of the block is valid
+        for( std::size_t n = 0; n < blockSize; n++ )
+        {
+            output[ ( outputPosition + n ) & outputMask ] += current[ blockSize + n ];
+        }
+    }
+
+    std::size_t GetFilter() const SOFA_NOEXCEPT
+    {
+        return filter;
+    }
+
+    std::size_t GetBlockSize() const SOFA_NOEXCEPT
+    {
+        return blockSize;
+    }
+
+private:
+    void convolve(const std::size_t filterIndex, std::vector< float > &result) SOFA_NOEXCEPT
+    {
+        std::fill( accumulator.begin(), accumulator.end(), Complex( 0.0f, 0.0f ) );
+
+        for( std::size_t p = 0; p < numPartitions; p++ )
+        {
+            const Complex *x = &delayLine[ ( ( head + p ) % numPartitions ) * numBins ];
+            const Complex *h = filters.GetSpectrum( filterIndex, segmentIndex, p );
+
+            sofaLocal::complexMultiplyAdd( &accumulator[0], x, h, numBins );
+        }
+
+        fft.Inverse( &accumulator[0], &result[0] );
+    }
+
+private:
+    const sofa::PartitionedFilterSet &filters;
+    const std::size_t segmentIndex;
+    const std::size_t blockSize;
+    const std::size_t numPartitions;
+    const std::size_t numBins;
+
+    sofa::FFT< float > fft;
+
+    std::vector< float > input;             ///< previous block and current block
+    std::size_t fill;                       ///< number of samples in the current block
+
+    std::vector< Complex > delayLine;       ///< frequency-domain delay line [ numPartitions numBins ]
+    std::size_t head;                       ///< position of the most recent spectrum
+
+    std::vector< Complex > accumulator;
+    std::vector< float > current;           ///< output with the current filter
+    std::vector< float > next;              ///< output with the new filter (during a crossfade)
+
+    std::size_t filter;
+
+private:
+    SOFA_AVOID_COPY_CONSTRUCTOR( Stage );
+};
+
+//==============================================================================
+// Convolver
+//==============================================================================
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor
+ *  @param[in]      filters : the partitioned filters. The set must outlive the convolver
+ *  @param[in]      filterIndex : initial filter
+ *
+ *  @details        All the memory needed for the processing is allocated here
+ */
+/************************************************************************************/
+Convolver::Convolver(const sofa::PartitionedFilterSet &filters_, const std::size_t filterIndex)
+: filters( filters_ )
+, stages()
+, output()
+, outputMask( 0 )
+, time( 0 )
+, targetFilter( filterIndex )
+, requestedFilter( filterIndex )
+{
+    SOFA_ASSERT( filterIndex < filters.GetNumFilters() );
+
+    std::size_t outputSize = 0;
+
+    for( std::size_t s = 0; s < filters.GetNumSegments(); s++ )
+    {
+        const sofa::PartitionedFilterSet::Segment &segment = filters.GetSegment( s );
+
+        stages.push_back( std::unique_ptr< Stage >( new Stage( filters, s, filterIndex ) ) );
+
+        outputSize = std::max( outputSize, segment.offset + segment.blockSize + filters.GetBlockSize() );
+    }
+
+    outputSize = sofaLocal::nextPowerOfTwo( outputSize );
+
+    output.assign( outputSize, 0.0f );
+    outputMask = outputSize - 1;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+Convolver::~Convolver()
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of samples processed by each call to Process()
+ *
+ */
+/************************************************************************************/
+std::size_t Convolver::GetBlockSize() const SOFA_NOEXCEPT
+{
+    return filters.GetBlockSize();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Changes the filter
+ *  @param[in]      filterIndex : the new filter
+ *
+ *  @details        The new filter is crossfaded in at the next call to Process(). If a crossfade
+ *                  is already running, the new filter will be used when it is over.
+ *                  This method is lock-free and can be called from any thread.
+ */
+/************************************************************************************/
+void Convolver::SetFilter(const std::size_t filterIndex) SOFA_NOEXCEPT
+{
+    if( filterIndex < filters.GetNumFilters() )
+    {
+        requestedFilter.store( filterIndex );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the most recently requested filter
+ *
+ */
+/************************************************************************************/
+std::size_t Convolver::GetFilter() const SOFA_NOEXCEPT
+{
+    return requestedFilter.load();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Clears the internal state (delay lines and pending outputs)
+ *
+ */
+/************************************************************************************/
+void Convolver::Reset() SOFA_NOEXCEPT
+{
+    for( std::size_t s = 0; s < stages.size(); s++ )
+    {
+        stages[s]->Reset();
+    }
+
+    std::fill( output.begin(), output.end(), 0.0f );
+    time = 0;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Processes one audio block
+ *  @param[in]      input : GetBlockSize() input samples
+ *  @param[out]     output : GetBlockSize() output samples (may be the same array as input)
+ *
+ */
+/************************************************************************************/
+void Convolver::Process(const float *input, float *output_) SOFA_NOEXCEPT
+{
+    const std::size_t blockSize = filters.GetBlockSize();
+
+    /// a new filter is only taken into account once all the stages have faded in the previous one
+    bool idle = true;
+    for( std::size_t s = 0; s < stages.size(); s++ )
+    {
+        idle = idle && ( stages[s]->GetFilter() == targetFilter );
+    }
+
+    if( idle == true )
+    {
+        targetFilter = requestedFilter.load();
+    }
+
+    const std::size_t end = time + blockSize;
+
+    for( std::size_t s = 0; s < stages.size(); s++ )
+    {
+        Stage *stage = stages[s].get();
+
+        if( stage->Push( input, blockSize ) == true )
+        {
+            /// the stage has convolved the input samples [ end - B', end [ with the partitions
+            /// starting at 'offset' in the filter
+            const std::size_t position = end - stage->GetBlockSize() + filters.GetSegment( s ).offset;
+
+            stage->Compute( targetFilter, &output[0], outputMask, position );
+        }
+    }
+
+    for( std::size_t n = 0; n < blockSize; n++ )
+    {
+        float &sample = output[ ( time + n ) & outputMask ];
+
+        output_[n] = sample;
+        sample     = 0.0f;
+    }
+
+    time = end;
+}
@@ -0,0 +1,212 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAConvolver.h
+ *   @brief      Partitioned convolution with the impulse responses of a SOFA file
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_CONVOLVER_H__
+#define _SOFA_CONVOLVER_H__
+
+#include "../src/SOFAPlatform.h"
+#include <vector>
+#include <complex>
+#include <atomic>
+#include <memory>
+#include <cstddef>
+
+namespace sofa
+{
+    class File;
+    class HRTFSpectra;
+
+    /************************************************************************************/
+    /*!
+     *  @class          PartitionedFilterSet
+     *  @brief          Frequency-domain partitions of a set of FIR filters
+     *
+     *  @details        The filters are split into partitions, whose spectra are computed once
+     *                  (at load time), so that the convolution only has to transform the input.
+     *
+     *                  With a uniform layout, all the partitions have the size of the audio block.
+     *                  With a non-uniform layout (for long filters, e.g. BRIRs), the first partitions
+     *                  have the size of the audio block, and the size doubles every two partitions,
+     *                  up to a maximum size : this reduces the cost of the convolution while keeping
+     *                  the latency of the uniform layout.
+     *
+     *                  When loaded from a SOFA file, the filters are the Data.IR impulse responses;
+     *                  the filter index is m * R + r for a Data.IR of size [ M R N ],
+     *                  and ( m * R + r ) * E + e for a Data.IR of size [ M R E N ].
+     *
+     *                  The set is immutable once built, and can be shared by several Convolver.
+     */
+    /************************************************************************************/
+    class SOFA_API PartitionedFilterSet
+    {
+    public:
+        typedef std::complex< float > Complex;
+
+        /// a group of consecutive partitions sharing the same size
+        struct Segment
+        {
+            std::size_t blockSize;          ///< size of the partitions (the FFT size is twice this size)
+            std::size_t offset;             ///< position of the first partition in the filter, in samples
+            std::size_t numPartitions;      ///< number of partitions in the segment
+            std::size_t spectrumOffset;     ///< position of the first spectrum in the storage of one filter
+        };
+
+    public:
+        PartitionedFilterSet(const sofa::File &file,
+                             const std::size_t blockSize,
+                             const std::size_t maxBlockSize = 0);
+
+        PartitionedFilterSet(const double *filters,
+                             const std::size_t numFilters,
+                             const std::size_t filterLength,
+                             const std::size_t blockSize,
+                             const std::size_t maxBlockSize = 0);
+
+        PartitionedFilterSet(const float *filters,
+                             const std::size_t numFilters,
+                             const std::size_t filterLength,
+                             const std::size_t blockSize,
+                             const std::size_t maxBlockSize = 0);
+
+        explicit PartitionedFilterSet(const sofa::HRTFSpectra &spectra);
+
+        ~PartitionedFilterSet();
+
+        std::size_t GetNumFilters() const SOFA_NOEXCEPT;
+        std::size_t GetFilterLength() const SOFA_NOEXCEPT;
+        std::size_t GetBlockSize() const SOFA_NOEXCEPT;
+
+        bool IsUniform() const SOFA_NOEXCEPT;
+
+        std::size_t GetNumSegments() const SOFA_NOEXCEPT;
+        const Segment & GetSegment(const std::size_t segmentIndex) const SOFA_NOEXCEPT;
+
+        const Complex * GetSpectrum(const std::size_t filterIndex,
+                                    const std::size_t segmentIndex,
+                                    const std::size_t partitionIndex) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        void initializeLayout(const std::size_t maxBlockSize);
+
+        template< typename Type >
+        void computeSpectra(const Type *filters);
+
+    private:
+        //==============================================================================
+        std::size_t numFilters;
+        std::size_t filterLength;
+        std::size_t blockSize;
+        std::size_t filterStride;           ///< number of bins stored for one filter
+
+        std::vector< Segment > segments;
+        std::vector< Complex > spectra;     ///< [ numFilters filterStride ]
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( PartitionedFilterSet );
+    };
+
+    /************************************************************************************/
+    /*!
+     *  @class          Convolver
+     *  @brief          Overlap-save partitioned convolution of one audio channel
+     *
+     *  @details        The convolver runs the (uniform or non-uniform) partition layout of a
+     *                  PartitionedFilterSet, using a frequency-domain delay line of the input.
+     *                  The larger partitions are processed when their input block is complete.
+     *
+     *                  The filter can be changed at any time with SetFilter() (which is lock-free) :
+     *                  the change takes effect at the next block, and the outputs of the former and
+     *                  new filters are crossfaded over one block of each segment.
+     *
+     *                  Process() and SetFilter() do not allocate memory. The filter set must outlive
+     *                  the convolver. There is no latency in addition to the audio block.
+     */
+    /************************************************************************************/
+    class SOFA_API Convolver
+    {
+    public:
+        Convolver(const sofa::PartitionedFilterSet &filters, const std::size_t filterIndex = 0);
+        ~Convolver();
+
+        std::size_t GetBlockSize() const SOFA_NOEXCEPT;
+
+        void SetFilter(const std::size_t filterIndex) SOFA_NOEXCEPT;
+        std::size_t GetFilter() const SOFA_NOEXCEPT;
+
+        void Reset() SOFA_NOEXCEPT;
+
+        void Process(const float *input, float *output) SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        class Stage;
+
+    private:
+        //==============================================================================
+        const sofa::PartitionedFilterSet &filters;
+
+        std::vector< std::unique_ptr< Stage > > stages;     ///< one stage per segment of the layout
+
+        std::vector< float > output;            ///< accumulation of the outputs of all stages
+        std::size_t outputMask;                 ///< the size of the accumulator is a power of 2
+        std::size_t time;                       ///< number of samples processed
+
+        std::size_t targetFilter;               ///< filter used (or being faded in) by the stages
+        std::atomic< std::size_t > requestedFilter;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( Convolver );
+    };
+
+}
+
+#endif /* _SOFA_CONVOLVER_H__ */
@@ -0,0 +1,273 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFADRIRInterpolator.cpp
+ *   @brief      Distance-weighted blending of DRIRs for arbitrary listener positions
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFADRIRInterpolator.h"
+#include "../src/SOFASingleRoomDRIR.h"
+#include "../src/SOFAExceptions.h"
+#include <mutex>
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    /// below this distance (in meter), the listener is on a measured position
+    static const double coincidentDistance = 1e-6;
+
+    /// reads the neighbouring measurements one by one, and accumulates them
+    template< typename T >
+    bool blend(T *values,
+               std::vector< T > &slice,
+               const sofa::SingleRoomDRIR &file,
+               const std::size_t *indices,
+               const double *weights,
+               const std::size_t numIndices,
+               const std::size_t numReceivers,
+               const std::size_t numDataSamples)
+    {
+        const std::size_t size = numReceivers * numDataSamples;
+
+        if( slice.size() < size )
+        {
+            slice.resize( size );
+        }
+
+        for( std::size_t i = 0; i < size; i++ )
+        {
+            values[i] = (T) 0;
+        }
+
+        const std::lock_guard< std::recursive_mutex > lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+        for( std::size_t j = 0; j < numIndices; j++ )
+        {
+            if( file.GetDataIR( (unsigned long) indices[j], &slice[0],
+                                (unsigned long) numReceivers, (unsigned long) numDataSamples ) == false )
+            {
+                return false;
+            }
+
+            const T weight = (T) weights[j];
+
+            for( std::size_t i = 0; i < size; i++ )
+            {
+                values[i] += weight * slice[i];
+            }
+        }
+
+        return true;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the index of the listener positions of a SingleRoomDRIR file
+ *  @param[in]      file : a valid SingleRoomDRIR file. It must outlive the interpolator
+ *  @param[in]      numNeighbours : maximum number of measurements blended by a query
+ *
+ *  @details        Throws an exception if the ListenerPosition variable cannot be read,
+ *                  or if it does not hold one position per measurement
+ */
+/************************************************************************************/
+DRIRInterpolator::DRIRInterpolator(const sofa::SingleRoomDRIR &file_,
+                                   const std::size_t numNeighbours_)
+: file( file_ )
+, index( file_ )
+, numReceivers( (std::size_t) file_.GetNumReceivers() )
+, numDataSamples( (std::size_t) file_.GetNumDataSamples() )
+, numNeighbours( numNeighbours_ )
+, indices( numNeighbours_ )
+, weights( numNeighbours_ )
+, slice()
+, sliceFloat()
+{
+    if( numNeighbours == 0 )
+    {
+        SOFA_THROW( "invalid number of neighbours" );
+    }
+
+    if( index.GetNumPositions() != (std::size_t) file.GetNumMeasurements() )
+    {
+        SOFA_THROW( "'ListenerPosition' should be [ M C ]" );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+DRIRInterpolator::~DRIRInterpolator()
+{
+}
+
+std::size_t DRIRInterpolator::GetNumMeasurements() const SOFA_NOEXCEPT
+{
+    return index.GetNumPositions();
+}
+
+std::size_t DRIRInterpolator::GetNumReceivers() const SOFA_NOEXCEPT
+{
+    return numReceivers;
+}
+
+std::size_t DRIRInterpolator::GetNumDataSamples() const SOFA_NOEXCEPT
+{
+    return numDataSamples;
+}
+
+std::size_t DRIRInterpolator::GetNumNeighbours() const SOFA_NOEXCEPT
+{
+    return numNeighbours;
+}
+
+const sofa::ListenerPositionIndex & DRIRInterpolator::GetIndex() const SOFA_NOEXCEPT
+{
+    return index;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes the measurements to be blended for a listener position
+ *  @param[out]     indices : indices of the measurements, sorted by increasing distance.
+ *                  The array must be allocated large enough (GetNumNeighbours())
+ *  @param[out]     weights : the corresponding weights (their sum is 1).
+ *                  The array must be allocated large enough (GetNumNeighbours())
+ *  @param[in]      x : position of the listener, in meter
+ *  @param[in]      y : position of the listener, in meter
+ *  @param[in]      z : position of the listener, in meter
+ *  @return         the number of measurements to blend (0 if there is no measurement)
+ *
+ *  @details        The weights are inversely proportional to the distances.
+ *                  This method does not allocate memory
+ */
+/************************************************************************************/
+std::size_t DRIRInterpolator::GetWeights(std::size_t *indices_,
+                                         double *weights_,
+                                         const double x,
+                                         const double y,
+                                         const double z) const SOFA_NOEXCEPT
+{
+    /// the distances are computed in the weights array
+    const std::size_t numFound = index.FindKNearest( indices_, weights_, numNeighbours, x, y, z );
+
+    if( numFound == 0 )
+    {
+        return 0;
+    }
+
+    if( weights_[0] <= sofaLocal::coincidentDistance )
+    {
+        weights_[0] = 1.0;
+        return 1;
+    }
+
+    double sum = 0.0;
+
+    for( std::size_t i = 0; i < numFound; i++ )
+    {
+        weights_[i] = 1.0 / weights_[i];
+        sum += weights_[i];
+    }
+
+    for( std::size_t i = 0; i < numFound; i++ )
+    {
+        weights_[i] /= sum;
+    }
+
+    return numFound;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes the blended DRIR for one listener position
+ *  @param[out]     values : blended impulse responses [ R N ].
+ *                  The array must be allocated large enough (R x N)
+ *  @param[in]      x : position of the listener, in meter
+ *  @param[in]      y : position of the listener, in meter
+ *  @param[in]      z : position of the listener, in meter
+ *  @return         false if there is no measurement, or the data cannot be read
+ *
+ *  @details        Reads GetNumNeighbours() slices of Data.IR at most
+ */
+/************************************************************************************/
+bool DRIRInterpolator::GetDRIR(double *values,
+                               const double x,
+                               const double y,
+                               const double z)
+{
+    const std::size_t numFound = GetWeights( &indices[0], &weights[0], x, y, z );
+
+    if( numFound == 0 )
+    {
+        return false;
+    }
+
+    return sofaLocal::blend( values, slice, file, &indices[0], &weights[0], numFound, numReceivers, numDataSamples );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes the blended DRIR for one listener position
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool DRIRInterpolator::GetDRIR(float *values,
+                               const double x,
+                               const double y,
+                               const double z)
+{
+    const std::size_t numFound = GetWeights( &indices[0], &weights[0], x, y, z );
+
+    if( numFound == 0 )
+    {
+        return false;
+    }
+
+    return sofaLocal::blend( values, sliceFloat, file, &indices[0], &weights[0], numFound, numReceivers, numDataSamples );
+}
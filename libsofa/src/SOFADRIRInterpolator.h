@@ -0,0 +1,136 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFADRIRInterpolator.h
+ *   @brief      Distance-weighted blending of DRIRs for arbitrary listener positions
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_DRIR_INTERPOLATOR_H__
+#define _SOFA_DRIR_INTERPOLATOR_H__
+
+#include "../src/SOFAListenerPositionIndex.h"
+#include <vector>
+
+namespace sofa
+{
+    class SingleRoomDRIR;
+
+    /************************************************************************************/
+    /*!
+     *  @class          DRIRInterpolator
+     *  @brief          Computes DRIRs for arbitrary listener positions in a room,
+     *                  from the measured ones
+     *
+     *  @details        Only the ListenerPosition variable is loaded in the constructor : room
+     *                  measurements are usually too large to be held in memory. A query finds the
+     *                  measurements closest to the listener with a ListenerPositionIndex, reads
+     *                  their Data.IR slices [ R N ] from the file (one hyperslab per measurement)
+     *                  and blends them with inverse-distance weights. A listener lying on a
+     *                  measured position gets this measurement only.
+     *
+     *                  The responses are blended sample by sample : the direct sound and early
+     *                  reflections of distant neighbours do not line up, so the grid of measurements
+     *                  should be dense enough for the intended use.
+     *
+     *                  GetWeights() is const, does not allocate memory and does not access the file.
+     *                  GetDRIR() reads from the file, while holding the netCDF library mutex : it
+     *                  should be called from a loader thread, not from the audio callback. The file
+     *                  must outlive the interpolator, and must not be used concurrently by another
+     *                  thread without the library mutex.
+     */
+    /************************************************************************************/
+    class SOFA_API DRIRInterpolator
+    {
+    public:
+        DRIRInterpolator(const sofa::SingleRoomDRIR &file,
+                         const std::size_t numNeighbours = 4);
+
+        ~DRIRInterpolator();
+
+        std::size_t GetNumMeasurements() const SOFA_NOEXCEPT;
+        std::size_t GetNumReceivers() const SOFA_NOEXCEPT;
+        std::size_t GetNumDataSamples() const SOFA_NOEXCEPT;
+        std::size_t GetNumNeighbours() const SOFA_NOEXCEPT;
+
+        const sofa::ListenerPositionIndex & GetIndex() const SOFA_NOEXCEPT;
+
+        std::size_t GetWeights(std::size_t *indices,
+                               double *weights,
+                               const double x,
+                               const double y,
+                               const double z) const SOFA_NOEXCEPT;
+
+        bool GetDRIR(double *values,
+                     const double x,
+                     const double y,
+                     const double z);
+
+        bool GetDRIR(float *values,
+                     const double x,
+                     const double y,
+                     const double z);
+
+    private:
+        //==============================================================================
+        const sofa::SingleRoomDRIR &file;
+        const sofa::ListenerPositionIndex index;
+
+        std::size_t numReceivers;                   ///< R
+        std::size_t numDataSamples;                 ///< N
+        const std::size_t numNeighbours;
+
+        std::vector< std::size_t > indices;         ///< neighbours of the current query
+        std::vector< double > weights;              ///< weights of the current query
+
+        std::vector< double > slice;                ///< one measurement [ R N ], read from the file
+        std::vector< float > sliceFloat;            ///< same, in single precision
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( DRIRInterpolator );
+    };
+
+}
+
+#endif /* _SOFA_DRIR_INTERPOLATOR_H__ */
@@ -0,0 +1,380 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFADataset.cpp
+ *   @brief      Immutable, fully decoded content of a SOFA file
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFADataset.h"
+#include "../src/SOFAFile.h"
+#include "../src/SOFAExceptions.h"
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    inline std::size_t toSize(const long dimension) SOFA_NOEXCEPT
+    {
+        return ( dimension > 0 ) ? (std::size_t) dimension : 0;
+    }
+
+    template< typename Type >
+    inline std::size_t memorySize(const std::vector< Type > &values) SOFA_NOEXCEPT
+    {
+        return values.capacity() * sizeof( Type );
+    }
+
+    /// reads a variable if it exists (the optional variables are left empty)
+    inline bool readVariable(std::vector< double > &values,
+                             const sofa::File &file,
+                             const std::string &variableName)
+    {
+        values.clear();
+
+        if( file.HasVariable( variableName ) == false )
+        {
+            return true;
+        }
+
+        return file.GetValues( values, variableName );
+    }
+
+    inline void readPosition(sofa::Dataset::Position &position,
+                             const sofa::File &file,
+                             const std::string &variableName)
+    {
+        if( readVariable( position.values, file, variableName ) == false )
+        {
+            SOFA_THROW( "invalid '" + variableName + "' variable" );
+        }
+
+        position.dimensions.clear();
+
+        if( file.HasVariable( variableName ) == true )
+        {
+            file.GetVariableDimensions( position.dimensions, variableName );
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads all the data of a SOFA file
+ *  @param[in]      file : a valid SOFA file
+ *
+ *  @details        Throws an exception if the file is not valid, or the data can not be read
+ */
+/************************************************************************************/
+Dataset::Dataset(const sofa::File &file)
+: filename( file.GetFilename() )
+, conventions()
+, attributes()
+, numMeasurements( 0 )
+, numReceivers( 0 )
+, numEmitters( 0 )
+, numDataSamples( 0 )
+, samplingRate( 0.0 )
+, impulseResponses()
+, delays()
+, listenerPosition()
+, sourcePosition()
+, receiverPosition()
+, emitterPosition()
+{
+    if( file.IsValid() == false )
+    {
+        SOFA_THROW( "invalid SOFA file : " + filename );
+    }
+
+    conventions = file.GetSOFAConventions();
+    file.GetGlobalAttributes( attributes );
+
+    numMeasurements = sofaLocal::toSize( file.GetNumMeasurements() );
+    numReceivers    = sofaLocal::toSize( file.GetNumReceivers() );
+    numEmitters     = sofaLocal::toSize( file.GetNumEmitters() );
+    numDataSamples  = sofaLocal::toSize( file.GetNumDataSamples() );
+
+    if( file.IsFIRDataType() == true || file.IsFIREDataType() == true )
+    {
+        if( sofaLocal::readVariable( impulseResponses, file, "Data.IR" ) == false )
+        {
+            SOFA_THROW( "invalid 'Data.IR' variable" );
+        }
+
+        if( sofaLocal::readVariable( delays, file, "Data.Delay" ) == false )
+        {
+            SOFA_THROW( "invalid 'Data.Delay' variable" );
+        }
+
+        std::vector< double > rates;
+
+        if( sofaLocal::readVariable( rates, file, "Data.SamplingRate" ) == false )
+        {
+            SOFA_THROW( "invalid 'Data.SamplingRate' variable" );
+        }
+
+        /// Data.SamplingRate is [ I ] or [ M ] : all measurements are assumed to share the first one
+        samplingRate = ( rates.empty() == false ) ? rates[0] : 0.0;
+    }
+
+    file.GetListenerPosition( listenerPosition.coordinates, listenerPosition.units );
+    file.GetSourcePosition( sourcePosition.coordinates, sourcePosition.units );
+    file.GetReceiverPosition( receiverPosition.coordinates, receiverPosition.units );
+    file.GetEmitterPosition( emitterPosition.coordinates, emitterPosition.units );
+
+    sofaLocal::readPosition( listenerPosition, file, "ListenerPosition" );
+    sofaLocal::readPosition( sourcePosition, file, "SourcePosition" );
+    sofaLocal::readPosition( receiverPosition, file, "ReceiverPosition" );
+    sofaLocal::readPosition( emitterPosition, file, "EmitterPosition" );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+Dataset::~Dataset()
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the path of the file the data was read from
+ *
+ */
+/************************************************************************************/
+const std::string & Dataset::GetFilename() const SOFA_NOEXCEPT
+{
+    return filename;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the SOFAConventions global attribute
+ *
+ */
+/************************************************************************************/
+const std::string & Dataset::GetSOFAConventions() const SOFA_NOEXCEPT
+{
+    return conventions;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the global attributes
+ *
+ */
+/************************************************************************************/
+const sofa::Attributes & Dataset::GetAttributes() const SOFA_NOEXCEPT
+{
+    return attributes;
+}
+
+std::size_t Dataset::GetNumMeasurements() const SOFA_NOEXCEPT
+{
+    return numMeasurements;
+}
+
+std::size_t Dataset::GetNumReceivers() const SOFA_NOEXCEPT
+{
+    return numReceivers;
+}
+
+std::size_t Dataset::GetNumEmitters() const SOFA_NOEXCEPT
+{
+    return numEmitters;
+}
+
+std::size_t Dataset::GetNumDataSamples() const SOFA_NOEXCEPT
+{
+    return numDataSamples;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the sampling rate (of the first measurement), or 0 if the
+ *                  data type has no sampling rate
+ *
+ */
+/************************************************************************************/
+double Dataset::GetSamplingRate() const SOFA_NOEXCEPT
+{
+    return samplingRate;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns all the Data.IR values : [ M R N ] or [ M R E N ]
+ *
+ */
+/************************************************************************************/
+const std::vector< double > & Dataset::GetDataIR() const SOFA_NOEXCEPT
+{
+    return impulseResponses;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the impulse response (N samples) of one measurement,
+ *                  for one receiver (and one emitter)
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]. Ignored if Data.IR is [ M R N ]
+ *  @return         NULL if the indices are out of range, or there is no Data.IR
+ *
+ */
+/************************************************************************************/
+const double * Dataset::GetDataIR(const std::size_t measurementIndex,
+                                  const std::size_t receiverIndex,
+                                  const std::size_t emitterIndex) const SOFA_NOEXCEPT
+{
+    if( measurementIndex >= numMeasurements || receiverIndex >= numReceivers || numDataSamples == 0 )
+    {
+        return NULL;
+    }
+
+    const std::size_t numResponses = impulseResponses.size() / numDataSamples;
+
+    std::size_t index = measurementIndex * numReceivers + receiverIndex;
+
+    if( numResponses == numMeasurements * numReceivers * numEmitters && numResponses != numMeasurements * numReceivers )
+    {
+        if( emitterIndex >= numEmitters )
+        {
+            return NULL;
+        }
+
+        index = index * numEmitters + emitterIndex;
+    }
+
+    if( index >= numResponses )
+    {
+        return NULL;
+    }
+
+    return &impulseResponses[ index * numDataSamples ];
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns all the Data.Delay values : [ I R ] or [ M R ]
+ *
+ */
+/************************************************************************************/
+const std::vector< double > & Dataset::GetDataDelay() const SOFA_NOEXCEPT
+{
+    return delays;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the delay of one measurement for one receiver,
+ *                  whether Data.Delay is [ I R ] or [ M R ]
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *
+ */
+/************************************************************************************/
+double Dataset::GetDataDelay(const std::size_t measurementIndex,
+                             const std::size_t receiverIndex) const SOFA_NOEXCEPT
+{
+    if( receiverIndex >= numReceivers )
+    {
+        return 0.0;
+    }
+
+    if( delays.size() == numMeasurements * numReceivers && measurementIndex < numMeasurements )
+    {
+        return delays[ measurementIndex * numReceivers + receiverIndex ];
+    }
+    else if( delays.size() == numReceivers )
+    {
+        return delays[ receiverIndex ];
+    }
+    else
+    {
+        return 0.0;
+    }
+}
+
+const sofa::Dataset::Position & Dataset::GetListenerPosition() const SOFA_NOEXCEPT
+{
+    return listenerPosition;
+}
+
+const sofa::Dataset::Position & Dataset::GetSourcePosition() const SOFA_NOEXCEPT
+{
+    return sourcePosition;
+}
+
+const sofa::Dataset::Position & Dataset::GetReceiverPosition() const SOFA_NOEXCEPT
+{
+    return receiverPosition;
+}
+
+const sofa::Dataset::Position & Dataset::GetEmitterPosition() const SOFA_NOEXCEPT
+{
+    return emitterPosition;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the (approximate) number of bytes used by the dataset
+ *
+ */
+/************************************************************************************/
+std::size_t Dataset::GetMemorySize() const SOFA_NOEXCEPT
+{
+    std::size_t size = sizeof( Dataset );
+
+    size += sofaLocal::memorySize( impulseResponses );
+    size += sofaLocal::memorySize( delays );
+
+    size += sofaLocal::memorySize( listenerPosition.values );
+    size += sofaLocal::memorySize( sourcePosition.values );
+    size += sofaLocal::memorySize( receiverPosition.values );
+    size += sofaLocal::memorySize( emitterPosition.values );
+
+    return size;
+}
@@ -0,0 +1,163 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFADataset.h
+ *   @brief      Immutable, fully decoded content of a SOFA file
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_DATASET_H__
+#define _SOFA_DATASET_H__
+
+#include "../src/SOFAAttributes.h"
+#include "../src/SOFACoordinates.h"
+#include "../src/SOFAUnits.h"
+#include <vector>
+#include <string>
+#include <cstddef>
+
+namespace sofa
+{
+    class File;
+
+    /************************************************************************************/
+    /*!
+     *  @class          Dataset
+     *  @brief          In-memory copy of the data of a SOFA file
+     *
+     *  @details        All the variables needed for rendering (Data.IR, Data.Delay, Data.SamplingRate,
+     *                  the Listener/Source/Receiver/Emitter positions and the global attributes)
+     *                  are read once, in the constructor; the file is not accessed afterwards.
+     *
+     *                  A Dataset is immutable : all its methods are const and it can be shared
+     *                  between threads without locking (see DatasetCache).
+     *
+     *                  Data.IR is only available for the FIR and FIRE data types;
+     *                  it is empty otherwise.
+     */
+    /************************************************************************************/
+    class SOFA_API Dataset
+    {
+    public:
+        /// values of a position variable, with its coordinates system and units
+        struct Position
+        {
+            Position()
+            : values()
+            , dimensions()
+            , coordinates( sofa::Coordinates::kCartesian )
+            , units( sofa::Units::kMeter )
+            {
+            }
+
+            std::vector< double > values;
+            std::vector< std::size_t > dimensions;
+            sofa::Coordinates::Type coordinates;
+            sofa::Units::Type units;
+        };
+
+    public:
+        explicit Dataset(const sofa::File &file);
+        ~Dataset();
+
+        const std::string & GetFilename() const SOFA_NOEXCEPT;
+        const std::string & GetSOFAConventions() const SOFA_NOEXCEPT;
+        const sofa::Attributes & GetAttributes() const SOFA_NOEXCEPT;
+
+        std::size_t GetNumMeasurements() const SOFA_NOEXCEPT;
+        std::size_t GetNumReceivers() const SOFA_NOEXCEPT;
+        std::size_t GetNumEmitters() const SOFA_NOEXCEPT;
+        std::size_t GetNumDataSamples() const SOFA_NOEXCEPT;
+
+        double GetSamplingRate() const SOFA_NOEXCEPT;
+
+        //==============================================================================
+        const std::vector< double > & GetDataIR() const SOFA_NOEXCEPT;
+
+        const double * GetDataIR(const std::size_t measurementIndex,
+                                 const std::size_t receiverIndex,
+                                 const std::size_t emitterIndex = 0) const SOFA_NOEXCEPT;
+
+        const std::vector< double > & GetDataDelay() const SOFA_NOEXCEPT;
+
+        double GetDataDelay(const std::size_t measurementIndex,
+                            const std::size_t receiverIndex) const SOFA_NOEXCEPT;
+
+        //==============================================================================
+        const Position & GetListenerPosition() const SOFA_NOEXCEPT;
+        const Position & GetSourcePosition() const SOFA_NOEXCEPT;
+        const Position & GetReceiverPosition() const SOFA_NOEXCEPT;
+        const Position & GetEmitterPosition() const SOFA_NOEXCEPT;
+
+        //==============================================================================
+        std::size_t GetMemorySize() const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        std::string filename;
+        std::string conventions;
+        sofa::Attributes attributes;
+
+        std::size_t numMeasurements;                ///< M
+        std::size_t numReceivers;                   ///< R
+        std::size_t numEmitters;                    ///< E
+        std::size_t numDataSamples;                 ///< N
+
+        double samplingRate;
+
+        std::vector< double > impulseResponses;     ///< Data.IR [ M R N ] or [ M R E N ]
+        std::vector< double > delays;               ///< Data.Delay [ I R ] or [ M R ]
+
+        Position listenerPosition;
+        Position sourcePosition;
+        Position receiverPosition;
+        Position emitterPosition;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( Dataset );
+    };
+
+}
+
+#endif /* _SOFA_DATASET_H__ */
@@ -0,0 +1,442 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFADatasetCache.cpp
+ *   @brief      Process-wide cache of decoded SOFA datasets
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFADatasetCache.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAFile.h"
+#include "../src/SOFAGeneralFIR.h"
+#include "../src/SOFAGeneralFIRE.h"
+#include "../src/SOFAGeneralTF.h"
+#include "../src/SOFAMultiSpeakerBRIR.h"
+#include "../src/SOFASimpleFreeFieldHRIR.h"
+#include "../src/SOFASimpleFreeFieldSOS.h"
+#include "../src/SOFASimpleHeadphoneIR.h"
+#include "../src/SOFASingleRoomDRIR.h"
+#include "../src/SOFACacheFile.h"
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    static sofa::File * openFile(const std::string &path, const std::string &convention)
+    {
+        if( convention.empty() == true )                    { return new sofa::File( path ); }
+        else if( convention == "GeneralFIR" )               { return new sofa::GeneralFIR( path ); }
+        else if( convention == "GeneralFIRE" )              { return new sofa::GeneralFIRE( path ); }
+        else if( convention == "GeneralTF" )                { return new sofa::GeneralTF( path ); }
+        else if( convention == "MultiSpeakerBRIR" )         { return new sofa::MultiSpeakerBRIR( path ); }
+        else if( convention == "SimpleFreeFieldHRIR" )      { return new sofa::SimpleFreeFieldHRIR( path ); }
+        else if( convention == "SimpleFreeFieldSOS" )       { return new sofa::SimpleFreeFieldSOS( path ); }
+        else if( convention == "SimpleHeadphoneIR" )        { return new sofa::SimpleHeadphoneIR( path ); }
+        else if( convention == "SingleRoomDRIR" )           { return new sofa::SingleRoomDRIR( path ); }
+        else
+        {
+            SOFA_THROW( "unknown convention : " + convention );
+            return NULL;
+        }
+    }
+
+    static sofa::DatasetCache::DatasetPtr loadDataset(const std::string &path, const std::string &convention)
+    {
+        /// the netCDF library is not thread-safe : the files are read one at a time
+        std::lock_guard< std::recursive_mutex > lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+        const std::unique_ptr< sofa::File > file( openFile( path, convention ) );
+
+        if( file->IsValid() == false )
+        {
+            SOFA_THROW( "invalid SOFA file : " + path );
+        }
+
+        return std::make_shared< const sofa::Dataset >( *file );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Orders the keys by path, convention, size and modification time
+ *
+ */
+/************************************************************************************/
+bool DatasetCache::Key::operator< (const Key &other) const SOFA_NOEXCEPT
+{
+    if( path != other.path )
+    {
+        return path < other.path;
+    }
+
+    if( convention != other.convention )
+    {
+        return convention < other.convention;
+    }
+
+    if( fileSize != other.fileSize )
+    {
+        return fileSize < other.fileSize;
+    }
+
+    return modificationTime < other.modificationTime;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the cache shared by the whole process (without memory budget
+ *                  until SetMemoryBudget() is called)
+ *
+ */
+/************************************************************************************/
+sofa::DatasetCache & DatasetCache::GetInstance()
+{
+    static sofa::DatasetCache instance;
+    return instance;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor
+ *  @param[in]      memoryBudget : maximum size of the cached datasets, in bytes (0 for no limit)
+ *
+ */
+/************************************************************************************/
+DatasetCache::DatasetCache(const std::size_t memoryBudget_)
+: mutex()
+, entries()
+, memoryBudget( memoryBudget_ )
+, memoryUsage( 0 )
+, numRequests( 0 )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor. The datasets still held by clients remain valid
+ *
+ */
+/************************************************************************************/
+DatasetCache::~DatasetCache()
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the dataset of a SOFA file, reading the file only if it is
+ *                  not already in memory (or if it has been modified)
+ *  @param[in]      path : path of the SOFA file
+ *  @param[in]      convention : name of the convention the file shall comply with
+ *                  (e.g. "SimpleFreeFieldHRIR"), or empty for any valid SOFA file
+ *
+ *  @details        Throws an exception if the file can not be accessed, is not valid
+ *                  or does not comply with the convention
+ */
+/************************************************************************************/
+sofa::DatasetCache::DatasetPtr DatasetCache::Get(const std::string &path,
+                                                 const std::string &convention)
+{
+    Key key;
+    key.path        = path;
+    key.convention  = convention;
+
+    if( sofa::CacheFile::GetFileStatus( key.fileSize, key.modificationTime, path ) == false )
+    {
+        SOFA_THROW( "cannot access file : " + path );
+    }
+
+    std::unique_lock< std::mutex > lock( mutex );
+
+    Entries::iterator it = entries.find( key );
+
+    if( it != entries.end() )
+    {
+        Entry &entry = it->second;
+
+        if( entry.loading.valid() == true )
+        {
+            /// another client is reading the file : wait for it
+            const std::shared_future< DatasetPtr > loading = entry.loading;
+
+            lock.unlock();
+
+            return loading.get();
+        }
+
+        if( entry.dataset == nullptr )
+        {
+            /// released by the cache, but maybe still held by a client
+            entry.dataset = entry.shared.lock();
+
+            if( entry.dataset != nullptr )
+            {
+                memoryUsage += entry.memorySize;
+            }
+        }
+
+        if( entry.dataset != nullptr )
+        {
+            touch( entry );
+
+            const DatasetPtr dataset = entry.dataset;
+
+            evict( key );
+
+            return dataset;
+        }
+
+        entries.erase( it );
+    }
+
+    /// the older versions of the file are not requested anymore
+    for( it = entries.begin(); it != entries.end(); )
+    {
+        const bool isOutdated = ( it->first.path == key.path
+                                 && it->first.convention == key.convention
+                                 && it->second.loading.valid() == false );
+
+        if( isOutdated == true || ( it->second.dataset == nullptr && it->second.shared.expired() == true ) )
+        {
+            if( it->second.dataset != nullptr )
+            {
+                memoryUsage -= it->second.memorySize;
+            }
+
+            it = entries.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    std::promise< DatasetPtr > promise;
+
+    Entry &entry = entries[ key ];
+    entry.loading       = promise.get_future().share();
+    entry.memorySize    = 0;
+    entry.lastRequest   = 0;
+
+    lock.unlock();
+
+    DatasetPtr dataset;
+
+    try
+    {
+        dataset = sofaLocal::loadDataset( path, convention );
+    }
+    catch( ... )
+    {
+        lock.lock();
+        entries.erase( key );
+        lock.unlock();
+
+        promise.set_exception( std::current_exception() );
+        throw;
+    }
+
+    lock.lock();
+
+    it = entries.find( key );
+
+    /// the entry may have been removed by Clear() meanwhile
+    if( it != entries.end() )
+    {
+        it->second.loading      = std::shared_future< DatasetPtr >();
+        it->second.dataset      = dataset;
+        it->second.shared       = dataset;
+        it->second.memorySize   = dataset->GetMemorySize();
+
+        memoryUsage += it->second.memorySize;
+
+        touch( it->second );
+        evict( key );
+    }
+
+    lock.unlock();
+
+    promise.set_value( dataset );
+
+    return dataset;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Sets the maximum size of the cached datasets, in bytes (0 for no limit)
+ *
+ *  @details        The dataset returned by Get() is always kept by the cache, even if it
+ *                  exceeds the budget on its own
+ */
+/************************************************************************************/
+void DatasetCache::SetMemoryBudget(const std::size_t memoryBudget_)
+{
+    std::lock_guard< std::mutex > lock( mutex );
+
+    memoryBudget = memoryBudget_;
+
+    evict( Key() );
+}
+
+std::size_t DatasetCache::GetMemoryBudget() const
+{
+    std::lock_guard< std::mutex > lock( mutex );
+
+    return memoryBudget;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the total size of the datasets held by the cache, in bytes
+ *
+ */
+/************************************************************************************/
+std::size_t DatasetCache::GetMemoryUsage() const
+{
+    std::lock_guard< std::mutex > lock( mutex );
+
+    return memoryUsage;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of datasets held by the cache
+ *
+ */
+/************************************************************************************/
+std::size_t DatasetCache::GetNumDatasets() const
+{
+    std::lock_guard< std::mutex > lock( mutex );
+
+    std::size_t numDatasets = 0;
+
+    for( Entries::const_iterator it = entries.begin(); it != entries.end(); ++it )
+    {
+        if( it->second.dataset != nullptr )
+        {
+            numDatasets++;
+        }
+    }
+
+    return numDatasets;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Releases all the datasets. The datasets still held by clients remain valid
+ *
+ */
+/************************************************************************************/
+void DatasetCache::Clear()
+{
+    std::lock_guard< std::mutex > lock( mutex );
+
+    /// the entries being loaded are kept, so that the pending requests are shared
+    for( Entries::iterator it = entries.begin(); it != entries.end(); )
+    {
+        if( it->second.loading.valid() == false )
+        {
+            it = entries.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    memoryUsage = 0;
+}
+
+void DatasetCache::touch(Entry &entry)
+{
+    entry.lastRequest = ++numRequests;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Releases the least recently requested datasets, until the memory usage
+ *                  fits in the budget
+ *  @param[in]      requested : key of the dataset being returned, which is never released
+ *
+ *  @details        The mutex shall be locked by the caller
+ */
+/************************************************************************************/
+void DatasetCache::evict(const Key &requested)
+{
+    if( memoryBudget == 0 )
+    {
+        return;
+    }
+
+    while( memoryUsage > memoryBudget )
+    {
+        Entries::iterator oldest = entries.end();
+
+        for( Entries::iterator it = entries.begin(); it != entries.end(); ++it )
+        {
+            const bool isRequested = ( it->first < requested ) == false && ( requested < it->first ) == false;
+
+            if( it->second.dataset == nullptr || isRequested == true )
+            {
+                continue;
+            }
+
+            if( oldest == entries.end() || it->second.lastRequest < oldest->second.lastRequest )
+            {
+                oldest = it;
+            }
+        }
+
+        if( oldest == entries.end() )
+        {
+            return;
+        }
+
+        memoryUsage -= oldest->second.memorySize;
+        oldest->second.dataset.reset();
+
+        if( oldest->second.shared.expired() == true )
+        {
+            entries.erase( oldest );
+        }
+    }
+}
@@ -0,0 +1,149 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFADatasetCache.h
+ *   @brief      Process-wide cache of decoded SOFA datasets
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_DATASET_CACHE_H__
+#define _SOFA_DATASET_CACHE_H__
+
+#include "../src/SOFADataset.h"
+#include <memory>
+#include <mutex>
+#include <future>
+#include <map>
+
+namespace sofa
+{
+
+    /************************************************************************************/
+    /*!
+     *  @class          DatasetCache
+     *  @brief          Shares the decoded datasets of SOFA files between all the clients of a process
+     *
+     *  @details        A dataset is identified by the path of the file, its size, its modification
+     *                  time (in nanoseconds, where the file system provides it) and the requested
+     *                  convention : when the file is modified on disk, the next request reloads it.
+     *
+     *                  The datasets are immutable and reference-counted (std::shared_ptr) :
+     *                  all the clients requesting the same file share one copy in memory.
+     *
+     *                  When the total size of the cached datasets exceeds the memory budget,
+     *                  the least recently requested ones are released by the cache.
+     *                  A released dataset stays alive as long as a client holds it,
+     *                  and is handed out again (without reloading) if it is requested meanwhile.
+     *
+     *                  All the methods are thread-safe. Concurrent requests for the same file
+     *                  wait for a single load; the files are read one at a time,
+     *                  as the netCDF library is not thread-safe.
+     */
+    /************************************************************************************/
+    class SOFA_API DatasetCache
+    {
+    public:
+        typedef std::shared_ptr< const sofa::Dataset > DatasetPtr;
+
+    public:
+        static sofa::DatasetCache & GetInstance();
+
+        DatasetCache(const std::size_t memoryBudget = 0);
+        ~DatasetCache();
+
+        DatasetPtr Get(const std::string &path,
+                       const std::string &convention = "");
+
+        void SetMemoryBudget(const std::size_t memoryBudget);
+        std::size_t GetMemoryBudget() const;
+        std::size_t GetMemoryUsage() const;
+
+        std::size_t GetNumDatasets() const;
+
+        void Clear();
+
+    private:
+        //==============================================================================
+        struct Key
+        {
+            Key() : path(), convention(), fileSize( 0 ), modificationTime( 0 ) {}
+
+            std::string path;
+            std::string convention;
+            long long fileSize;
+            long long modificationTime;             ///< in nanoseconds
+
+            bool operator< (const Key &other) const SOFA_NOEXCEPT;
+        };
+
+        struct Entry
+        {
+            std::shared_future< DatasetPtr > loading;   ///< valid while the file is being read
+            DatasetPtr dataset;                         ///< null once released by the cache
+            std::weak_ptr< const sofa::Dataset > shared;
+            std::size_t memorySize;
+            unsigned long long lastRequest;
+        };
+
+        typedef std::map< Key, Entry > Entries;
+
+        void touch(Entry &entry);
+        void evict(const Key &requested);
+
+    private:
+        //==============================================================================
+        mutable std::mutex mutex;
+        Entries entries;
+
+        std::size_t memoryBudget;               ///< in bytes, 0 for no limit
+        std::size_t memoryUsage;                ///< size of the datasets held by the cache
+        unsigned long long numRequests;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( DatasetCache );
+    };
+
+}
+
+#endif /* _SOFA_DATASET_CACHE_H__ */
@@ -0,0 +1,326 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFADirectionLookupTable.cpp
+ *   @brief      Constant-time lookup of the measurement closest to a direction
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFADirectionLookupTable.h"
+#include "../src/SOFASourcePositionIndex.h"
+#include "../src/SOFAListenerRotation.h"
+#include "../src/SOFAFile.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAUtils.h"
+#include <cmath>
+
+using namespace sofa;
+
+/************************************************************************************/
+/*!
+ *  @brief          Default options : 1 degree cells, at most 1 MB
+ *
+ */
+/************************************************************************************/
+DirectionLookupTable::Options::Options()
+: resolution( 1.0 )
+, maxMemorySize( 1024 * 1024 )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the table from the SourcePosition variable of a file
+ *  @param[in]      file : a valid SOFA file (e.g. SimpleFreeFieldHRIR)
+ *  @param[in]      options : resolution and maximum memory of the table
+ *
+ *  @details        As for SourcePositionIndex, the positions are rotated into the listener's frame
+ *                  (ListenerView, ListenerUp). Throws an exception if the SourcePosition variable
+ *                  cannot be read, or if the options are invalid
+ */
+/************************************************************************************/
+DirectionLookupTable::DirectionLookupTable(const sofa::File &file,
+                                           const Options &options)
+: numPositions( 0 )
+, numAzimuths( 0 )
+, numElevations( 0 )
+, azimuthScale( 0.0 )
+, elevationScale( 0.0 )
+, shortTable()
+, longTable()
+{
+    const sofa::SourcePositionIndex index( file, sofa::SourcePositionIndex::kAngular );
+
+    build( index, options );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the table from an array of positions
+ *  @param[in]      positions : interleaved positions, e.g. [ az el r az el r ... ]
+ *  @param[in]      numPositions : number of positions (the array holds 3 x numPositions values)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @param[in]      options : resolution and maximum memory of the table
+ *
+ */
+/************************************************************************************/
+DirectionLookupTable::DirectionLookupTable(const double *positions,
+                                           const std::size_t numPositions_,
+                                           const sofa::Coordinates::Type coordinates,
+                                           const Options &options)
+: numPositions( 0 )
+, numAzimuths( 0 )
+, numElevations( 0 )
+, azimuthScale( 0.0 )
+, elevationScale( 0.0 )
+, shortTable()
+, longTable()
+{
+    const sofa::SourcePositionIndex index( positions, numPositions_, coordinates, sofa::SourcePositionIndex::kAngular );
+
+    build( index, options );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+DirectionLookupTable::~DirectionLookupTable()
+{
+}
+
+void DirectionLookupTable::build(const sofa::SourcePositionIndex &index,
+                                 const Options &options)
+{
+    const std::size_t numPositions_ = index.GetNumPositions();
+
+    if( numPositions_ == 0 )
+    {
+        SOFA_THROW( "no position" );
+    }
+
+    if( ( options.resolution > 0.0 && options.resolution <= 180.0 ) == false )
+    {
+        SOFA_THROW( "invalid resolution (should be in ]0 180] degree)" );
+    }
+
+    const bool useShortTable        = ( numPositions_ <= 65536 );
+    const std::size_t entrySize     = useShortTable == true ? sizeof( std::uint16_t ) : sizeof( std::uint32_t );
+
+    /// smallest table : 4 azimuths x 3 elevations
+    if( options.maxMemorySize < 4 * 3 * entrySize )
+    {
+        SOFA_THROW( "the maximum memory size is too small" );
+    }
+
+    /// the resolution is made coarser until the table fits in memory
+    double resolution = options.resolution;
+
+    for( ;; )
+    {
+        numAzimuths     = sofa::smax( (std::size_t) 4, (std::size_t) std::ceil( 360.0 / resolution ) );
+        numElevations   = sofa::smax( (std::size_t) 3, (std::size_t) std::ceil( 180.0 / resolution ) + 1 );
+
+        if( numAzimuths * numElevations * entrySize <= options.maxMemorySize )
+        {
+            break;
+        }
+
+        resolution *= 1.01;
+    }
+
+    numPositions    = numPositions_;
+    azimuthScale    = (double) numAzimuths / 360.0;
+    elevationScale  = (double) ( numElevations - 1 ) / 180.0;
+
+    const std::size_t numCells = numAzimuths * numElevations;
+
+    if( useShortTable == true )
+    {
+        shortTable.resize( numCells );
+    }
+    else
+    {
+        longTable.resize( numCells );
+    }
+
+    for( std::size_t j = 0; j < numElevations; j++ )
+    {
+        const double elevation = -90.0 + (double) j / elevationScale;
+
+        for( std::size_t i = 0; i < numAzimuths; i++ )
+        {
+            const double azimuth = (double) i / azimuthScale;
+
+            std::size_t nearest = 0;
+            index.FindNearest( nearest, azimuth, elevation, 1.0, sofa::Coordinates::kSpherical );
+
+            if( useShortTable == true )
+            {
+                shortTable[ j * numAzimuths + i ] = (std::uint16_t) nearest;
+            }
+            else
+            {
+                longTable[ j * numAzimuths + i ] = (std::uint32_t) nearest;
+            }
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of positions in the table (i.e. M)
+ *
+ */
+/************************************************************************************/
+std::size_t DirectionLookupTable::GetNumPositions() const SOFA_NOEXCEPT
+{
+    return numPositions;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the size of the cells along the azimuth, in degree
+ *                  (at least the requested resolution)
+ *
+ */
+/************************************************************************************/
+double DirectionLookupTable::GetAzimuthResolution() const SOFA_NOEXCEPT
+{
+    return 1.0 / azimuthScale;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the size of the cells along the elevation, in degree
+ *                  (at least the requested resolution)
+ *
+ */
+/************************************************************************************/
+double DirectionLookupTable::GetElevationResolution() const SOFA_NOEXCEPT
+{
+    return 1.0 / elevationScale;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the size of the table, in bytes
+ *
+ */
+/************************************************************************************/
+std::size_t DirectionLookupTable::GetMemorySize() const SOFA_NOEXCEPT
+{
+    return shortTable.size() * sizeof( std::uint16_t ) + longTable.size() * sizeof( std::uint32_t );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the index of the cell containing a direction
+ *
+ */
+/************************************************************************************/
+std::size_t DirectionLookupTable::getCell(const double azimuth, const double elevation) const SOFA_NOEXCEPT
+{
+    const double numAz = (double) numAzimuths;
+
+    /// any azimuth is wrapped to [0 360[
+    double a = azimuth * azimuthScale;
+    a -= numAz * std::floor( a / numAz );
+
+    std::size_t i = ( a >= 0.0 && a < numAz ) ? (std::size_t) ( a + 0.5 ) : 0;
+    if( i >= numAzimuths )
+    {
+        i = 0;
+    }
+
+    /// the elevation is clipped to [-90 90]
+    const double e = ( elevation + 90.0 ) * elevationScale;
+    const double maxE = (double) ( numElevations - 1 );
+
+    const std::size_t j = ( e > 0.0 ) ? (std::size_t) ( sofa::smin( e, maxE ) + 0.5 ) : 0;
+
+    return j * numAzimuths + i;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the measurement closest to a direction
+ *  @param[in]      azimuth : azimuth in degree (any value)
+ *  @param[in]      elevation : elevation in degree (clipped to [-90 90])
+ *  @return         the index of the measurement, in [0 M-1]
+ *
+ */
+/************************************************************************************/
+std::size_t DirectionLookupTable::Lookup(const double azimuth,
+                                         const double elevation) const SOFA_NOEXCEPT
+{
+    const std::size_t cell = getCell( azimuth, elevation );
+
+    return ( shortTable.empty() == false ) ? shortTable[ cell ] : longTable[ cell ];
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the measurement closest to a direction, for a rotated listener
+ *  @param[in]      azimuth : azimuth in degree, in the coordinate system of the head tracker
+ *  @param[in]      elevation : elevation in degree, in the coordinate system of the head tracker
+ *  @param[in]      rotation : orientation of the listener's head, in the coordinate system of the head tracker
+ *  @return         the index of the measurement, in [0 M-1]
+ *
+ */
+/************************************************************************************/
+std::size_t DirectionLookupTable::Lookup(const double azimuth,
+                                         const double elevation,
+                                         const sofa::ListenerRotation &rotation) const SOFA_NOEXCEPT
+{
+    double direction[3];
+    sofa::SphericalToCartesian( direction, azimuth, elevation, 1.0 );
+
+    rotation.ToListenerFrame( direction );
+
+    const double rho = std::sqrt( direction[0] * direction[0] + direction[1] * direction[1] );
+
+    return Lookup( sofa::RadiansToDegrees( std::atan2( direction[1], direction[0] ) ),
+                   sofa::RadiansToDegrees( std::atan2( direction[2], rho ) ) );
+}
@@ -0,0 +1,151 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFADirectionLookupTable.h
+ *   @brief      Constant-time lookup of the measurement closest to a direction
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_DIRECTION_LOOKUP_TABLE_H__
+#define _SOFA_DIRECTION_LOOKUP_TABLE_H__
+
+#include "../src/SOFACoordinates.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace sofa
+{
+    class File;
+    class ListenerRotation;
+    class SourcePositionIndex;
+
+    /************************************************************************************/
+    /*!
+     *  @class          DirectionLookupTable
+     *  @brief          Maps a direction (azimuth, elevation) to the closest measurement
+     *                  with a single array read
+     *
+     *  @details        The sphere is divided in a regular grid of azimuth x elevation cells;
+     *                  for each cell, the table stores the index of the measurement whose direction
+     *                  is the closest (great-circle angle) to the centre of the cell. The table
+     *                  is computed once, in the constructor, with a SourcePositionIndex : as for the
+     *                  index, the directions are relative to the listener's head.
+     *
+     *                  A lookup returns the measurement closest to the centre of the cell containing
+     *                  the direction : it may differ from the true nearest measurement for directions
+     *                  within half a cell of the boundary between two measurements. With a regular
+     *                  measurement grid and a resolution finer than its spacing, this does not happen
+     *                  away from the boundaries.
+     *
+     *                  The memory of the table is bounded by Options::maxMemorySize : if the requested
+     *                  resolution needs more memory, the resolution is made coarser
+     *                  (see GetAzimuthResolution() and GetElevationResolution()).
+     *
+     *                  The lookups are const, do not allocate memory and can be called from an
+     *                  audio callback (and from several threads).
+     */
+    /************************************************************************************/
+    class SOFA_API DirectionLookupTable
+    {
+    public:
+        /// size of the table
+        struct Options
+        {
+            Options();
+
+            double resolution;                  ///< requested size of a cell, in degree (default 1)
+            std::size_t maxMemorySize;          ///< maximum size of the table, in bytes (default 1 MB)
+        };
+
+    public:
+        DirectionLookupTable(const sofa::File &file,
+                             const Options &options = Options());
+
+        DirectionLookupTable(const double *positions,
+                             const std::size_t numPositions,
+                             const sofa::Coordinates::Type coordinates,
+                             const Options &options = Options());
+
+        ~DirectionLookupTable();
+
+        std::size_t GetNumPositions() const SOFA_NOEXCEPT;
+
+        double GetAzimuthResolution() const SOFA_NOEXCEPT;
+        double GetElevationResolution() const SOFA_NOEXCEPT;
+
+        std::size_t GetMemorySize() const SOFA_NOEXCEPT;
+
+        std::size_t Lookup(const double azimuth,
+                           const double elevation) const SOFA_NOEXCEPT;
+
+        std::size_t Lookup(const double azimuth,
+                           const double elevation,
+                           const sofa::ListenerRotation &rotation) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        void build(const sofa::SourcePositionIndex &index,
+                   const Options &options);
+
+        std::size_t getCell(const double azimuth, const double elevation) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        std::size_t numPositions;                   ///< M
+        std::size_t numAzimuths;                    ///< number of cells along the azimuth
+        std::size_t numElevations;                  ///< number of cells along the elevation (poles included)
+        double azimuthScale;                        ///< cells per degree
+        double elevationScale;                      ///< cells per degree
+
+        std::vector< std::uint16_t > shortTable;    ///< [ numElevations numAzimuths ], if M <= 65536
+        std::vector< std::uint32_t > longTable;     ///< [ numElevations numAzimuths ], otherwise
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( DirectionLookupTable );
+    };
+
+}
+
+#endif /* _SOFA_DIRECTION_LOOKUP_TABLE_H__ */
@@ -48,29 +48,67 @@ http://www.sofaconventions.org
 /************************************************************************************/
 #include "../src/SOFAExceptions.h"
 #include <iostream>
+#include <atomic>
 
 using namespace sofa;
 
-/// specify whether raised exception prints something to cerr or not...
-/// use this with care
-bool sofa::Exception::logToCerr = true;
+namespace sofaLocal
+{
+    /// specify whether raised exception prints something to cerr or not...
+    /// use this with care
+    static std::atomic< bool > logToCerr( true );
+    
+    /// overrides logToCerr in the current thread (-1 : no override)
+    static thread_local int threadLogToCerr = -1;
+}
 
 /************************************************************************************/
 /*!
  *  @brief          Enables or disables the logging of sofa::Exception on the standard error.
  *                  Use this with great care !
- *                  This affects globaly all sofa exceptions
+ *                  This affects globaly all sofa exceptions, in all the threads
+ *                  (except in the scope of a ScopedLogToCerr)
  *
  */
 /************************************************************************************/
 void sofa::Exception::LogToCerr(const bool value)
 {
-    sofa::Exception::logToCerr = value;
+    sofaLocal::logToCerr = value;
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if the exceptions raised in the calling thread are logged
+ *
+ */
+/************************************************************************************/
 bool sofa::Exception::IsLoggedToCerr()
 {
-    return sofa::Exception::logToCerr;
+    if( sofaLocal::threadLogToCerr >= 0 )
+    {
+        return ( sofaLocal::threadLogToCerr == 1 );
+    }
+    
+    return sofaLocal::logToCerr;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Enables or disables the logging in the calling thread, until the object
+ *                  is destroyed (the former state of the thread is then restored).
+ *                  The other threads are not affected
+ *
+ */
+/************************************************************************************/
+sofa::Exception::ScopedLogToCerr::ScopedLogToCerr(const bool value)
+: previousValue( sofaLocal::threadLogToCerr )
+{
+    sofaLocal::threadLogToCerr = ( value == true ) ? 1 : 0;
+}
+
+sofa::Exception::ScopedLogToCerr::~ScopedLogToCerr()
+{
+    sofaLocal::threadLogToCerr = previousValue;
 }
 
 /************************************************************************************/
@@ -90,7 +128,7 @@ Exception::Exception(const std::string &text,
 , line( line_ )
 {
 
-    if( sofa::Exception::logToCerr == true )
+    if( sofa::Exception::IsLoggedToCerr() == true )
     {
         std::cerr << "Exception occured (in file " << Exception::getFileName( file ) << " at line " << line << ") : " << std::endl;
         std::cerr << "        " << description << std::endl;
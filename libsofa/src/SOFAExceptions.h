@@ -68,6 +68,19 @@ namespace sofa
         static void LogToCerr(const bool value);
         static bool IsLoggedToCerr();
         
+        /// enables or disables the logging in the calling thread only, until destruction
+        class SOFA_API ScopedLogToCerr
+        {
+        public:
+            explicit ScopedLogToCerr(const bool value);
+            ~ScopedLogToCerr();
+            
+        private:
+            const int previousValue;
+            
+            SOFA_AVOID_COPY_CONSTRUCTOR( ScopedLogToCerr );
+        };
+        
     public:
         Exception(const std::string &text    = "unknown exception",
                   const std::string &file    = "",
@@ -83,8 +96,6 @@ namespace sofa
     private:
         static std::string getFileName(const std::string & fullfilename);
         
-        static bool logToCerr;
-        
     private:
         const std::string filename;            ///< name of the file where the exception occured
         const std::string description;        ///< description of the exception
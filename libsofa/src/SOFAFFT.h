@@ -0,0 +1,249 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAFFT.h
+ *   @brief      Real-valued Fast Fourier Transform
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_FFT_H__
+#define _SOFA_FFT_H__
+
+#include "../src/SOFAPlatform.h"
+#include <vector>
+#include <complex>
+#include <cmath>
+#include <cstddef>
+
+namespace sofa
+{
+
+    /************************************************************************************/
+    /*!
+     *  @class          FFT
+     *  @brief          Radix-2 FFT of a real-valued signal
+     *
+     *  @details        The size must be a power of 2. The transform of a real signal of
+     *                  size N is computed with a complex FFT of size N/2; only the N/2+1
+     *                  non-redundant bins are stored.
+     *
+     *                  All the tables (twiddle factors, bit reversal, work buffer) are allocated
+     *                  in the constructor : Forward() and Inverse() do not allocate memory.
+     *                  Because of the internal work buffer, one FFT object should not be
+     *                  used by several threads simultaneously.
+     */
+    /************************************************************************************/
+    template< typename Type >
+    class FFT
+    {
+    public:
+        typedef std::complex< Type > Complex;
+
+    public:
+        /************************************************************************************/
+        /*!
+         *  @brief          Class constructor
+         *  @param[in]      size : size of the transform (power of 2, at least 2)
+         *
+         */
+        /************************************************************************************/
+        explicit FFT(const std::size_t size_)
+        : size( size_ )
+        , half( size_ / 2 )
+        , twiddles( size_ / 2 )
+        , realTwiddles( size_ / 2 + 1 )
+        , bitReverse( size_ / 2 )
+        , work( size_ / 2 )
+        {
+            SOFA_ASSERT( size >= 2 && ( size & ( size - 1 ) ) == 0 );
+
+            const double pi = 3.14159265358979323846;
+
+            for( std::size_t k = 0; k < half; k++ )
+            {
+                const double phase = -2.0 * pi * (double) k / (double) half;
+                twiddles[k] = Complex( (Type) std::cos( phase ), (Type) std::sin( phase ) );
+            }
+
+            for( std::size_t k = 0; k <= half; k++ )
+            {
+                const double phase = -2.0 * pi * (double) k / (double) size;
+                realTwiddles[k] = Complex( (Type) std::cos( phase ), (Type) std::sin( phase ) );
+            }
+
+            std::size_t numBits = 0;
+            while( ( (std::size_t) 1 << numBits ) < half )
+            {
+                numBits++;
+            }
+
+            for( std::size_t k = 0; k < half; k++ )
+            {
+                std::size_t reversed = 0;
+                for( std::size_t b = 0; b < numBits; b++ )
+                {
+                    if( ( k >> b ) & 1 )
+                    {
+                        reversed |= (std::size_t) 1 << ( numBits - 1 - b );
+                    }
+                }
+                bitReverse[k] = reversed;
+            }
+        }
+
+        ~FFT() {};
+
+        /// size of the transform
+        std::size_t GetSize() const SOFA_NOEXCEPT { return size; }
+
+        /// number of bins of the transform of a real signal (size/2 + 1)
+        std::size_t GetNumBins() const SOFA_NOEXCEPT { return half + 1; }
+
+        /************************************************************************************/
+        /*!
+         *  @brief          Forward transform
+         *  @param[in]      input : real signal (size samples)
+         *  @param[out]     output : spectrum (size/2 + 1 bins)
+         *
+         */
+        /************************************************************************************/
+        void Forward(const Type *input, Complex *output) SOFA_NOEXCEPT
+        {
+            for( std::size_t n = 0; n < half; n++ )
+            {
+                work[ bitReverse[n] ] = Complex( input[ 2 * n ], input[ 2 * n + 1 ] );
+            }
+
+            transform();
+
+            const Type one_half = (Type) 0.5;
+
+            for( std::size_t k = 0; k <= half; k++ )
+            {
+                const Complex a = work[ k % half ];
+                const Complex b = std::conj( work[ ( half - k ) % half ] );
+
+                const Complex even = ( a + b ) * one_half;
+                const Complex odd  = ( a - b ) * Complex( 0, -one_half );
+
+                output[k] = even + realTwiddles[k] * odd;
+            }
+        }
+
+        /************************************************************************************/
+        /*!
+         *  @brief          Inverse transform (including the 1/size normalization)
+         *  @param[in]      input : spectrum (size/2 + 1 bins)
+         *  @param[out]     output : real signal (size samples)
+         *
+         */
+        /************************************************************************************/
+        void Inverse(const Complex *input, Type *output) SOFA_NOEXCEPT
+        {
+            const Type one_half = (Type) 0.5;
+
+            for( std::size_t k = 0; k < half; k++ )
+            {
+                const Complex a = input[k];
+                const Complex b = std::conj( input[ half - k ] );
+
+                const Complex even = ( a + b ) * one_half;
+                const Complex odd  = ( a - b ) * std::conj( realTwiddles[k] ) * one_half;
+
+                /// the conjugate trick allows to use the forward transform
+                work[ bitReverse[k] ] = std::conj( even + Complex( 0, 1 ) * odd );
+            }
+
+            transform();
+
+            const Type scale = (Type) 1 / (Type) half;
+
+            for( std::size_t n = 0; n < half; n++ )
+            {
+                const Complex z = std::conj( work[n] ) * scale;
+
+                output[ 2 * n ]     = z.real();
+                output[ 2 * n + 1 ] = z.imag();
+            }
+        }
+
+    private:
+        //==============================================================================
+        /// in-place iterative radix-2 transform of the (bit-reversed) work buffer
+        void transform() SOFA_NOEXCEPT
+        {
+            for( std::size_t length = 2; length <= half; length <<= 1 )
+            {
+                const std::size_t step = half / length;
+
+                for( std::size_t start = 0; start < half; start += length )
+                {
+                    for( std::size_t k = 0; k < length / 2; k++ )
+                    {
+                        const Complex t = twiddles[ k * step ] * work[ start + k + length / 2 ];
+                        const Complex u = work[ start + k ];
+
+                        work[ start + k ]              = u + t;
+                        work[ start + k + length / 2 ] = u - t;
+                    }
+                }
+            }
+        }
+
+    private:
+        //==============================================================================
+        const std::size_t size;                     ///< size of the real transform
+        const std::size_t half;                     ///< size of the complex transform
+        std::vector< Complex > twiddles;            ///< twiddle factors of the complex transform
+        std::vector< Complex > realTwiddles;        ///< twiddle factors for the real/complex split
+        std::vector< std::size_t > bitReverse;      ///< bit reversal permutation
+        std::vector< Complex > work;                ///< work buffer
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( FFT );
+    };
+
+}
+
+#endif /* _SOFA_FFT_H__ */
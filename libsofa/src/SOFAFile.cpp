@@ -54,9 +54,110 @@ http://www.sofaconventions.org
 #include "../src/SOFAEmitter.h"
 #include "../src/SOFAString.h"
 #include "../src/SOFANcUtils.h"
+#include "../src/SOFASimpleFreeFieldHRIR.h"
+#include "../src/SOFASimpleFreeFieldSOS.h"
+#include "../src/SOFASimpleHeadphoneIR.h"
+#include "../src/SOFAGeneralFIR.h"
+#include "../src/SOFAGeneralFIRE.h"
+#include "../src/SOFAGeneralTF.h"
+#include "../src/SOFAMultiSpeakerBRIR.h"
+#include "../src/SOFASingleRoomDRIR.h"
 
 using namespace sofa;
 
+namespace sofaLocal
+{
+    /// reads the slice of a variable obtained by fixing its leading indices,
+    /// the trailing dimensions being read entirely
+    template< typename Type >
+    bool getSlice(const sofa::File &file,
+                  Type *values,
+                  const std::string &variableName,
+                  const std::vector< std::size_t > &indices,
+                  const std::vector< std::size_t > &trailingDims)
+    {
+        std::vector< std::size_t > dims;
+        file.GetVariableDimensions( dims, variableName );
+        
+        if( dims.size() != indices.size() + trailingDims.size() )
+        {
+            return false;
+        }
+        
+        std::vector< std::size_t > start( dims.size(), 0 );
+        std::vector< std::size_t > count( dims.size(), 1 );
+        
+        for( std::size_t i = 0; i < indices.size(); i++ )
+        {
+            start[i] = indices[i];
+        }
+        
+        for( std::size_t i = 0; i < trailingDims.size(); i++ )
+        {
+            if( dims[ indices.size() + i ] != trailingDims[i] )
+            {
+                return false;
+            }
+            
+            count[ indices.size() + i ] = trailingDims[i];
+        }
+        
+        return file.GetValues( values, start, count, variableName );
+    }
+    
+    /// [ M R E N ] : all the receivers of one measurement, for one emitter
+    template< typename Type >
+    bool getEmitterSlice(const sofa::File &file,
+                         Type *values,
+                         const std::string &variableName,
+                         const std::size_t measurementIndex,
+                         const std::size_t emitterIndex,
+                         const std::size_t dim2,
+                         const std::size_t dim4)
+    {
+        std::vector< std::size_t > dims;
+        file.GetVariableDimensions( dims, variableName );
+        
+        if( dims.size() != 4 || dims[1] != dim2 || dims[3] != dim4
+           || measurementIndex >= dims[0] || emitterIndex >= dims[2] )
+        {
+            return false;
+        }
+        
+        std::vector< std::size_t > start( 4, 0 );
+        std::vector< std::size_t > count( 4, 1 );
+        
+        start[0] = measurementIndex;
+        start[2] = emitterIndex;
+        count[1] = dim2;
+        count[3] = dim4;
+        
+        return file.GetValues( values, start, count, variableName );
+    }
+    
+    inline std::vector< std::size_t > makeVector(const std::size_t a)
+    {
+        return std::vector< std::size_t >( 1, a );
+    }
+    
+    inline std::vector< std::size_t > makeVector(const std::size_t a, const std::size_t b)
+    {
+        std::vector< std::size_t > v( 2 );
+        v[0] = a;
+        v[1] = b;
+        return v;
+    }
+    
+    inline std::vector< std::size_t > makeVector(const std::size_t a, const std::size_t b, const std::size_t c)
+    {
+        std::vector< std::size_t > v( 3 );
+        v[0] = a;
+        v[1] = b;
+        v[2] = c;
+        return v;
+    }
+}
+
 /************************************************************************************/
 /*!
  *  @brief          Class constructor
@@ -71,6 +172,49 @@ File::File(const std::string &path,
 {
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file for reading, with tuned storage access
+ *  @param[in]      path : the file path
+ *  @param[in]      options : chunk cache, diskless and read-ahead options
+ *
+ */
+/************************************************************************************/
+File::File(const std::string &path,
+           const sofa::NetCDFFile::OpenOptions &options)
+: sofa::NetCDFFile( path, options )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file stored in memory (read-only, without copy)
+ *  @param[in]      buffer : the content of the file. It shall outlive this object
+ *  @param[in]      size : size of the buffer, in bytes
+ *  @param[in]      name : name returned by GetFilename()
+ *
+ */
+/************************************************************************************/
+File::File(const void *buffer,
+           const std::size_t size,
+           const std::string &name)
+: sofa::NetCDFFile( buffer, size, name )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a view on a file already opened,
+ *                  sharing its netCDF handle (the file is not opened again)
+ *  @param[in]      other : the opened file
+ *
+ */
+/************************************************************************************/
+File::File(const sofa::File *other)
+: sofa::NetCDFFile( other )
+{
+}
+
 /************************************************************************************/
 /*!
  *  @brief          Returns true if this is a valid SOFA file.
@@ -96,6 +240,92 @@ bool File::IsValid() const
             );
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Checks the requirements specific to a convention, once the generic
+ *                  SOFA requirements have been checked by File::IsValid().
+ *                  A generic SOFA file has no additional requirement
+ *
+ */
+/************************************************************************************/
+bool File::checkConvention() const
+{
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if the file complies with a given convention,
+ *                  the generic SOFA requirements being already checked
+ *
+ *  @details        The convention is checked on a view of this file : the file is not opened again
+ */
+/************************************************************************************/
+template< class ConventionType >
+bool File::isValidConvention() const SOFA_NOEXCEPT
+{
+    try
+    {
+        const ConventionType convention( *this );
+        const sofa::File &file = convention;
+        
+        return file.checkConvention();
+    }
+    catch( ... )
+    {
+        return false;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns all the conventions this file complies with, as a combination of
+ *                  ConventionFlag (kNetCDF, kSOFA, kSimpleFreeFieldHRIR, ...)
+ *
+ *  @details        The generic SOFA requirements are checked only once, and each convention
+ *                  is checked on the same netCDF handle : this is much faster than calling
+ *                  IsValid() on each convention class.
+ *                  This method wont raise any exception
+ */
+/************************************************************************************/
+unsigned int File::DetectConventions() const SOFA_NOEXCEPT
+{
+    /// disable exceptions logging in this thread (the other threads are not affected)
+    const sofa::Exception::ScopedLogToCerr noLogging( false );
+    
+    unsigned int flags = 0;
+    
+    try
+    {
+        if( sofa::NetCDFFile::IsValid() == true )
+        {
+            flags |= kNetCDF;
+        }
+        
+        if( File::IsValid() == true )
+        {
+            flags |= kSOFA;
+        }
+    }
+    catch( ... )
+    {
+    }
+    
+    if( ( flags & kSOFA ) != 0 )
+    {
+        if( isValidConvention< sofa::SimpleFreeFieldHRIR >() == true )  { flags |= kSimpleFreeFieldHRIR; }
+        if( isValidConvention< sofa::SimpleFreeFieldSOS >() == true )   { flags |= kSimpleFreeFieldSOS; }
+        if( isValidConvention< sofa::SimpleHeadphoneIR >() == true )    { flags |= kSimpleHeadphoneIR; }
+        if( isValidConvention< sofa::GeneralFIR >() == true )           { flags |= kGeneralFIR; }
+        if( isValidConvention< sofa::GeneralFIRE >() == true )          { flags |= kGeneralFIRE; }
+        if( isValidConvention< sofa::GeneralTF >() == true )            { flags |= kGeneralTF; }
+        if( isValidConvention< sofa::MultiSpeakerBRIR >() == true )     { flags |= kMultiSpeakerBRIR; }
+        if( isValidConvention< sofa::SingleRoomDRIR >() == true )       { flags |= kSingleRoomDRIR; }
+    }
+    
+    return flags;
+}
+
 /************************************************************************************/
 /*!
  *  @brief          Prints the value of all (required) SOFA global attributes
@@ -847,7 +1077,7 @@ bool File::checkTFDataType() const
             return false;
         }
         
-        if( sofa::NcUtils::IsDouble( varReal ) == false )
+        if( sofa::NcUtils::IsFloatingPoint( varReal ) == false )
         {
             SOFA_THROW( "invalid 'Data.Real' variable" );
             return false;
@@ -868,7 +1098,7 @@ bool File::checkTFDataType() const
             return false;
         }
         
-        if( sofa::NcUtils::IsDouble( varImag ) == false )
+        if( sofa::NcUtils::IsFloatingPoint( varImag ) == false )
         {
             SOFA_THROW( "invalid 'Data.Imag' variable" );
             return false;
@@ -891,7 +1121,7 @@ bool File::checkTFDataType() const
         return false;
     }
     
-    if( sofa::NcUtils::IsDouble( varN ) == false )
+    if( sofa::NcUtils::IsFloatingPoint( varN ) == false )
     {
         SOFA_THROW( "invalid 'N' variable" );
         return false;
@@ -954,7 +1184,7 @@ bool File::checkFirDataType() const
         return false;
     }
     
-    if( sofa::NcUtils::IsDouble( varIR ) == false )
+    if( sofa::NcUtils::IsFloatingPoint( varIR ) == false )
     {
         SOFA_THROW( "invalid 'Data.IR' variable" );
         return false;
@@ -974,7 +1204,7 @@ bool File::checkFirDataType() const
         return false;
     }
     
-    if( sofa::NcUtils::IsDouble( varSamplingRate ) == false )
+    if( sofa::NcUtils::IsFloatingPoint( varSamplingRate ) == false )
     {
         SOFA_THROW( "invalid 'Data.SamplingRate' variable" );
         return false;
@@ -1012,7 +1242,7 @@ bool File::checkFirDataType() const
         return false;
     }
     
-    if( sofa::NcUtils::IsDouble( varDelay ) == false )
+    if( sofa::NcUtils::IsFloatingPoint( varDelay ) == false )
     {
         SOFA_THROW( "invalid 'Data.Delay' variable" );
         return false;
@@ -1054,7 +1284,7 @@ bool File::checkFireDataType() const
         return false;
     }
     
-    if( sofa::NcUtils::IsDouble( varIR ) == false )
+    if( sofa::NcUtils::IsFloatingPoint( varIR ) == false )
     {
         SOFA_THROW( "invalid 'Data.IR' variable" );
         return false;
@@ -1074,7 +1304,7 @@ bool File::checkFireDataType() const
         return false;
     }
     
-    if( sofa::NcUtils::IsDouble( varSamplingRate ) == false )
+    if( sofa::NcUtils::IsFloatingPoint( varSamplingRate ) == false )
     {
         SOFA_THROW( "invalid 'Data.SamplingRate' variable" );
         return false;
@@ -1112,7 +1342,7 @@ bool File::checkFireDataType() const
         return false;
     }
     
-    if( sofa::NcUtils::IsDouble( varDelay ) == false )
+    if( sofa::NcUtils::IsFloatingPoint( varDelay ) == false )
     {
         SOFA_THROW( "invalid 'Data.Delay' variable" );
         return false;
@@ -1152,7 +1382,7 @@ bool File::checkSOSDataType() const
         return false;
     }
     
-    if( sofa::NcUtils::IsDouble( varSOS ) == false )
+    if( sofa::NcUtils::IsFloatingPoint( varSOS ) == false )
     {
         SOFA_THROW( "invalid 'Data.SOS' variable" );
         return false;
@@ -1172,7 +1402,7 @@ bool File::checkSOSDataType() const
         return false;
     }
     
-    if( sofa::NcUtils::IsDouble( varSamplingRate ) == false )
+    if( sofa::NcUtils::IsFloatingPoint( varSamplingRate ) == false )
     {
         SOFA_THROW( "invalid 'Data.SamplingRate' variable" );
         return false;
@@ -1210,7 +1440,7 @@ bool File::checkSOSDataType() const
         return false;
     }
     
-    if( sofa::NcUtils::IsDouble( varDelay ) == false )
+    if( sofa::NcUtils::IsFloatingPoint( varDelay ) == false )
     {
         SOFA_THROW( "invalid 'Data.Delay' variable" );
         return false;
@@ -1532,6 +1762,264 @@ bool File::GetEmitterView(std::vector< double > &values) const
     return NetCDFFile::GetValues( values, "EmitterView" );
 }
 
+bool File::GetReceiverPosition(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, dim3, "ReceiverPosition" );
+}
+
+bool File::GetReceiverUp(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, dim3, "ReceiverUp" );
+}
+
+bool File::GetReceiverView(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, dim3, "ReceiverView" );
+}
+
+bool File::GetEmitterPosition(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, dim3, "EmitterPosition" );
+}
+
+bool File::GetEmitterUp(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, dim3, "EmitterUp" );
+}
+
+bool File::GetEmitterView(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, dim3, "EmitterView" );
+}
+
+bool File::GetListenerPosition(float *values, const unsigned long dim1, const unsigned long dim2) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, "ListenerPosition" );
+}
+
+bool File::GetListenerUp(float *values, const unsigned long dim1, const unsigned long dim2) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, "ListenerUp" );
+}
+
+bool File::GetListenerView(float *values, const unsigned long dim1, const unsigned long dim2) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, "ListenerView" );
+}
+
+bool File::GetSourcePosition(float *values, const unsigned long dim1, const unsigned long dim2) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, "SourcePosition" );
+}
+
+bool File::GetSourceUp(float *values, const unsigned long dim1, const unsigned long dim2) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, "SourceUp" );
+}
+
+bool File::GetSourceView(float *values, const unsigned long dim1, const unsigned long dim2) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, "SourceView" );
+}
+
+bool File::GetListenerPosition(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "ListenerPosition" );
+}
+
+bool File::GetListenerUp(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "ListenerUp" );
+}
+
+bool File::GetListenerView(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "ListenerView" );
+}
+
+bool File::GetSourcePosition(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "SourcePosition" );
+}
+
+bool File::GetSourceUp(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "SourceUp" );
+}
+
+bool File::GetSourceView(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "SourceView" );
+}
+
+bool File::GetReceiverPosition(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "ReceiverPosition" );
+}
+
+bool File::GetReceiverUp(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "ReceiverUp" );
+}
+
+bool File::GetReceiverView(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "ReceiverView" );
+}
+
+bool File::GetEmitterPosition(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "EmitterPosition" );
+}
+
+bool File::GetEmitterUp(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "EmitterUp" );
+}
+
+bool File::GetEmitterView(std::vector< float > &values) const
+{
+    return NetCDFFile::GetValues( values, "EmitterView" );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the ListenerPosition values [ I C ], as separate arrays
+ *  @param[out]     positions : the positions, converted to the requested coordinates system
+ *  @param[in]      coordinates : kCartesian (meter) or kSpherical
+ *  @param[in]      angleUnits : unit of azimuth and elevation, if coordinates is kSpherical
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool File::GetListenerPosition(sofa::PositionArrays &positions,
+                               const sofa::Coordinates::Type coordinates,
+                               const sofa::PositionArrays::AngleUnits angleUnits) const
+{
+    return File::getPositions( positions, "ListenerPosition", coordinates, angleUnits );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the SourcePosition values [ M C ] (or [ I C ]), as separate arrays
+ *  @param[out]     positions : the positions, converted to the requested coordinates system
+ *  @param[in]      coordinates : kCartesian (meter) or kSpherical
+ *  @param[in]      angleUnits : unit of azimuth and elevation, if coordinates is kSpherical
+ *  @return         true on success
+ *
+ *  @details        e.g. GetSourcePosition( positions, sofa::Coordinates::kCartesian ) gives
+ *                  the x, y, z arrays of the M measurements, ready for a search
+ */
+/************************************************************************************/
+bool File::GetSourcePosition(sofa::PositionArrays &positions,
+                             const sofa::Coordinates::Type coordinates,
+                             const sofa::PositionArrays::AngleUnits angleUnits) const
+{
+    return File::getPositions( positions, "SourcePosition", coordinates, angleUnits );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the ReceiverPosition values [ R C I ] (or [ R C M ]), as separate arrays
+ *  @param[out]     positions : the positions, converted to the requested coordinates system
+ *  @param[in]      coordinates : kCartesian (meter) or kSpherical
+ *  @param[in]      angleUnits : unit of azimuth and elevation, if coordinates is kSpherical
+ *  @return         true on success
+ *
+ *  @details        The position of receiver r for measurement m is at index r * M + m
+ */
+/************************************************************************************/
+bool File::GetReceiverPosition(sofa::PositionArrays &positions,
+                               const sofa::Coordinates::Type coordinates,
+                               const sofa::PositionArrays::AngleUnits angleUnits) const
+{
+    return File::getPositions( positions, "ReceiverPosition", coordinates, angleUnits );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the EmitterPosition values [ E C I ] (or [ E C M ]), as separate arrays
+ *  @param[out]     positions : the positions, converted to the requested coordinates system
+ *  @param[in]      coordinates : kCartesian (meter) or kSpherical
+ *  @param[in]      angleUnits : unit of azimuth and elevation, if coordinates is kSpherical
+ *  @return         true on success
+ *
+ *  @details        The position of emitter e for measurement m is at index e * M + m
+ */
+/************************************************************************************/
+bool File::GetEmitterPosition(sofa::PositionArrays &positions,
+                              const sofa::Coordinates::Type coordinates,
+                              const sofa::PositionArrays::AngleUnits angleUnits) const
+{
+    return File::getPositions( positions, "EmitterPosition", coordinates, angleUnits );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads a position variable [ X C ] or [ X C Y ], and converts it to separate arrays
+ *                  of X (or X x Y) positions
+ *
+ */
+/************************************************************************************/
+bool File::getPositions(sofa::PositionArrays &positions,
+                        const std::string &variableName,
+                        const sofa::Coordinates::Type coordinates,
+                        const sofa::PositionArrays::AngleUnits angleUnits) const
+{
+    sofa::Coordinates::Type variableCoordinates;
+    sofa::Units::Type units;
+    
+    if( File::get( variableCoordinates, units, variableName ) == false )
+    {
+        return false;
+    }
+    
+    std::vector< std::size_t > dims;
+    NetCDFFile::GetVariableDimensions( dims, variableName );
+    
+    if( ( dims.size() != 2 && dims.size() != 3 ) || dims[1] != 3 )
+    {
+        return false;
+    }
+    
+    std::vector< double > values;
+    
+    if( NetCDFFile::GetValues( values, variableName ) == false )
+    {
+        return false;
+    }
+    
+    const std::size_t dim1 = dims[0];
+    const std::size_t dim3 = ( dims.size() == 3 ) ? dims[2] : 1;
+    
+    /// [ X C Y ] -> [ X Y C ]
+    if( dim3 > 1 )
+    {
+        std::vector< double > transposed( values.size() );
+        
+        for( std::size_t i = 0; i < dim1; i++ )
+        {
+            for( std::size_t j = 0; j < dim3; j++ )
+            {
+                for( std::size_t c = 0; c < 3; c++ )
+                {
+                    transposed[ ( i * dim3 + j ) * 3 + c ] = values[ ( i * 3 + c ) * dim3 + j ];
+                }
+            }
+        }
+        
+        values.swap( transposed );
+    }
+    
+    positions.Set( values.empty() == false ? &values[0] : NULL,
+                  dim1 * dim3,
+                  variableCoordinates,
+                  coordinates,
+                  angleUnits );
+    
+    return true;
+}
+
 
 /************************************************************************************/
 /*!
@@ -1568,6 +2056,122 @@ bool File::getDataIR(std::vector< double > &values) const
     return NetCDFFile::GetValues( values, "Data.IR" );
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement (for all receivers),
+ *                  without reading the whole Data.IR variable
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim2 x dim3)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim3 : third dimension (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool File::getDataIR(const unsigned long measurementIndex, double *values, const unsigned long dim2, const unsigned long dim3) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.IR" ) == 3 );
+    
+    return sofaLocal::getSlice( *this, values, "Data.IR",
+                                sofaLocal::makeVector( measurementIndex ),
+                                sofaLocal::makeVector( dim2, dim3 ) );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement for one receiver,
+ *                  without reading the whole Data.IR variable
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim3)
+ *  @param[in]      dim3 : third dimension (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool File::getDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, double *values, const unsigned long dim3) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.IR" ) == 3 );
+    
+    return sofaLocal::getSlice( *this, values, "Data.IR",
+                                sofaLocal::makeVector( measurementIndex, receiverIndex ),
+                                sofaLocal::makeVector( dim3 ) );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement (for all receivers and emitters),
+ *                  for a Data.IR variable of size [M R E N]
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim2 x dim3 x dim4)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim3 : third dimension (E)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool File::getDataIR(const unsigned long measurementIndex, double *values, const unsigned long dim2, const unsigned long dim3, const unsigned long dim4) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.IR" ) == 4 );
+    
+    return sofaLocal::getSlice( *this, values, "Data.IR",
+                                sofaLocal::makeVector( measurementIndex ),
+                                sofaLocal::makeVector( dim2, dim3, dim4 ) );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for one receiver and one emitter,
+ *                  for a Data.IR variable of size [M R E N]
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim4)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool File::getDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, const unsigned long emitterIndex, double *values, const unsigned long dim4) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.IR" ) == 4 );
+    
+    return sofaLocal::getSlice( *this, values, "Data.IR",
+                                sofaLocal::makeVector( measurementIndex, receiverIndex, emitterIndex ),
+                                sofaLocal::makeVector( dim4 ) );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for all receivers and one emitter,
+ *                  for a Data.IR variable of size [M R E N]
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : array containing the values [ R N ].
+ *                  The array must be allocated large enough (dim2 x dim4)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool File::getEmitterDataIR(const unsigned long measurementIndex, const unsigned long emitterIndex, double *values, const unsigned long dim2, const unsigned long dim4) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.IR" ) == 4 );
+    
+    return sofaLocal::getEmitterSlice( *this, values, "Data.IR", measurementIndex, emitterIndex, dim2, dim4 );
+}
+
 /************************************************************************************/
 /*!
  *  @brief          Retrieves the Data.Delay values
@@ -1599,6 +2203,203 @@ bool File::getDataDelay(double *values, const unsigned long dim1, const unsigned
     return NetCDFFile::GetValues( values, dim1, dim2, dim3, "Data.Delay" );
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough
+ *  @param[in]      dim1 : first dimension (M)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim3 : third dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ *
+ */
+/************************************************************************************/
+bool File::getDataIR(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.IR" ) == 3 );
+    
+    return NetCDFFile::GetValues( values, dim1, dim2, dim3, "Data.IR" );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values
+ *  @param[in]      values : the array is resized if needed
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ *
+ */
+/************************************************************************************/
+bool File::getDataIR(std::vector< float > &values) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    
+    return NetCDFFile::GetValues( values, "Data.IR" );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement (for all receivers),
+ *                  without reading the whole Data.IR variable
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim2 x dim3)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim3 : third dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ *
+ */
+/************************************************************************************/
+bool File::getDataIR(const unsigned long measurementIndex, float *values, const unsigned long dim2, const unsigned long dim3) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.IR" ) == 3 );
+    
+    return sofaLocal::getSlice( *this, values, "Data.IR",
+                                sofaLocal::makeVector( measurementIndex ),
+                                sofaLocal::makeVector( dim2, dim3 ) );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement for one receiver,
+ *                  without reading the whole Data.IR variable
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim3)
+ *  @param[in]      dim3 : third dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ *
+ */
+/************************************************************************************/
+bool File::getDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, float *values, const unsigned long dim3) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.IR" ) == 3 );
+    
+    return sofaLocal::getSlice( *this, values, "Data.IR",
+                                sofaLocal::makeVector( measurementIndex, receiverIndex ),
+                                sofaLocal::makeVector( dim3 ) );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement (for all receivers and emitters),
+ *                  for a Data.IR variable of size [M R E N]
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim2 x dim3 x dim4)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim3 : third dimension (E)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ *
+ */
+/************************************************************************************/
+bool File::getDataIR(const unsigned long measurementIndex, float *values, const unsigned long dim2, const unsigned long dim3, const unsigned long dim4) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.IR" ) == 4 );
+    
+    return sofaLocal::getSlice( *this, values, "Data.IR",
+                                sofaLocal::makeVector( measurementIndex ),
+                                sofaLocal::makeVector( dim2, dim3, dim4 ) );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for one receiver and one emitter,
+ *                  for a Data.IR variable of size [M R E N]
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim4)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ *
+ */
+/************************************************************************************/
+bool File::getDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, const unsigned long emitterIndex, float *values, const unsigned long dim4) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.IR" ) == 4 );
+    
+    return sofaLocal::getSlice( *this, values, "Data.IR",
+                                sofaLocal::makeVector( measurementIndex, receiverIndex, emitterIndex ),
+                                sofaLocal::makeVector( dim4 ) );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for all receivers and one emitter,
+ *                  for a Data.IR variable of size [M R E N]
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : array containing the values [ R N ].
+ *                  The array must be allocated large enough (dim2 x dim4)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool File::getEmitterDataIR(const unsigned long measurementIndex, const unsigned long emitterIndex, float *values, const unsigned long dim2, const unsigned long dim4) const
+{
+    SOFA_ASSERT( HasVariable( "Data.IR" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.IR" ) == 4 );
+    
+    return sofaLocal::getEmitterSlice( *this, values, "Data.IR", measurementIndex, emitterIndex, dim2, dim4 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.Delay values
+ *  @param[in]      values : the array is resized if needed
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ *
+ */
+/************************************************************************************/
+bool File::getDataDelay(std::vector< float > &values) const
+{
+    SOFA_ASSERT( HasVariable( "Data.Delay" ) == true );
+    
+    return NetCDFFile::GetValues( values, "Data.Delay" );
+}
+
+bool File::getDataDelay(float *values, const unsigned long dim1, const unsigned long dim2) const
+{
+    SOFA_ASSERT( HasVariable( "Data.Delay" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.Delay" ) == 2 );
+    
+    return NetCDFFile::GetValues( values, dim1, dim2, "Data.Delay" );
+}
+
+bool File::getDataDelay(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const
+{
+    SOFA_ASSERT( HasVariable( "Data.Delay" ) == true );
+    SOFA_ASSERT( GetVariableDimensionality( "Data.Delay" ) == 3 );
+    
+    return NetCDFFile::GetValues( values, dim1, dim2, dim3, "Data.Delay" );
+}
+
 /************************************************************************************/
 /*!
  *  @brief          The Data.SamplingRate variable can be either [I] or [M],
@@ -1611,8 +2412,10 @@ bool File::isSamplingRateScalar() const
 {
     SOFA_ASSERT( HasVariable( "Data.SamplingRate" ) == true );
     
+    const netCDF::NcVar var = getVariable( "Data.SamplingRate" );
+    
     return VariableIsScalar( "Data.SamplingRate" ) == true
-        && HasVariableType( netCDF::NcType::nc_DOUBLE, "Data.SamplingRate");
+        && sofa::NcUtils::IsFloatingPoint( var ) == true;
 }
 
 /************************************************************************************/
@@ -1631,6 +2434,16 @@ bool File::getSamplingRate(double &value) const
     {
         const netCDF::NcVar var = getVariable( "Data.SamplingRate" );
         
+        if( sofa::NcUtils::IsFloat( var ) == true )
+        {
+            /// single-precision file : read the value as stored, then widen it
+            float floatValue = 0.0f;
+            var.getVar( &floatValue );
+            
+            value = (double) floatValue;
+            return true;
+        }
+        
         return sofa::NcUtils::GetValue( value, var );
     }
     else
@@ -1684,10 +2497,8 @@ void File::ensureGlobalAttribute(const sofa::Attributes::Type &type_) const
 /************************************************************************************/
 void File::ensureGlobalAttribute(const std::string &attributeName) const
 {
-    const netCDF::NcGroupAtt att = getAttribute( attributeName );
-    
     /// in SOFA, the global attributes must always be strings
-    if( sofa::NcUtils::IsChar( att ) != true )
+    if( IsAttributeChar( attributeName ) != true )
     {
         const std::string err = "Missing '" + attributeName + "' global attribute";
         SOFA_THROW( err );
@@ -53,6 +53,7 @@ http://www.sofaconventions.org
 #include "../src/SOFAAttributes.h"
 #include "../src/SOFACoordinates.h"
 #include "../src/SOFAUnits.h"
+#include "../src/SOFAPositionArrays.h"
 
 namespace sofa
 {
@@ -67,13 +68,38 @@ namespace sofa
     /************************************************************************************/
     class SOFA_API File : public sofa::NetCDFFile
     {
+    public:
+        /// flags returned by DetectConventions()
+        enum ConventionFlag
+        {
+            kNetCDF                 = 1 << 0,
+            kSOFA                   = 1 << 1,
+            kSimpleFreeFieldHRIR    = 1 << 2,
+            kSimpleFreeFieldSOS     = 1 << 3,
+            kSimpleHeadphoneIR      = 1 << 4,
+            kGeneralFIR             = 1 << 5,
+            kGeneralFIRE            = 1 << 6,
+            kGeneralTF              = 1 << 7,
+            kMultiSpeakerBRIR       = 1 << 8,
+            kSingleRoomDRIR         = 1 << 9
+        };
+        
     public:
         File(const std::string &path,
              const netCDF::NcFile::FileMode &mode = netCDF::NcFile::read);
         
+        File(const std::string &path,
+             const sofa::NetCDFFile::OpenOptions &options);
+        
+        File(const void *buffer,
+             const std::size_t size,
+             const std::string &name = "");
+        
         virtual ~File() {};
         
         virtual bool IsValid() const SOFA_OVERRIDE;
+        
+        unsigned int DetectConventions() const SOFA_NOEXCEPT;
                 
         //==============================================================================
         // SOFA Attributes
@@ -161,7 +187,64 @@ namespace sofa
         bool GetEmitterUp(std::vector< double > &values) const;
         bool GetEmitterView(std::vector< double > &values) const;
         
+        //==============================================================================
+        /// single precision : the values are converted while reading
+        bool GetListenerPosition(float *values, const unsigned long dim1, const unsigned long dim2) const;
+        bool GetListenerUp(float *values, const unsigned long dim1, const unsigned long dim2) const;
+        bool GetListenerView(float *values, const unsigned long dim1, const unsigned long dim2) const;
+        
+        bool GetSourcePosition(float *values, const unsigned long dim1, const unsigned long dim2) const;
+        bool GetSourceUp(float *values, const unsigned long dim1, const unsigned long dim2) const;
+        bool GetSourceView(float *values, const unsigned long dim1, const unsigned long dim2) const;
+        
+        bool GetReceiverPosition(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
+        bool GetReceiverUp(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
+        bool GetReceiverView(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
+        
+        bool GetEmitterPosition(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
+        bool GetEmitterUp(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
+        bool GetEmitterView(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
+        
+        //==============================================================================
+        bool GetListenerPosition(std::vector< float > &values) const;
+        bool GetListenerUp(std::vector< float > &values) const;
+        bool GetListenerView(std::vector< float > &values) const;
+        
+        bool GetSourcePosition(std::vector< float > &values) const;
+        bool GetSourceUp(std::vector< float > &values) const;
+        bool GetSourceView(std::vector< float > &values) const;
+        
+        bool GetReceiverPosition(std::vector< float > &values) const;
+        bool GetReceiverUp(std::vector< float > &values) const;
+        bool GetReceiverView(std::vector< float > &values) const;
+        
+        bool GetEmitterPosition(std::vector< float > &values) const;
+        bool GetEmitterUp(std::vector< float > &values) const;
+        bool GetEmitterView(std::vector< float > &values) const;
+        
+        //==============================================================================
+        bool GetListenerPosition(sofa::PositionArrays &positions,
+                                 const sofa::Coordinates::Type coordinates,
+                                 const sofa::PositionArrays::AngleUnits angleUnits = sofa::PositionArrays::kDegree) const;
+        
+        bool GetSourcePosition(sofa::PositionArrays &positions,
+                               const sofa::Coordinates::Type coordinates,
+                               const sofa::PositionArrays::AngleUnits angleUnits = sofa::PositionArrays::kDegree) const;
+        
+        bool GetReceiverPosition(sofa::PositionArrays &positions,
+                                 const sofa::Coordinates::Type coordinates,
+                                 const sofa::PositionArrays::AngleUnits angleUnits = sofa::PositionArrays::kDegree) const;
+        
+        bool GetEmitterPosition(sofa::PositionArrays &positions,
+                                const sofa::Coordinates::Type coordinates,
+                                const sofa::PositionArrays::AngleUnits angleUnits = sofa::PositionArrays::kDegree) const;
+        
     protected:
+        //==============================================================================
+        explicit File(const sofa::File *other);
+        
+        virtual bool checkConvention() const;
+        
         //==============================================================================
         bool hasSOFAConvention() const;
         bool hasSOFARequiredAttributes() const;
@@ -181,16 +264,41 @@ namespace sofa
         bool getCoordinates(sofa::Coordinates::Type &coordinates, const std::string &variableName) const;
         bool getUnits(sofa::Units::Type &units, const std::string &variableName) const;
         bool get(sofa::Coordinates::Type &coordinates, sofa::Units::Type &units, const std::string &variableName) const;
+        bool getPositions(sofa::PositionArrays &positions,
+                          const std::string &variableName,
+                          const sofa::Coordinates::Type coordinates,
+                          const sofa::PositionArrays::AngleUnits angleUnits) const;
         
         //==============================================================================
         bool getDataIR(std::vector< double > &values) const;
         bool getDataIR(double *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
         
+        bool getDataIR(const unsigned long measurementIndex, double *values, const unsigned long dim2, const unsigned long dim3) const;
+        bool getDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, double *values, const unsigned long dim3) const;
+        bool getDataIR(const unsigned long measurementIndex, double *values, const unsigned long dim2, const unsigned long dim3, const unsigned long dim4) const;
+        bool getDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, const unsigned long emitterIndex, double *values, const unsigned long dim4) const;
+        bool getEmitterDataIR(const unsigned long measurementIndex, const unsigned long emitterIndex, double *values, const unsigned long dim2, const unsigned long dim4) const;
+        
         //==============================================================================
         bool getDataDelay(double *values, const unsigned long dim1, const unsigned long dim2) const;
         bool getDataDelay(double *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
         bool getDataDelay(std::vector< double > &values) const;
         
+        //==============================================================================
+        bool getDataIR(std::vector< float > &values) const;
+        bool getDataIR(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
+        
+        bool getDataIR(const unsigned long measurementIndex, float *values, const unsigned long dim2, const unsigned long dim3) const;
+        bool getDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, float *values, const unsigned long dim3) const;
+        bool getDataIR(const unsigned long measurementIndex, float *values, const unsigned long dim2, const unsigned long dim3, const unsigned long dim4) const;
+        bool getDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, const unsigned long emitterIndex, float *values, const unsigned long dim4) const;
+        bool getEmitterDataIR(const unsigned long measurementIndex, const unsigned long emitterIndex, float *values, const unsigned long dim2, const unsigned long dim4) const;
+        
+        //==============================================================================
+        bool getDataDelay(float *values, const unsigned long dim1, const unsigned long dim2) const;
+        bool getDataDelay(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
+        bool getDataDelay(std::vector< float > &values) const;
+        
         //==============================================================================
         bool isSamplingRateScalar() const;
         bool getSamplingRate(double &value) const;
@@ -202,6 +310,11 @@ namespace sofa
         void ensureSOFAConvention(const std::string &conventionName) const;
         void ensureDataType(const std::string &typeName) const;
         
+    private:
+        //==============================================================================
+        template< class ConventionType >
+        bool isValidConvention() const SOFA_NOEXCEPT;
+        
     private:
         //==============================================================================
         /// avoid shallow and copy constructor
@@ -73,6 +73,15 @@ namespace sofa
         GeneralFIRE(const std::string &path,
                    const netCDF::NcFile::FileMode &mode = netCDF::NcFile::read);
         
+        GeneralFIRE(const std::string &path,
+                    const sofa::NetCDFFile::OpenOptions &options);
+        
+        GeneralFIRE(const void *buffer,
+                    const std::size_t size,
+                    const std::string &name = "");
+        
+        explicit GeneralFIRE(const sofa::File &file);
+        
         virtual ~GeneralFIRE() {};
         
         virtual bool IsValid() const SOFA_OVERRIDE;
@@ -84,11 +93,26 @@ namespace sofa
         bool GetDataIR(std::vector< double > &values) const;
         bool GetDataIR(double *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3, const unsigned long dim4) const;
         
+        bool GetDataIR(const unsigned long measurementIndex, std::vector< double > &values) const;
+        bool GetDataIR(const unsigned long measurementIndex, double *values, const unsigned long dim2, const unsigned long dim3, const unsigned long dim4) const;
+        bool GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, const unsigned long emitterIndex, std::vector< double > &values) const;
+        bool GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, const unsigned long emitterIndex, double *values, const unsigned long dim4) const;
+        
         //==============================================================================
         bool GetDataDelay(double *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
         
+        /// single precision : the values are converted while reading
+        bool GetDataIR(std::vector< float > &values) const;
+        bool GetDataIR(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3, const unsigned long dim4) const;
+        bool GetDataIR(const unsigned long measurementIndex, std::vector< float > &values) const;
+        bool GetDataIR(const unsigned long measurementIndex, float *values, const unsigned long dim2, const unsigned long dim3, const unsigned long dim4) const;
+        bool GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, const unsigned long emitterIndex, std::vector< float > &values) const;
+        bool GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, const unsigned long emitterIndex, float *values, const unsigned long dim4) const;
+        bool GetDataDelay(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
+        
     private:
         //==============================================================================
+        virtual bool checkConvention() const SOFA_OVERRIDE;
         bool checkGlobalAttributes() const;
         
     private:
@@ -77,6 +77,49 @@ GeneralTF::GeneralTF(const std::string &path,
 {
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file for reading, with tuned storage access
+ *  @param[in]      path : the file path
+ *  @param[in]      options : chunk cache, diskless and read-ahead options
+ *
+ */
+/************************************************************************************/
+GeneralTF::GeneralTF(const std::string &path,
+                     const sofa::NetCDFFile::OpenOptions &options)
+: sofa::File( path, options )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file stored in memory (read-only, without copy)
+ *  @param[in]      buffer : the content of the file. It shall outlive this object
+ *  @param[in]      size : size of the buffer, in bytes
+ *  @param[in]      name : name returned by GetFilename()
+ *
+ */
+/************************************************************************************/
+GeneralTF::GeneralTF(const void *buffer,
+                     const std::size_t size,
+                     const std::string &name)
+: sofa::File( buffer, size, name )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a view on a file already opened,
+ *                  sharing its netCDF handle (the file is not opened again)
+ *  @param[in]      file : the opened file
+ *
+ */
+/************************************************************************************/
+GeneralTF::GeneralTF(const sofa::File &file)
+: sofa::File( &file )
+{
+}
+
 bool GeneralTF::checkGlobalAttributes() const
 {
     sofa::Attributes attributes;
@@ -101,6 +144,18 @@ bool GeneralTF::IsValid() const
         return false;
     }
     
+    return checkConvention();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Checks the requirements specific to the GeneralTF convention
+ *                  (the generic SOFA requirements are checked by File::IsValid)
+ *
+ */
+/************************************************************************************/
+bool GeneralTF::checkConvention() const
+{
     if( IsTFDataType() == false )
     {
         SOFA_THROW( "'DataType' shall be TF" );
@@ -73,12 +73,22 @@ namespace sofa
         GeneralTF(const std::string &path,
                    const netCDF::NcFile::FileMode &mode = netCDF::NcFile::read);
         
+        GeneralTF(const std::string &path,
+                  const sofa::NetCDFFile::OpenOptions &options);
+        
+        GeneralTF(const void *buffer,
+                  const std::size_t size,
+                  const std::string &name = "");
+        
+        explicit GeneralTF(const sofa::File &file);
+        
         virtual ~GeneralTF() {};
         
         virtual bool IsValid() const SOFA_OVERRIDE;
         
     private:
         //==============================================================================
+        virtual bool checkConvention() const SOFA_OVERRIDE;
         bool checkGlobalAttributes() const;
         
     private:
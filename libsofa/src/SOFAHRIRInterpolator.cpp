@@ -0,0 +1,405 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAHRIRInterpolator.cpp
+ *   @brief      Interpolation of HRIRs for arbitrary directions
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAHRIRInterpolator.h"
+#include "../src/SOFASimpleFreeFieldHRIR.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAUtils.h"
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    /// computes the unit vector of a position; returns false for a null vector
+    inline bool toDirection(double direction[3],
+                            const double c1,
+                            const double c2,
+                            const double c3,
+                            const sofa::Coordinates::Type coordinates) SOFA_NOEXCEPT
+    {
+        if( coordinates == sofa::Coordinates::kSpherical )
+        {
+            sofa::SphericalToCartesian( direction, c1, c2, 1.0 );
+            return true;
+        }
+
+        const double norm = std::sqrt( c1 * c1 + c2 * c2 + c3 * c3 );
+
+        if( norm <= 0.0 )
+        {
+            return false;
+        }
+
+        direction[0] = c1 / norm;
+        direction[1] = c2 / norm;
+        direction[2] = c3 / norm;
+
+        return true;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Loads all the data from a SimpleFreeFieldHRIR file, and triangulates
+ *                  the source directions
+ *  @param[in]      file : a valid SimpleFreeFieldHRIR file
+ *
+ *  @details        Throws an exception if the data can not be read
+ */
+/************************************************************************************/
+HRIRInterpolator::HRIRInterpolator(const sofa::SimpleFreeFieldHRIR &file)
+: numMeasurements( 0 )
+, numReceivers( 0 )
+, numDataSamples( 0 )
+, impulseResponses()
+, delays()
+, delaysPerMeasurement( false )
+, directions()
+, triangulation()
+{
+    numMeasurements = (std::size_t) file.GetNumMeasurements();
+    numReceivers    = (std::size_t) file.GetNumReceivers();
+    numDataSamples  = (std::size_t) file.GetNumDataSamples();
+
+    sofa::Coordinates::Type coordinates;
+    sofa::Units::Type units;
+
+    if( file.GetSourcePosition( coordinates, units ) == false )
+    {
+        SOFA_THROW( "invalid 'SourcePosition' variable" );
+    }
+
+    std::vector< double > positions;
+
+    if( file.GetSourcePosition( positions ) == false || positions.size() != 3 * numMeasurements )
+    {
+        SOFA_THROW( "invalid 'SourcePosition' dimensions" );
+    }
+
+    if( file.GetDataIR( impulseResponses ) == false
+       || impulseResponses.size() != numMeasurements * numReceivers * numDataSamples )
+    {
+        SOFA_THROW( "invalid 'Data.IR' variable" );
+    }
+
+    std::vector< double > fileDelays;
+
+    if( file.GetDataDelay( fileDelays ) == false )
+    {
+        SOFA_THROW( "invalid 'Data.Delay' variable" );
+    }
+
+    /// Data.Delay is [ I R ] or [ M R ]
+    bool perMeasurement = false;
+
+    if( fileDelays.size() == numMeasurements * numReceivers && numMeasurements > 1 )
+    {
+        perMeasurement = true;
+    }
+    else if( fileDelays.size() != numReceivers )
+    {
+        SOFA_THROW( "invalid 'Data.Delay' dimensions" );
+    }
+
+    initialize( ( numMeasurements > 0 ) ? &positions[0] : NULL,
+                coordinates,
+                NULL,
+                ( fileDelays.empty() == false ) ? &fileDelays[0] : NULL,
+                perMeasurement );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the interpolator from arrays
+ *  @param[in]      positions : source positions [ M C ], C = 3
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @param[in]      impulseResponses : time-aligned (or minimum-phase) impulse responses [ M R N ]
+ *  @param[in]      delays : onset delays, in samples, [ M R ] or [ 1 R ]
+ *  @param[in]      numMeasurements : M
+ *  @param[in]      numReceivers : R
+ *  @param[in]      numDataSamples : N
+ *  @param[in]      delaysPerMeasurement : true if delays is [ M R ], false if it is [ 1 R ]
+ *
+ */
+/************************************************************************************/
+HRIRInterpolator::HRIRInterpolator(const double *positions,
+                                   const sofa::Coordinates::Type coordinates,
+                                   const double *impulseResponses_,
+                                   const double *delays_,
+                                   const std::size_t numMeasurements_,
+                                   const std::size_t numReceivers_,
+                                   const std::size_t numDataSamples_,
+                                   const bool delaysPerMeasurement_)
+: numMeasurements( numMeasurements_ )
+, numReceivers( numReceivers_ )
+, numDataSamples( numDataSamples_ )
+, impulseResponses()
+, delays()
+, delaysPerMeasurement( false )
+, directions()
+, triangulation()
+{
+    initialize( positions, coordinates, impulseResponses_, delays_, delaysPerMeasurement_ );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+HRIRInterpolator::~HRIRInterpolator()
+{
+}
+
+void HRIRInterpolator::initialize(const double *positions,
+                                  const sofa::Coordinates::Type coordinates,
+                                  const double *impulseResponses_,
+                                  const double *delays_,
+                                  const bool delaysPerMeasurement_)
+{
+    if( coordinates != sofa::Coordinates::kCartesian && coordinates != sofa::Coordinates::kSpherical )
+    {
+        SOFA_THROW( "invalid coordinates (should be cartesian or spherical)" );
+    }
+
+    if( impulseResponses_ != NULL )
+    {
+        impulseResponses.assign( impulseResponses_, impulseResponses_ + numMeasurements * numReceivers * numDataSamples );
+    }
+
+    delaysPerMeasurement = delaysPerMeasurement_;
+
+    const std::size_t numDelays = ( delaysPerMeasurement == true ) ? numMeasurements * numReceivers : numReceivers;
+
+    if( delays_ != NULL )
+    {
+        delays.assign( delays_, delays_ + numDelays );
+    }
+    else
+    {
+        delays.assign( numDelays, 0.0 );
+    }
+
+    std::vector< double > points( 3 * numMeasurements, 0.0 );
+
+    for( std::size_t i = 0; i < numMeasurements; i++ )
+    {
+        /// a null position is left at the origin : it will never be the nearest measurement
+        sofaLocal::toDirection( &points[ 3 * i ],
+                                positions[ 3 * i + 0 ],
+                                positions[ 3 * i + 1 ],
+                                positions[ 3 * i + 2 ],
+                                coordinates );
+    }
+
+    const double *data = ( numMeasurements > 0 ) ? &points[0] : NULL;
+
+    directions.Build( data, numMeasurements );
+    triangulation.Build( data, numMeasurements );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of measurements (M)
+ *
+ */
+/************************************************************************************/
+std::size_t HRIRInterpolator::GetNumMeasurements() const SOFA_NOEXCEPT
+{
+    return numMeasurements;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of receivers (R)
+ *
+ */
+/************************************************************************************/
+std::size_t HRIRInterpolator::GetNumReceivers() const SOFA_NOEXCEPT
+{
+    return numReceivers;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of data samples (N)
+ *
+ */
+/************************************************************************************/
+std::size_t HRIRInterpolator::GetNumDataSamples() const SOFA_NOEXCEPT
+{
+    return numDataSamples;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if the directions have been triangulated, false if the
+ *                  interpolator falls back to the nearest measurement
+ *
+ */
+/************************************************************************************/
+bool HRIRInterpolator::IsTriangulated() const SOFA_NOEXCEPT
+{
+    return triangulation.IsValid();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes the measurements and weights used for one direction
+ *  @param[out]     indices : indices of the three measurements, in [0 M-1]
+ *  @param[out]     weights : barycentric weights (positive, summing to 1)
+ *  @param[in]      c1 : x or azimuth (degree)
+ *  @param[in]      c2 : y or elevation (degree)
+ *  @param[in]      c3 : z or radius (ignored in spherical coordinates)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @return         false if the interpolator is empty, or the direction is undefined
+ *
+ */
+/************************************************************************************/
+bool HRIRInterpolator::GetWeights(std::size_t indices[3],
+                                  double weights[3],
+                                  const double c1,
+                                  const double c2,
+                                  const double c3,
+                                  const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT
+{
+    double direction[3];
+
+    if( sofaLocal::toDirection( direction, c1, c2, c3, coordinates ) == false )
+    {
+        return false;
+    }
+
+    std::size_t nearest;
+    double squaredDistance;
+
+    if( directions.FindNearest( nearest, squaredDistance, direction[0], direction[1], direction[2] ) == false )
+    {
+        return false;
+    }
+
+    if( triangulation.FindTriangle( indices, weights, direction, nearest ) == true )
+    {
+        return true;
+    }
+
+    indices[0] = nearest;
+    indices[1] = nearest;
+    indices[2] = nearest;
+
+    weights[0] = 1.0;
+    weights[1] = 0.0;
+    weights[2] = 0.0;
+
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes the interpolated HRIR for one direction
+ *  @param[out]     values : interpolated impulse responses [ R N ].
+ *                  The array must be allocated large enough (R x N)
+ *  @param[out]     delays : interpolated onset delays, in samples [ R ].
+ *                  The array must be allocated large enough (R), or NULL
+ *  @param[in]      c1 : x or azimuth (degree)
+ *  @param[in]      c2 : y or elevation (degree)
+ *  @param[in]      c3 : z or radius (ignored in spherical coordinates)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @return         false if the interpolator is empty, or the direction is undefined
+ *
+ *  @details        This method does not allocate memory
+ */
+/************************************************************************************/
+bool HRIRInterpolator::GetHRIR(double *values,
+                               double *delays_,
+                               const double c1,
+                               const double c2,
+                               const double c3,
+                               const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT
+{
+    std::size_t indices[3];
+    double weights[3];
+
+    if( GetWeights( indices, weights, c1, c2, c3, coordinates ) == false )
+    {
+        return false;
+    }
+
+    const std::size_t size = numReceivers * numDataSamples;
+
+    if( values != NULL && impulseResponses.empty() == false )
+    {
+        const double *ir0 = &impulseResponses[ indices[0] * size ];
+        const double *ir1 = &impulseResponses[ indices[1] * size ];
+        const double *ir2 = &impulseResponses[ indices[2] * size ];
+
+        for( std::size_t i = 0; i < size; i++ )
+        {
+            values[i] = weights[0] * ir0[i] + weights[1] * ir1[i] + weights[2] * ir2[i];
+        }
+    }
+
+    if( delays_ != NULL )
+    {
+        for( std::size_t r = 0; r < numReceivers; r++ )
+        {
+            if( delaysPerMeasurement == true )
+            {
+                delays_[r] = weights[0] * delays[ indices[0] * numReceivers + r ]
+                           + weights[1] * delays[ indices[1] * numReceivers + r ]
+                           + weights[2] * delays[ indices[2] * numReceivers + r ];
+            }
+            else
+            {
+                delays_[r] = delays[r];
+            }
+        }
+    }
+
+    return true;
+}
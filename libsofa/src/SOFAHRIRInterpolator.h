@@ -0,0 +1,148 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAHRIRInterpolator.h
+ *   @brief      Interpolation of HRIRs for arbitrary directions
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_HRIR_INTERPOLATOR_H__
+#define _SOFA_HRIR_INTERPOLATOR_H__
+
+#include "../src/SOFAKdTree.h"
+#include "../src/SOFASphereTriangulation.h"
+#include "../src/SOFACoordinates.h"
+
+namespace sofa
+{
+    class SimpleFreeFieldHRIR;
+
+    /************************************************************************************/
+    /*!
+     *  @class          HRIRInterpolator
+     *  @brief          Computes HRIRs for arbitrary directions, from the measured ones
+     *
+     *  @details        All the data needed for the interpolation (Data.IR, Data.Delay and
+     *                  the triangulation of the SourcePosition directions) is loaded
+     *                  and computed once, in the constructor.
+     *
+     *                  A query locates the triangle of measurements which contains the
+     *                  requested direction and returns the barycentric combination of the three
+     *                  impulse responses. The onset delays (Data.Delay) are interpolated
+     *                  separately, with the same weights : the impulse responses are thus expected
+     *                  to be time-aligned (or minimum-phase), the delays being applied afterwards
+     *                  by the renderer.
+     *
+     *                  If the directions do not allow for a triangulation (e.g. they all lie in
+     *                  the same hemisphere), the interpolator falls back to the nearest measurement.
+     *
+     *                  The query methods are const, do not allocate memory and do not access the
+     *                  file, so they can be called from an audio callback (and from several threads).
+     *                  Only the direction of the source is taken into account, not its distance.
+     */
+    /************************************************************************************/
+    class SOFA_API HRIRInterpolator
+    {
+    public:
+        HRIRInterpolator(const sofa::SimpleFreeFieldHRIR &file);
+
+        HRIRInterpolator(const double *positions,
+                         const sofa::Coordinates::Type coordinates,
+                         const double *impulseResponses,
+                         const double *delays,
+                         const std::size_t numMeasurements,
+                         const std::size_t numReceivers,
+                         const std::size_t numDataSamples,
+                         const bool delaysPerMeasurement);
+
+        ~HRIRInterpolator();
+
+        std::size_t GetNumMeasurements() const SOFA_NOEXCEPT;
+        std::size_t GetNumReceivers() const SOFA_NOEXCEPT;
+        std::size_t GetNumDataSamples() const SOFA_NOEXCEPT;
+
+        bool IsTriangulated() const SOFA_NOEXCEPT;
+
+        bool GetWeights(std::size_t indices[3],
+                        double weights[3],
+                        const double c1,
+                        const double c2,
+                        const double c3,
+                        const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT;
+
+        bool GetHRIR(double *values,
+                     double *delays,
+                     const double c1,
+                     const double c2,
+                     const double c3,
+                     const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        void initialize(const double *positions,
+                        const sofa::Coordinates::Type coordinates,
+                        const double *impulseResponses,
+                        const double *delays,
+                        const bool delaysPerMeasurement);
+
+    private:
+        //==============================================================================
+        std::size_t numMeasurements;                ///< M
+        std::size_t numReceivers;                   ///< R
+        std::size_t numDataSamples;                 ///< N
+
+        std::vector< double > impulseResponses;     ///< Data.IR [ M R N ]
+        std::vector< double > delays;               ///< Data.Delay [ M R ] or [ 1 R ]
+        bool delaysPerMeasurement;                  ///< true if Data.Delay is [ M R ]
+
+        sofa::KdTree directions;                    ///< unit vectors, to find the nearest measurement
+        sofa::SphereTriangulation triangulation;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( HRIRInterpolator );
+    };
+
+}
+
+#endif /* _SOFA_HRIR_INTERPOLATOR_H__ */
@@ -0,0 +1,558 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAHRTFDatabase.cpp
+ *   @brief      Loads all the SimpleFreeFieldHRIR files of a directory
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAHRTFDatabase.h"
+#include "../src/SOFASimpleFreeFieldHRIR.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAHostArchitecture.h"
+#include "../src/SOFAString.h"
+#include <algorithm>
+#include <fstream>
+#include <atomic>
+#include <thread>
+#include <mutex>
+
+#if ( SOFA_WINDOWS == 1 )
+    #include <windows.h>
+#else
+    #include <dirent.h>
+#endif
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    /// a file of the directory
+    struct HRTFDatabaseFile
+    {
+        HRTFDatabaseFile()
+        : path()
+        , error()
+        , numMeasurements( 0 )
+        , numReceivers( 0 )
+        , numDataSamples( 0 )
+        , samplingRate( 0.0 )
+        , dataIR( NULL )
+        {
+        }
+
+        std::string path;
+        std::string error;              ///< empty on success
+        std::size_t numMeasurements;
+        std::size_t numReceivers;
+        std::size_t numDataSamples;
+        double samplingRate;
+        float *dataIR;                  ///< [ M R N ], in the array of the database (NULL if skipped)
+    };
+
+    static bool hasSofaExtension(const std::string &filename)
+    {
+        const std::string extension = ".sofa";
+
+        if( filename.size() <= extension.size() )
+        {
+            return false;
+        }
+
+        return sofa::String::ToLowerCase( filename.substr( filename.size() - extension.size() ) ) == extension;
+    }
+
+    /// returns false if the directory can not be read
+    static bool listSofaFiles(std::vector< std::string > &filenames, const std::string &directory)
+    {
+        filenames.clear();
+
+#if ( SOFA_WINDOWS == 1 )
+        WIN32_FIND_DATAA data;
+        const HANDLE handle = FindFirstFileA( ( directory + "\\*" ).c_str(), &data );
+
+        if( handle == INVALID_HANDLE_VALUE )
+        {
+            return false;
+        }
+
+        do
+        {
+            if( ( data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) == 0
+               && hasSofaExtension( data.cFileName ) == true )
+            {
+                filenames.push_back( data.cFileName );
+            }
+        }
+        while( FindNextFileA( handle, &data ) != 0 );
+
+        FindClose( handle );
+#else
+        DIR *dir = opendir( directory.c_str() );
+
+        if( dir == NULL )
+        {
+            return false;
+        }
+
+        for( const struct dirent *entry = readdir( dir ); entry != NULL; entry = readdir( dir ) )
+        {
+            if( entry->d_type != DT_DIR && hasSofaExtension( entry->d_name ) == true )
+            {
+                filenames.push_back( entry->d_name );
+            }
+        }
+
+        closedir( dir );
+#endif
+
+        std::sort( filenames.begin(), filenames.end() );
+
+        return true;
+    }
+
+    static bool readWholeFile(std::vector< char > &content, const std::string &path)
+    {
+        std::ifstream stream( path.c_str(), std::ios::binary | std::ios::ate );
+
+        if( stream.is_open() == false )
+        {
+            return false;
+        }
+
+        const std::streamoff size = stream.tellg();
+
+        if( size <= 0 )
+        {
+            return false;
+        }
+
+        content.resize( (std::size_t) size );
+
+        stream.seekg( 0 );
+        stream.read( &content[0], size );
+
+        return stream.good();
+    }
+
+    /// the buffers of a worker, reused from one file to the next
+    struct WorkerBuffers
+    {
+        std::vector< char > content;    ///< the file read from disk
+        std::vector< double > values;   ///< Data.IR, when stored in double precision
+    };
+
+    /// runs task( i, buffers ) for i in [ 0, numTasks [ on a pool of threads;
+    /// each worker picks the next task which is not done yet
+    template< typename Task >
+    static void runInParallel(const std::size_t numTasks, const unsigned int numThreads, const Task &task)
+    {
+        unsigned int numWorkers = ( numThreads > 0 ) ? numThreads : std::thread::hardware_concurrency();
+        numWorkers = std::max( 1u, (unsigned int) std::min( (std::size_t) numWorkers, numTasks ) );
+
+        std::atomic< std::size_t > nextTask( 0 );
+
+        const auto work = [&task, &nextTask, numTasks]()
+        {
+            WorkerBuffers buffers;
+
+            for( std::size_t i = nextTask++; i < numTasks; i = nextTask++ )
+            {
+                task( i, buffers );
+            }
+        };
+
+        std::vector< std::thread > workers;
+        for( unsigned int i = 1; i < numWorkers; i++ )
+        {
+            workers.push_back( std::thread( work ) );
+        }
+
+        work();
+
+        for( std::size_t i = 0; i < workers.size(); i++ )
+        {
+            workers[ i ].join();
+        }
+    }
+
+    /// first pass : validates the file and reads its dimensions and sampling rate
+    static void readMetadata(HRTFDatabaseFile &file)
+    {
+        /// the errors are reported to the caller
+        const sofa::Exception::ScopedLogToCerr noLogging( false );
+
+        try
+        {
+            const std::lock_guard< std::recursive_mutex > lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+            const sofa::SimpleFreeFieldHRIR hrir( file.path, sofa::NetCDFFile::OpenOptions() );
+
+            if( hrir.IsValid() == false )
+            {
+                file.error = "invalid SimpleFreeFieldHRIR file";
+                return;
+            }
+
+            file.numMeasurements = (std::size_t) hrir.GetNumMeasurements();
+            file.numReceivers    = (std::size_t) hrir.GetNumReceivers();
+            file.numDataSamples  = (std::size_t) hrir.GetNumDataSamples();
+
+            if( hrir.GetSamplingRate( file.samplingRate ) == false )
+            {
+                file.error = "invalid 'Data.SamplingRate' variable";
+                return;
+            }
+        }
+        catch( std::exception &e )
+        {
+            file.error = e.what();
+        }
+    }
+
+    /// second pass : reads the file from disk, decodes Data.IR (one file at a time),
+    /// and stores it in single precision at its place in the database
+    static void readDataIR(HRTFDatabaseFile &file, WorkerBuffers &buffers)
+    {
+        std::vector< char > &content  = buffers.content;
+        std::vector< double > &values = buffers.values;
+
+        if( readWholeFile( content, file.path ) == false )
+        {
+            file.error = "cannot read file";
+            return;
+        }
+
+        const std::size_t numValues = file.numMeasurements * file.numReceivers * file.numDataSamples;
+
+        /// the errors are reported to the caller
+        const sofa::Exception::ScopedLogToCerr noLogging( false );
+
+        try
+        {
+            bool ok = false;
+            bool isFloat = false;
+
+            {
+                const std::lock_guard< std::recursive_mutex > lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+                const sofa::SimpleFreeFieldHRIR hrir( &content[0], content.size(), file.path );
+
+                isFloat = hrir.HasVariableType( netCDF::NcType::nc_FLOAT, "Data.IR" );
+
+                if( isFloat == true )
+                {
+                    ok = hrir.GetDataIR( file.dataIR,
+                                         (unsigned long) file.numMeasurements,
+                                         (unsigned long) file.numReceivers,
+                                         (unsigned long) file.numDataSamples );
+                }
+                else
+                {
+                    values.resize( numValues );
+
+                    ok = hrir.GetDataIR( values.data(),
+                                         (unsigned long) file.numMeasurements,
+                                         (unsigned long) file.numReceivers,
+                                         (unsigned long) file.numDataSamples );
+                }
+            }
+
+            if( ok == false )
+            {
+                file.error = "invalid 'Data.IR' variable";
+                return;
+            }
+
+            /// the conversion to single precision does not need the library
+            if( isFloat == false )
+            {
+                std::copy( values.begin(), values.begin() + numValues, file.dataIR );
+            }
+        }
+        catch( std::exception &e )
+        {
+            file.error = e.what();
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : loads all the files of a directory
+ *  @param[in]      directory : path of the directory
+ *  @param[in]      numThreads : number of worker threads (0 for the number of cores)
+ *
+ *  @details        Throws an exception if the directory can not be read.
+ *                  The invalid files do not throw : they are listed by GetReports()
+ */
+/************************************************************************************/
+HRTFDatabase::HRTFDatabase(const std::string &directory_,
+                           const unsigned int numThreads)
+: directory( directory_ )
+, reports()
+, subjects()
+, numMeasurements( 0 )
+, numReceivers( 0 )
+, numDataSamples( 0 )
+, samplingRate( 0.0 )
+, dataIR()
+{
+    std::vector< std::string > filenames;
+
+    if( sofaLocal::listSofaFiles( filenames, directory ) == false )
+    {
+        SOFA_THROW( "cannot read directory : " + directory );
+    }
+
+    const bool hasSeparator = ( directory.empty() == false
+                               && ( directory[ directory.size() - 1 ] == '/' || directory[ directory.size() - 1 ] == '\\' ) );
+
+    std::vector< sofaLocal::HRTFDatabaseFile > files( filenames.size() );
+
+    for( std::size_t i = 0; i < filenames.size(); i++ )
+    {
+        files[ i ].path = hasSeparator == true ? directory + filenames[ i ] : directory + "/" + filenames[ i ];
+    }
+
+    /// the metadata of all the files gives the size of the database
+    sofaLocal::runInParallel( files.size(), numThreads, [&files](const std::size_t i, sofaLocal::WorkerBuffers &)
+    {
+        sofaLocal::readMetadata( files[ i ] );
+    } );
+
+    /// the first valid file gives the dimensions of the database
+    for( std::size_t i = 0; i < files.size(); i++ )
+    {
+        if( files[ i ].error.empty() == true )
+        {
+            numMeasurements = files[ i ].numMeasurements;
+            numReceivers    = files[ i ].numReceivers;
+            numDataSamples  = files[ i ].numDataSamples;
+            samplingRate    = files[ i ].samplingRate;
+            break;
+        }
+    }
+
+    std::vector< std::size_t > candidates;
+    for( std::size_t i = 0; i < files.size(); i++ )
+    {
+        sofaLocal::HRTFDatabaseFile &file = files[ i ];
+
+        if( file.error.empty() == true )
+        {
+            if( file.numMeasurements != numMeasurements
+               || file.numReceivers != numReceivers
+               || file.numDataSamples != numDataSamples )
+            {
+                file.error = "dimensions differ from the other files";
+            }
+            else if( file.samplingRate != samplingRate )
+            {
+                file.error = "sampling rate differs from the other files";
+            }
+            else
+            {
+                candidates.push_back( i );
+            }
+        }
+    }
+
+    /// each file is decoded straight into its place in the database
+    const std::size_t subjectSize = numMeasurements * numReceivers * numDataSamples;
+
+    dataIR.resize( candidates.size() * subjectSize );
+
+    for( std::size_t s = 0; s < candidates.size(); s++ )
+    {
+        files[ candidates[ s ] ].dataIR = dataIR.data() + s * subjectSize;
+    }
+
+    sofaLocal::runInParallel( candidates.size(), numThreads, [&files, &candidates](const std::size_t s, sofaLocal::WorkerBuffers &buffers)
+    {
+        sofaLocal::readDataIR( files[ candidates[ s ] ], buffers );
+    } );
+
+    /// the files which failed to decode are removed from the database
+    std::size_t numSubjects = 0;
+    for( std::size_t s = 0; s < candidates.size(); s++ )
+    {
+        const sofaLocal::HRTFDatabaseFile &file = files[ candidates[ s ] ];
+
+        if( file.error.empty() == true )
+        {
+            if( numSubjects != s )
+            {
+                std::copy( file.dataIR, file.dataIR + subjectSize, dataIR.data() + numSubjects * subjectSize );
+            }
+
+            subjects.push_back( candidates[ s ] );
+            numSubjects++;
+        }
+    }
+
+    dataIR.resize( numSubjects * subjectSize );
+
+    reports.resize( files.size() );
+
+    for( std::size_t i = 0; i < files.size(); i++ )
+    {
+        Report &report = reports[ i ];
+        report.filename = files[ i ].path;
+        report.loaded   = files[ i ].error.empty();
+        report.error    = files[ i ].error;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+HRTFDatabase::~HRTFDatabase()
+{
+}
+
+const std::string & HRTFDatabase::GetDirectory() const SOFA_NOEXCEPT
+{
+    return directory;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the outcome of the loading of each file of the directory,
+ *                  sorted by name
+ *
+ */
+/************************************************************************************/
+const std::vector< sofa::HRTFDatabase::Report > & HRTFDatabase::GetReports() const SOFA_NOEXCEPT
+{
+    return reports;
+}
+
+std::size_t HRTFDatabase::GetNumSubjects() const SOFA_NOEXCEPT
+{
+    return subjects.size();
+}
+
+std::size_t HRTFDatabase::GetNumMeasurements() const SOFA_NOEXCEPT
+{
+    return numMeasurements;
+}
+
+std::size_t HRTFDatabase::GetNumReceivers() const SOFA_NOEXCEPT
+{
+    return numReceivers;
+}
+
+std::size_t HRTFDatabase::GetNumDataSamples() const SOFA_NOEXCEPT
+{
+    return numDataSamples;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the sampling rate shared by all the subjects (0 if there is none)
+ *
+ */
+/************************************************************************************/
+double HRTFDatabase::GetSamplingRate() const SOFA_NOEXCEPT
+{
+    return samplingRate;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the path of the file of a subject
+ *  @param[in]      subjectIndex : index of the subject (between 0 and S-1)
+ *
+ */
+/************************************************************************************/
+const std::string & HRTFDatabase::GetSubjectFilename(const std::size_t subjectIndex) const
+{
+    SOFA_ASSERT( subjectIndex < subjects.size() );
+
+    return reports[ subjects[ subjectIndex ] ].filename;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the impulse responses of all the subjects, with dimensions [ S M R N ]
+ *
+ */
+/************************************************************************************/
+const std::vector< float > & HRTFDatabase::GetDataIR() const SOFA_NOEXCEPT
+{
+    return dataIR;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns one impulse response (N values)
+ *  @param[in]      subjectIndex : index of the subject (between 0 and S-1)
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *
+ */
+/************************************************************************************/
+const float * HRTFDatabase::GetDataIR(const std::size_t subjectIndex,
+                                      const std::size_t measurementIndex,
+                                      const std::size_t receiverIndex) const
+{
+    SOFA_ASSERT( subjectIndex < subjects.size() );
+    SOFA_ASSERT( measurementIndex < numMeasurements );
+    SOFA_ASSERT( receiverIndex < numReceivers );
+
+    return &dataIR[ ( ( subjectIndex * numMeasurements + measurementIndex ) * numReceivers + receiverIndex ) * numDataSamples ];
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the size of the impulse responses, in bytes
+ *
+ */
+/************************************************************************************/
+std::size_t HRTFDatabase::GetMemorySize() const SOFA_NOEXCEPT
+{
+    return dataIR.size() * sizeof( float );
+}
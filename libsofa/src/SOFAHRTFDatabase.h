@@ -0,0 +1,144 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAHRTFDatabase.h
+ *   @brief      Loads all the SimpleFreeFieldHRIR files of a directory
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_HRTF_DATABASE_H__
+#define _SOFA_HRTF_DATABASE_H__
+
+#include "../src/SOFAPlatform.h"
+#include <vector>
+#include <string>
+#include <cstddef>
+
+namespace sofa
+{
+
+    /************************************************************************************/
+    /*!
+     *  @class          HRTFDatabase
+     *  @brief          The impulse responses of all the SimpleFreeFieldHRIR files (*.sofa) of a
+     *                  directory, stored in one contiguous array
+     *
+     *  @details        The files are loaded by a pool of threads, in two passes. The first pass
+     *                  validates each file and reads its dimensions and sampling rate : this gives
+     *                  the size of the database, which is allocated at once. In the second pass,
+     *                  each worker picks the next file, reads it from disk, then decodes Data.IR
+     *                  straight into its place in the database.
+     *
+     *                  The netCDF library is not thread-safe : the netCDF/HDF5 reads are serialized
+     *                  with NetCDFFile::GetLibraryMutex(), and only them. The reads from disk and the
+     *                  conversion to single precision run in parallel.
+     *
+     *                  Besides the database, each worker holds one file and, if Data.IR is stored in
+     *                  double precision, one decoded Data.IR.
+     *
+     *                  Each file is validated once. The subjects are the valid files, sorted by
+     *                  name, which have the same dimensions and sampling rate as the first one.
+     *                  The other files are skipped, and the reason is given by GetReports().
+     *
+     *                  Data.IR is stored in single precision, with dimensions [ S M R N ].
+     */
+    /************************************************************************************/
+    class SOFA_API HRTFDatabase
+    {
+    public:
+        /// outcome of the loading of one file
+        struct Report
+        {
+            std::string filename;
+            bool loaded;
+            std::string error;          ///< empty if the file has been loaded
+        };
+
+    public:
+        explicit HRTFDatabase(const std::string &directory,
+                              const unsigned int numThreads = 0);
+
+        ~HRTFDatabase();
+
+        const std::string & GetDirectory() const SOFA_NOEXCEPT;
+
+        const std::vector< Report > & GetReports() const SOFA_NOEXCEPT;
+
+        std::size_t GetNumSubjects() const SOFA_NOEXCEPT;
+        std::size_t GetNumMeasurements() const SOFA_NOEXCEPT;
+        std::size_t GetNumReceivers() const SOFA_NOEXCEPT;
+        std::size_t GetNumDataSamples() const SOFA_NOEXCEPT;
+
+        double GetSamplingRate() const SOFA_NOEXCEPT;
+
+        const std::string & GetSubjectFilename(const std::size_t subjectIndex) const;
+
+        const std::vector< float > & GetDataIR() const SOFA_NOEXCEPT;
+
+        const float * GetDataIR(const std::size_t subjectIndex,
+                                const std::size_t measurementIndex,
+                                const std::size_t receiverIndex) const;
+
+        std::size_t GetMemorySize() const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        std::string directory;
+        std::vector< Report > reports;                      ///< one per file, sorted by name
+        std::vector< std::size_t > subjects;                ///< index of the report of each subject
+
+        std::size_t numMeasurements;                        ///< M
+        std::size_t numReceivers;                           ///< R
+        std::size_t numDataSamples;                         ///< N
+        double samplingRate;
+
+        std::vector< float > dataIR;                        ///< [ S M R N ]
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( HRTFDatabase );
+    };
+
+}
+
+#endif /* _SOFA_HRTF_DATABASE_H__ */
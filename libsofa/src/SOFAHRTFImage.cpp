@@ -0,0 +1,768 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAHRTFImage.cpp
+ *   @brief      Precompiled binary image of a SimpleFreeFieldHRIR file, mapped in memory
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAHRTFImage.h"
+#include "../src/SOFASimpleFreeFieldHRIR.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAHostArchitecture.h"
+#include "../src/SOFAFFT.h"
+#include <fstream>
+#include <vector>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+#include <type_traits>
+
+#if ( SOFA_WINDOWS == 1 )
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    static const char imageMagic[8]             = { 'S', 'O', 'F', 'A', 'H', 'R', 'T', 'F' };
+    static const std::uint32_t imageVersion     = 1;
+    static const std::uint32_t imageByteOrder   = 0x01020304;
+    static const std::size_t imageAlignment     = 64;       ///< in bytes
+
+    /// an array stored in the image
+    struct ImageArray
+    {
+        std::uint64_t offset;                   ///< from the beginning of the image, in bytes
+        std::uint64_t numValues;                ///< including the padding of the rows
+        std::uint32_t numDimensions;            ///< 0 if the variable is not in the file
+        std::uint32_t dimensions[3];
+        std::uint32_t coordinates;              ///< sofa::Coordinates::Type, for the positions
+        std::uint32_t units;                    ///< sofa::Units::Type, for the positions
+    };
+
+    /// the header, at the beginning of the image
+    struct ImageHeader
+    {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint64_t imageSize;                ///< in bytes
+
+        double samplingRate;
+        std::uint32_t numMeasurements;
+        std::uint32_t numReceivers;
+        std::uint32_t numDataSamples;
+        std::uint32_t fftSize;                  ///< 0 if the spectra are not exported
+
+        ImageArray dataIR;                      ///< float [ M R irStride ]
+        ImageArray dataDelay;                   ///< float [ I R ] or [ M R ]
+        ImageArray spectra;                     ///< complex float [ M R spectrumStride ]
+        ImageArray listenerPosition;            ///< float, same dimensions as in the SOFA file
+        ImageArray sourcePosition;
+        ImageArray receiverPosition;
+        ImageArray emitterPosition;
+    };
+
+    static_assert( std::is_standard_layout< ImageHeader >::value == true, "the header is written as is" );
+
+    inline std::size_t alignUp(const std::size_t value, const std::size_t alignment) SOFA_NOEXCEPT
+    {
+        return ( ( value + alignment - 1 ) / alignment ) * alignment;
+    }
+
+    /// number of floats of a row of size, padded to the alignment
+    template< typename Type >
+    inline std::size_t getStride(const std::size_t size) SOFA_NOEXCEPT
+    {
+        return alignUp( size * sizeof( Type ), imageAlignment ) / sizeof( Type );
+    }
+
+    /// reads a position variable (if it exists in the file) and reserves its array in the image
+    inline void readPosition(sofaLocal::ImageArray &array,
+                             std::vector< float > &values,
+                             std::size_t &offset,
+                             const sofa::File &file,
+                             const std::string &variableName,
+                             const sofa::Coordinates::Type coordinates,
+                             const sofa::Units::Type units)
+    {
+        std::memset( &array, 0, sizeof( ImageArray ) );
+
+        array.coordinates   = (std::uint32_t) coordinates;
+        array.units         = (std::uint32_t) units;
+
+        values.clear();
+
+        if( file.HasVariable( variableName ) == false )
+        {
+            return;
+        }
+
+        std::vector< std::size_t > dimensions;
+        file.GetVariableDimensions( dimensions, variableName );
+
+        if( dimensions.size() > 3 || file.GetValues( values, variableName ) == false )
+        {
+            SOFA_THROW( "invalid '" + variableName + "' variable" );
+        }
+
+        array.numDimensions = (std::uint32_t) dimensions.size();
+
+        for( std::size_t i = 0; i < dimensions.size(); i++ )
+        {
+            array.dimensions[i] = (std::uint32_t) dimensions[i];
+        }
+
+        array.offset    = offset;
+        array.numValues = values.size();
+
+        offset = alignUp( offset + values.size() * sizeof( float ), imageAlignment );
+    }
+
+    /// checks that an array lies within the image, and returns its address
+    template< typename Type >
+    inline const Type * getArray(const unsigned char *image,
+                                 const std::size_t imageSize,
+                                 const sofaLocal::ImageArray &array,
+                                 const std::size_t expectedNumValues)
+    {
+        if( array.numValues != expectedNumValues
+           || array.offset % imageAlignment != 0
+           || array.offset > imageSize
+           || array.numValues > ( imageSize - array.offset ) / sizeof( Type ) )
+        {
+            SOFA_THROW( "corrupted HRTF image" );
+            return NULL;
+        }
+
+        return reinterpret_cast< const Type * >( image + array.offset );
+    }
+
+    inline void getPosition(sofa::HRTFImage::Position &position,
+                            const unsigned char *image,
+                            const std::size_t imageSize,
+                            const sofaLocal::ImageArray &array)
+    {
+        if( array.numDimensions > 3 )
+        {
+            SOFA_THROW( "corrupted HRTF image" );
+        }
+
+        std::size_t numValues = ( array.numDimensions > 0 ) ? 1 : 0;
+
+        position.numDimensions = array.numDimensions;
+
+        for( std::size_t i = 0; i < 3; i++ )
+        {
+            position.dimensions[i] = ( i < array.numDimensions ) ? array.dimensions[i] : 0;
+
+            if( i < array.numDimensions )
+            {
+                numValues *= array.dimensions[i];
+            }
+        }
+
+        position.values         = ( numValues > 0 ) ? getArray< float >( image, imageSize, array, numValues ) : NULL;
+        position.coordinates    = (sofa::Coordinates::Type) array.coordinates;
+        position.units          = (sofa::Units::Type) array.units;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Writes the binary image of a SimpleFreeFieldHRIR file
+ *  @param[in]      path : path of the image to write
+ *  @param[in]      file : a valid SimpleFreeFieldHRIR file
+ *  @param[in]      fftSize : size of the transform of the impulse responses
+ *                  (a power of 2, at least Data.IR's length), or 0 to export the time domain only
+ *
+ *  @details        Throws an exception if the file is not valid, or the image can not be written.
+ *                  The image is written to "<path>.tmp", then renamed to path, so that the
+ *                  images already mapped stay intact
+ */
+/************************************************************************************/
+void HRTFImage::Export(const std::string &path,
+                       const sofa::SimpleFreeFieldHRIR &file,
+                       const std::size_t fftSize)
+{
+    if( file.IsValid() == false )
+    {
+        SOFA_THROW( "invalid SimpleFreeFieldHRIR file : " + file.GetFilename() );
+    }
+
+    const std::size_t M = (std::size_t) file.GetNumMeasurements();
+    const std::size_t R = (std::size_t) file.GetNumReceivers();
+    const std::size_t N = (std::size_t) file.GetNumDataSamples();
+
+    if( fftSize != 0 && ( fftSize < N || fftSize < 2 || ( fftSize & ( fftSize - 1 ) ) != 0 ) )
+    {
+        SOFA_THROW( "the FFT size must be a power of 2, at least the length of the impulse responses" );
+    }
+
+    sofaLocal::ImageHeader header;
+    std::memset( &header, 0, sizeof( sofaLocal::ImageHeader ) );
+
+    std::memcpy( header.magic, sofaLocal::imageMagic, sizeof( header.magic ) );
+    header.version          = sofaLocal::imageVersion;
+    header.byteOrder        = sofaLocal::imageByteOrder;
+    header.numMeasurements  = (std::uint32_t) M;
+    header.numReceivers     = (std::uint32_t) R;
+    header.numDataSamples   = (std::uint32_t) N;
+    header.fftSize          = (std::uint32_t) fftSize;
+
+    if( file.GetSamplingRate( header.samplingRate ) == false )
+    {
+        SOFA_THROW( "invalid 'Data.SamplingRate' variable" );
+    }
+
+    std::vector< float > impulseResponses;
+    std::vector< float > delays;
+
+    if( file.GetDataIR( impulseResponses ) == false || impulseResponses.size() != M * R * N )
+    {
+        SOFA_THROW( "invalid 'Data.IR' variable" );
+    }
+
+    if( file.GetDataDelay( delays ) == false )
+    {
+        SOFA_THROW( "invalid 'Data.Delay' variable" );
+    }
+
+    /// layout of the image
+    std::size_t offset = sofaLocal::alignUp( sizeof( sofaLocal::ImageHeader ), sofaLocal::imageAlignment );
+
+    const std::size_t irStride = sofaLocal::getStride< float >( N );
+
+    header.dataIR.offset        = offset;
+    header.dataIR.numValues     = M * R * irStride;
+    header.dataIR.numDimensions = 3;
+    header.dataIR.dimensions[0] = (std::uint32_t) M;
+    header.dataIR.dimensions[1] = (std::uint32_t) R;
+    header.dataIR.dimensions[2] = (std::uint32_t) irStride;
+    offset = sofaLocal::alignUp( offset + header.dataIR.numValues * sizeof( float ), sofaLocal::imageAlignment );
+
+    header.dataDelay.offset         = offset;
+    header.dataDelay.numValues      = delays.size();
+    header.dataDelay.numDimensions  = 2;
+    header.dataDelay.dimensions[0]  = (std::uint32_t) ( ( R > 0 ) ? delays.size() / R : 0 );
+    header.dataDelay.dimensions[1]  = (std::uint32_t) R;
+    offset = sofaLocal::alignUp( offset + delays.size() * sizeof( float ), sofaLocal::imageAlignment );
+
+    const std::size_t numBins           = ( fftSize > 0 ) ? fftSize / 2 + 1 : 0;
+    const std::size_t spectrumStride    = sofaLocal::getStride< Complex >( numBins );
+
+    if( fftSize > 0 )
+    {
+        header.spectra.offset           = offset;
+        header.spectra.numValues        = M * R * spectrumStride;
+        header.spectra.numDimensions    = 3;
+        header.spectra.dimensions[0]    = (std::uint32_t) M;
+        header.spectra.dimensions[1]    = (std::uint32_t) R;
+        header.spectra.dimensions[2]    = (std::uint32_t) spectrumStride;
+        offset = sofaLocal::alignUp( offset + header.spectra.numValues * sizeof( Complex ), sofaLocal::imageAlignment );
+    }
+
+    std::vector< float > listener, source, receiver, emitter;
+
+    {
+        sofa::Coordinates::Type coordinates = sofa::Coordinates::kCartesian;
+        sofa::Units::Type units             = sofa::Units::kMeter;
+
+        file.GetListenerPosition( coordinates, units );
+        sofaLocal::readPosition( header.listenerPosition, listener, offset, file, "ListenerPosition", coordinates, units );
+
+        file.GetSourcePosition( coordinates, units );
+        sofaLocal::readPosition( header.sourcePosition, source, offset, file, "SourcePosition", coordinates, units );
+
+        file.GetReceiverPosition( coordinates, units );
+        sofaLocal::readPosition( header.receiverPosition, receiver, offset, file, "ReceiverPosition", coordinates, units );
+
+        file.GetEmitterPosition( coordinates, units );
+        sofaLocal::readPosition( header.emitterPosition, emitter, offset, file, "EmitterPosition", coordinates, units );
+    }
+
+    header.imageSize = offset;
+
+    /// the image is assembled in memory, then written at once
+    std::vector< unsigned char > image( offset, 0 );
+
+    std::memcpy( &image[0], &header, sizeof( sofaLocal::ImageHeader ) );
+
+    for( std::size_t i = 0; i < M * R; i++ )
+    {
+        std::memcpy( &image[ header.dataIR.offset + i * irStride * sizeof( float ) ],
+                     &impulseResponses[ i * N ],
+                     N * sizeof( float ) );
+    }
+
+    if( delays.empty() == false )
+    {
+        std::memcpy( &image[ header.dataDelay.offset ], &delays[0], delays.size() * sizeof( float ) );
+    }
+
+    if( fftSize > 0 )
+    {
+        sofa::FFT< float > fft( fftSize );
+        std::vector< float > padded( fftSize, 0.0f );
+        std::vector< Complex > spectrum( numBins );
+
+        for( std::size_t i = 0; i < M * R; i++ )
+        {
+            std::copy( impulseResponses.begin() + i * N, impulseResponses.begin() + ( i + 1 ) * N, padded.begin() );
+
+            fft.Forward( &padded[0], &spectrum[0] );
+
+            std::memcpy( &image[ header.spectra.offset + i * spectrumStride * sizeof( Complex ) ],
+                         &spectrum[0],
+                         numBins * sizeof( Complex ) );
+        }
+    }
+
+    const sofaLocal::ImageArray * const arrays[] = { &header.listenerPosition, &header.sourcePosition, &header.receiverPosition, &header.emitterPosition };
+    const std::vector< float > * const values[] = { &listener, &source, &receiver, &emitter };
+
+    for( std::size_t i = 0; i < 4; i++ )
+    {
+        if( values[i]->empty() == false )
+        {
+            std::memcpy( &image[ arrays[i]->offset ], &(*values[i])[0], values[i]->size() * sizeof( float ) );
+        }
+    }
+
+    /// the image is written under a temporary name, then renamed : a reader mapping
+    /// the former image keeps it, and never sees a truncated or partial one
+    const std::string temporaryPath = path + ".tmp";
+
+    {
+        std::ofstream output( temporaryPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+
+        if( output.is_open() == false )
+        {
+            SOFA_THROW( "cannot write file : " + path );
+        }
+
+        output.write( reinterpret_cast< const char * >( &image[0] ), (std::streamsize) image.size() );
+        output.close();
+
+        if( output.good() == false )
+        {
+            std::remove( temporaryPath.c_str() );
+            SOFA_THROW( "cannot write file : " + path );
+        }
+    }
+
+    if( std::rename( temporaryPath.c_str(), path.c_str() ) != 0 )
+    {
+        /// on Windows, rename does not replace an existing file
+        std::remove( path.c_str() );
+
+        if( std::rename( temporaryPath.c_str(), path.c_str() ) != 0 )
+        {
+            std::remove( temporaryPath.c_str() );
+            SOFA_THROW( "cannot write file : " + path );
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Maps a binary image in memory
+ *  @param[in]      path : path of an image written by Export()
+ *
+ *  @details        Throws an exception if the image can not be mapped, has been written
+ *                  by another version or on a machine with another byte order, or is corrupted
+ */
+/************************************************************************************/
+HRTFImage::HRTFImage(const std::string &path)
+: image( NULL )
+, imageSize( 0 )
+, fileHandle( NULL )
+, mappingHandle( NULL )
+, numMeasurements( 0 )
+, numReceivers( 0 )
+, numDataSamples( 0 )
+, samplingRate( 0.0 )
+, impulseResponses( NULL )
+, irStride( 0 )
+, delays( NULL )
+, numDelays( 0 )
+, spectra( NULL )
+, fftSize( 0 )
+, spectrumStride( 0 )
+, listenerPosition()
+, sourcePosition()
+, receiverPosition()
+, emitterPosition()
+{
+    map( path );
+
+    try
+    {
+        parse();
+    }
+    catch( ... )
+    {
+        unmap();
+        throw;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor : unmaps the image
+ *
+ */
+/************************************************************************************/
+HRTFImage::~HRTFImage()
+{
+    unmap();
+}
+
+void HRTFImage::map(const std::string &path)
+{
+#if ( SOFA_WINDOWS == 1 )
+    HANDLE file = CreateFileA( path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+
+    if( file == INVALID_HANDLE_VALUE )
+    {
+        SOFA_THROW( "cannot open file : " + path );
+    }
+
+    LARGE_INTEGER size;
+
+    if( GetFileSizeEx( file, &size ) == FALSE || size.QuadPart < (LONGLONG) sizeof( sofaLocal::ImageHeader ) )
+    {
+        CloseHandle( file );
+        SOFA_THROW( "invalid HRTF image : " + path );
+    }
+
+    HANDLE mapping = CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+    const void *view = ( mapping != NULL ) ? MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) : NULL;
+
+    if( view == NULL )
+    {
+        if( mapping != NULL )
+        {
+            CloseHandle( mapping );
+        }
+        CloseHandle( file );
+        SOFA_THROW( "cannot map file : " + path );
+    }
+
+    fileHandle      = file;
+    mappingHandle   = mapping;
+    image           = static_cast< const unsigned char * >( view );
+    imageSize       = (std::size_t) size.QuadPart;
+#else
+    const int file = open( path.c_str(), O_RDONLY );
+
+    if( file < 0 )
+    {
+        SOFA_THROW( "cannot open file : " + path );
+    }
+
+    struct stat status;
+
+    if( fstat( file, &status ) != 0 || status.st_size < (off_t) sizeof( sofaLocal::ImageHeader ) )
+    {
+        close( file );
+        SOFA_THROW( "invalid HRTF image : " + path );
+    }
+
+    void *view = mmap( NULL, (std::size_t) status.st_size, PROT_READ, MAP_PRIVATE, file, 0 );
+
+    /// the mapping remains valid once the file is closed
+    close( file );
+
+    if( view == MAP_FAILED )
+    {
+        SOFA_THROW( "cannot map file : " + path );
+    }
+
+    image       = static_cast< const unsigned char * >( view );
+    imageSize   = (std::size_t) status.st_size;
+#endif
+}
+
+void HRTFImage::unmap() SOFA_NOEXCEPT
+{
+    if( image == NULL )
+    {
+        return;
+    }
+
+#if ( SOFA_WINDOWS == 1 )
+    UnmapViewOfFile( image );
+    CloseHandle( static_cast< HANDLE >( mappingHandle ) );
+    CloseHandle( static_cast< HANDLE >( fileHandle ) );
+
+    mappingHandle   = NULL;
+    fileHandle      = NULL;
+#else
+    munmap( const_cast< unsigned char * >( image ), imageSize );
+#endif
+
+    image       = NULL;
+    imageSize   = 0;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Checks the header of the image, and locates all the arrays
+ *
+ */
+/************************************************************************************/
+void HRTFImage::parse()
+{
+    const sofaLocal::ImageHeader &header = *reinterpret_cast< const sofaLocal::ImageHeader * >( image );
+
+    if( std::memcmp( header.magic, sofaLocal::imageMagic, sizeof( header.magic ) ) != 0 )
+    {
+        SOFA_THROW( "not an HRTF image" );
+    }
+
+    if( header.byteOrder != sofaLocal::imageByteOrder )
+    {
+        SOFA_THROW( "the HRTF image has been written with another byte order" );
+    }
+
+    if( header.version != sofaLocal::imageVersion )
+    {
+        SOFA_THROW( "unsupported version of HRTF image" );
+    }
+
+    if( header.imageSize != imageSize )
+    {
+        SOFA_THROW( "truncated HRTF image" );
+    }
+
+    numMeasurements = header.numMeasurements;
+    numReceivers    = header.numReceivers;
+    numDataSamples  = header.numDataSamples;
+    samplingRate    = header.samplingRate;
+
+    irStride            = sofaLocal::getStride< float >( numDataSamples );
+    impulseResponses    = sofaLocal::getArray< float >( image, imageSize, header.dataIR, numMeasurements * numReceivers * irStride );
+
+    numDelays   = (std::size_t) header.dataDelay.numValues;
+    delays      = sofaLocal::getArray< float >( image, imageSize, header.dataDelay, numDelays );
+
+    fftSize = header.fftSize;
+
+    if( fftSize > 0 )
+    {
+        spectrumStride  = sofaLocal::getStride< Complex >( GetNumBins() );
+        spectra         = sofaLocal::getArray< Complex >( image, imageSize, header.spectra, numMeasurements * numReceivers * spectrumStride );
+    }
+
+    sofaLocal::getPosition( listenerPosition, image, imageSize, header.listenerPosition );
+    sofaLocal::getPosition( sourcePosition, image, imageSize, header.sourcePosition );
+    sofaLocal::getPosition( receiverPosition, image, imageSize, header.receiverPosition );
+    sofaLocal::getPosition( emitterPosition, image, imageSize, header.emitterPosition );
+}
+
+std::size_t HRTFImage::GetNumMeasurements() const SOFA_NOEXCEPT
+{
+    return numMeasurements;
+}
+
+std::size_t HRTFImage::GetNumReceivers() const SOFA_NOEXCEPT
+{
+    return numReceivers;
+}
+
+std::size_t HRTFImage::GetNumDataSamples() const SOFA_NOEXCEPT
+{
+    return numDataSamples;
+}
+
+double HRTFImage::GetSamplingRate() const SOFA_NOEXCEPT
+{
+    return samplingRate;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns one impulse response (N samples, 64-bytes aligned),
+ *                  or NULL if the indices are out of range
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *
+ */
+/************************************************************************************/
+const float * HRTFImage::GetDataIR(const std::size_t measurementIndex,
+                                   const std::size_t receiverIndex) const SOFA_NOEXCEPT
+{
+    if( measurementIndex >= numMeasurements || receiverIndex >= numReceivers )
+    {
+        return NULL;
+    }
+
+    return impulseResponses + ( measurementIndex * numReceivers + receiverIndex ) * irStride;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the distance between two consecutive impulse responses,
+ *                  in samples (N rounded up to the alignment)
+ *
+ */
+/************************************************************************************/
+std::size_t HRTFImage::GetDataIRStride() const SOFA_NOEXCEPT
+{
+    return irStride;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the delay of a measurement and receiver, in samples
+ *  @param[in]      measurementIndex : index of the measurement (ignored if Data.Delay is [ I R ])
+ *  @param[in]      receiverIndex : index of the receiver
+ *
+ */
+/************************************************************************************/
+float HRTFImage::GetDataDelay(const std::size_t measurementIndex,
+                              const std::size_t receiverIndex) const SOFA_NOEXCEPT
+{
+    if( receiverIndex >= numReceivers )
+    {
+        return 0.0f;
+    }
+
+    if( numDelays == numMeasurements * numReceivers && measurementIndex < numMeasurements )
+    {
+        return delays[ measurementIndex * numReceivers + receiverIndex ];
+    }
+    else if( numDelays == numReceivers )
+    {
+        return delays[ receiverIndex ];
+    }
+    else
+    {
+        return 0.0f;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if the spectra of the impulse responses have been exported
+ *
+ */
+/************************************************************************************/
+bool HRTFImage::HasSpectra() const SOFA_NOEXCEPT
+{
+    return ( spectra != NULL );
+}
+
+std::size_t HRTFImage::GetFFTSize() const SOFA_NOEXCEPT
+{
+    return fftSize;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of bins of a spectrum (fftSize/2 + 1), or 0
+ *
+ */
+/************************************************************************************/
+std::size_t HRTFImage::GetNumBins() const SOFA_NOEXCEPT
+{
+    return ( fftSize > 0 ) ? fftSize / 2 + 1 : 0;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the spectrum of one impulse response (zero-padded to the FFT size),
+ *                  or NULL if the spectra have not been exported or the indices are out of range
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *
+ */
+/************************************************************************************/
+const sofa::HRTFImage::Complex * HRTFImage::GetSpectrum(const std::size_t measurementIndex,
+                                                        const std::size_t receiverIndex) const SOFA_NOEXCEPT
+{
+    if( spectra == NULL || measurementIndex >= numMeasurements || receiverIndex >= numReceivers )
+    {
+        return NULL;
+    }
+
+    return spectra + ( measurementIndex * numReceivers + receiverIndex ) * spectrumStride;
+}
+
+const sofa::HRTFImage::Position & HRTFImage::GetListenerPosition() const SOFA_NOEXCEPT
+{
+    return listenerPosition;
+}
+
+const sofa::HRTFImage::Position & HRTFImage::GetSourcePosition() const SOFA_NOEXCEPT
+{
+    return sourcePosition;
+}
+
+const sofa::HRTFImage::Position & HRTFImage::GetReceiverPosition() const SOFA_NOEXCEPT
+{
+    return receiverPosition;
+}
+
+const sofa::HRTFImage::Position & HRTFImage::GetEmitterPosition() const SOFA_NOEXCEPT
+{
+    return emitterPosition;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the size of the mapped image, in bytes
+ *
+ */
+/************************************************************************************/
+std::size_t HRTFImage::GetImageSize() const SOFA_NOEXCEPT
+{
+    return imageSize;
+}
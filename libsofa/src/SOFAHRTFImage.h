@@ -0,0 +1,182 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAHRTFImage.h
+ *   @brief      Precompiled binary image of a SimpleFreeFieldHRIR file, mapped in memory
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_HRTF_IMAGE_H__
+#define _SOFA_HRTF_IMAGE_H__
+
+#include "../src/SOFACoordinates.h"
+#include "../src/SOFAUnits.h"
+#include <string>
+#include <complex>
+#include <cstddef>
+
+namespace sofa
+{
+    class SimpleFreeFieldHRIR;
+
+    /************************************************************************************/
+    /*!
+     *  @class          HRTFImage
+     *  @brief          Read-only access to a binary image of a SimpleFreeFieldHRIR file
+     *
+     *  @details        Opening a SOFA file goes through HDF5 (decompression, metadata...),
+     *                  which takes tens of milliseconds. Export() writes the data needed for
+     *                  rendering into a flat binary image : a versioned header, the positions,
+     *                  Data.Delay and Data.IR in single precision, and optionally the spectra
+     *                  of the impulse responses.
+     *
+     *                  The constructor maps the image in memory : nothing is read or copied
+     *                  until the data is accessed, and the pages are shared between all the
+     *                  processes using the same image. The accessors are those of sofa::Dataset,
+     *                  and return pointers to the mapped memory.
+     *
+     *                  All the arrays start on a 64-bytes boundary, and so does each impulse
+     *                  response (and each spectrum) : the rows are padded with zeros.
+     *                  The image uses the byte order of the machine that exported it;
+     *                  it can not be opened on a machine with a different byte order.
+     *
+     *                  An HRTFImage is immutable and can be shared between threads.
+     */
+    /************************************************************************************/
+    class SOFA_API HRTFImage
+    {
+    public:
+        typedef std::complex< float > Complex;
+
+        /// values of a position variable, with its coordinates system and units
+        struct Position
+        {
+            const float *values;                    ///< NULL if the variable is not in the file
+            std::size_t dimensions[3];
+            std::size_t numDimensions;
+            sofa::Coordinates::Type coordinates;
+            sofa::Units::Type units;
+        };
+
+    public:
+        static void Export(const std::string &path,
+                           const sofa::SimpleFreeFieldHRIR &file,
+                           const std::size_t fftSize = 0);
+
+    public:
+        explicit HRTFImage(const std::string &path);
+        ~HRTFImage();
+
+        std::size_t GetNumMeasurements() const SOFA_NOEXCEPT;
+        std::size_t GetNumReceivers() const SOFA_NOEXCEPT;
+        std::size_t GetNumDataSamples() const SOFA_NOEXCEPT;
+
+        double GetSamplingRate() const SOFA_NOEXCEPT;
+
+        //==============================================================================
+        const float * GetDataIR(const std::size_t measurementIndex,
+                                const std::size_t receiverIndex) const SOFA_NOEXCEPT;
+
+        std::size_t GetDataIRStride() const SOFA_NOEXCEPT;
+
+        float GetDataDelay(const std::size_t measurementIndex,
+                           const std::size_t receiverIndex) const SOFA_NOEXCEPT;
+
+        //==============================================================================
+        bool HasSpectra() const SOFA_NOEXCEPT;
+        std::size_t GetFFTSize() const SOFA_NOEXCEPT;
+        std::size_t GetNumBins() const SOFA_NOEXCEPT;
+
+        const Complex * GetSpectrum(const std::size_t measurementIndex,
+                                    const std::size_t receiverIndex) const SOFA_NOEXCEPT;
+
+        //==============================================================================
+        const Position & GetListenerPosition() const SOFA_NOEXCEPT;
+        const Position & GetSourcePosition() const SOFA_NOEXCEPT;
+        const Position & GetReceiverPosition() const SOFA_NOEXCEPT;
+        const Position & GetEmitterPosition() const SOFA_NOEXCEPT;
+
+        //==============================================================================
+        std::size_t GetImageSize() const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        void map(const std::string &path);
+        void unmap() SOFA_NOEXCEPT;
+        void parse();
+
+    private:
+        //==============================================================================
+        const unsigned char *image;                 ///< the mapped file
+        std::size_t imageSize;                      ///< in bytes
+        void *fileHandle;                           ///< only used on Windows
+        void *mappingHandle;                        ///< only used on Windows
+
+        std::size_t numMeasurements;                ///< M
+        std::size_t numReceivers;                   ///< R
+        std::size_t numDataSamples;                 ///< N
+        double samplingRate;
+
+        const float *impulseResponses;              ///< Data.IR [ M R irStride ]
+        std::size_t irStride;                       ///< N rounded up to the alignment
+
+        const float *delays;                        ///< Data.Delay [ I R ] or [ M R ]
+        std::size_t numDelays;                      ///< number of values in Data.Delay
+
+        const Complex *spectra;                     ///< [ M R spectrumStride ], NULL if not exported
+        std::size_t fftSize;
+        std::size_t spectrumStride;                 ///< number of bins rounded up to the alignment
+
+        Position listenerPosition;
+        Position sourcePosition;
+        Position receiverPosition;
+        Position emitterPosition;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( HRTFImage );
+    };
+
+}
+
+#endif /* _SOFA_HRTF_IMAGE_H__ */
@@ -0,0 +1,439 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAHRTFSpectra.cpp
+ *   @brief      Precomputed spectra of the impulse responses of a SOFA file
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAHRTFSpectra.h"
+#include "../src/SOFASimpleFreeFieldHRIR.h"
+#include "../src/SOFASimpleHeadphoneIR.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAFFT.h"
+#include "../src/SOFACacheFile.h"
+#include <algorithm>
+#include <sstream>
+#include <cstring>
+#include <cstdint>
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    static const char spectraMagic[8]           = { 'S', 'O', 'F', 'A', 'S', 'P', 'E', 'C' };
+    static const std::uint32_t spectraVersion   = 1;
+    static const std::size_t spectraAlignment   = 64;       ///< in bytes
+
+    /// the layout of a spectra file, followed by the spectra [ M R P stride ]
+    struct SpectraLayout
+    {
+        std::uint32_t numMeasurements;
+        std::uint32_t numReceivers;
+        std::uint32_t numDataSamples;
+        std::uint32_t blockSize;
+        std::uint32_t numPartitions;
+        std::uint32_t stride;
+    };
+
+    static SpectraLayout makeLayout(const std::size_t numMeasurements,
+                                    const std::size_t numReceivers,
+                                    const std::size_t numDataSamples,
+                                    const std::size_t blockSize,
+                                    const std::size_t numPartitions,
+                                    const std::size_t stride) SOFA_NOEXCEPT
+    {
+        SpectraLayout layout;
+        std::memset( &layout, 0, sizeof( SpectraLayout ) );
+
+        layout.numMeasurements  = (std::uint32_t) numMeasurements;
+        layout.numReceivers     = (std::uint32_t) numReceivers;
+        layout.numDataSamples   = (std::uint32_t) numDataSamples;
+        layout.blockSize        = (std::uint32_t) blockSize;
+        layout.numPartitions    = (std::uint32_t) numPartitions;
+        layout.stride           = (std::uint32_t) stride;
+
+        return layout;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the path of the spectra file of a SOFA file, for a given block size
+ *                  (e.g. "subject_003.sofa.256.spectra")
+ *
+ */
+/************************************************************************************/
+std::string HRTFSpectra::GetSpectraFilename(const std::string &sofaFilename,
+                                            const std::size_t blockSize)
+{
+    std::ostringstream filename;
+    filename << sofaFilename << "." << blockSize << ".spectra";
+
+    return filename.str();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes (or reads) the spectra of a SimpleFreeFieldHRIR file
+ *  @param[in]      file : a valid SimpleFreeFieldHRIR file
+ *  @param[in]      blockSize : size of the partitions (power of 2)
+ *  @param[in]      useSpectraFile : if true, the spectra are read from the spectra file if it
+ *                  is up to date; otherwise they are computed, and the spectra file is written
+ *
+ *  @details        Throws an exception if the file is not valid or the block size is invalid.
+ *                  Failing to write the spectra file (e.g. in a read-only directory) is not an error
+ */
+/************************************************************************************/
+HRTFSpectra::HRTFSpectra(const sofa::SimpleFreeFieldHRIR &file,
+                         const std::size_t blockSize_,
+                         const bool useSpectraFile)
+: blockSize( blockSize_ )
+, numMeasurements( 0 )
+, numReceivers( 0 )
+, numDataSamples( 0 )
+, numPartitions( 0 )
+, stride( 0 )
+, sofaFileSize( 0 )
+, sofaModificationTime( 0 )
+, storage()
+, spectra( NULL )
+, loadedFromSpectraFile( false )
+{
+    if( file.IsValid() == false )
+    {
+        SOFA_THROW( "invalid SimpleFreeFieldHRIR file : " + file.GetFilename() );
+    }
+
+    initialize( file, useSpectraFile );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes (or reads) the spectra of a SimpleHeadphoneIR file
+ *  @param[in]      file : a valid SimpleHeadphoneIR file
+ *  @param[in]      blockSize : size of the partitions (power of 2)
+ *  @param[in]      useSpectraFile : if true, the spectra are read from the spectra file if it
+ *                  is up to date; otherwise they are computed, and the spectra file is written
+ *
+ *  @details        Throws an exception if the file is not valid or the block size is invalid.
+ *                  Failing to write the spectra file (e.g. in a read-only directory) is not an error
+ */
+/************************************************************************************/
+HRTFSpectra::HRTFSpectra(const sofa::SimpleHeadphoneIR &file,
+                         const std::size_t blockSize_,
+                         const bool useSpectraFile)
+: blockSize( blockSize_ )
+, numMeasurements( 0 )
+, numReceivers( 0 )
+, numDataSamples( 0 )
+, numPartitions( 0 )
+, stride( 0 )
+, sofaFileSize( 0 )
+, sofaModificationTime( 0 )
+, storage()
+, spectra( NULL )
+, loadedFromSpectraFile( false )
+{
+    if( file.IsValid() == false )
+    {
+        SOFA_THROW( "invalid SimpleHeadphoneIR file : " + file.GetFilename() );
+    }
+
+    initialize( file, useSpectraFile );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+HRTFSpectra::~HRTFSpectra()
+{
+}
+
+void HRTFSpectra::initialize(const sofa::File &file, const bool useSpectraFile)
+{
+    if( blockSize == 0 || ( blockSize & ( blockSize - 1 ) ) != 0 )
+    {
+        SOFA_THROW( "invalid block size (should be a power of 2)" );
+    }
+
+    numMeasurements = (std::size_t) file.GetNumMeasurements();
+    numReceivers    = (std::size_t) file.GetNumReceivers();
+    numDataSamples  = (std::size_t) file.GetNumDataSamples();
+
+    /// even an empty impulse response gets one partition
+    numPartitions   = std::max( ( numDataSamples + blockSize - 1 ) / blockSize, (std::size_t) 1 );
+
+    const std::size_t numBinsPerLine = sofaLocal::spectraAlignment / sizeof( Complex );
+    stride          = ( ( GetNumBins() + numBinsPerLine - 1 ) / numBinsPerLine ) * numBinsPerLine;
+
+    allocate();
+
+    const std::string spectraFilename = GetSpectraFilename( file.GetFilename(), blockSize );
+
+    const bool hasStatus = sofa::CacheFile::GetFileStatus( sofaFileSize, sofaModificationTime, file.GetFilename() );
+
+    if( useSpectraFile == true && hasStatus == true && load( spectraFilename ) == true )
+    {
+        loadedFromSpectraFile = true;
+        return;
+    }
+
+    std::vector< float > impulseResponses;
+
+    if( file.GetValues( impulseResponses, "Data.IR" ) == false
+       || impulseResponses.size() != numMeasurements * numReceivers * numDataSamples )
+    {
+        SOFA_THROW( "invalid 'Data.IR' variable" );
+    }
+
+    computeSpectra( impulseResponses );
+
+    if( useSpectraFile == true && hasStatus == true )
+    {
+        Save( spectraFilename );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Allocates the (zeroed) storage, and aligns the spectra
+ *
+ */
+/************************************************************************************/
+void HRTFSpectra::allocate()
+{
+    const std::size_t numValues = numMeasurements * numReceivers * numPartitions * stride;
+    const std::size_t padding   = sofaLocal::spectraAlignment / sizeof( Complex );
+
+    storage.assign( numValues + padding, Complex( 0.0f, 0.0f ) );
+
+    const std::uintptr_t address    = reinterpret_cast< std::uintptr_t >( &storage[0] );
+    const std::uintptr_t misalign   = address % sofaLocal::spectraAlignment;
+
+    /// std::complex< float > is 8-bytes aligned : the offset is a whole number of elements
+    const std::size_t offset = ( misalign == 0 ) ? 0 : ( sofaLocal::spectraAlignment - misalign ) / sizeof( Complex );
+
+    spectra = &storage[ offset ];
+}
+
+void HRTFSpectra::computeSpectra(const std::vector< float > &impulseResponses)
+{
+    sofa::FFT< float > fft( GetFFTSize() );
+    std::vector< float > buffer( GetFFTSize() );
+
+    for( std::size_t i = 0; i < numMeasurements * numReceivers; i++ )
+    {
+        const float *impulseResponse = &impulseResponses[ i * numDataSamples ];
+
+        for( std::size_t p = 0; p < numPartitions; p++ )
+        {
+            const std::size_t start = p * blockSize;
+
+            /// the partition is zero-padded to twice its size (overlap-save)
+            std::fill( buffer.begin(), buffer.end(), 0.0f );
+
+            for( std::size_t n = 0; n < blockSize && start + n < numDataSamples; n++ )
+            {
+                buffer[n] = impulseResponse[ start + n ];
+            }
+
+            fft.Forward( &buffer[0], spectra + ( i * numPartitions + p ) * stride );
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Writes the spectra file
+ *  @param[in]      path : path of the file to write (see GetSpectraFilename())
+ *
+ *  @details        The file is replaced atomically (see CacheFile::Write()).
+ *                  Returns false if the file can not be written
+ */
+/************************************************************************************/
+bool HRTFSpectra::Save(const std::string &path) const
+{
+    const sofa::CacheFile::Header header = sofa::CacheFile::MakeHeader( sofaLocal::spectraMagic,
+                                                                        sofaLocal::spectraVersion,
+                                                                        sofaFileSize,
+                                                                        sofaModificationTime );
+
+    const sofaLocal::SpectraLayout layout = sofaLocal::makeLayout( numMeasurements,
+                                                                   numReceivers,
+                                                                   numDataSamples,
+                                                                   blockSize,
+                                                                   numPartitions,
+                                                                   stride );
+
+    const sofa::CacheFile::ConstBlock block =
+    {
+        spectra,
+        numMeasurements * numReceivers * numPartitions * stride * sizeof( Complex )
+    };
+
+    return sofa::CacheFile::Write( path, header, &layout, sizeof( sofaLocal::SpectraLayout ), &block, 1 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads the spectra file, if it matches the SOFA file and the layout
+ *
+ */
+/************************************************************************************/
+bool HRTFSpectra::load(const std::string &path)
+{
+    const sofa::CacheFile::Header header = sofa::CacheFile::MakeHeader( sofaLocal::spectraMagic,
+                                                                        sofaLocal::spectraVersion,
+                                                                        sofaFileSize,
+                                                                        sofaModificationTime );
+
+    const sofaLocal::SpectraLayout layout = sofaLocal::makeLayout( numMeasurements,
+                                                                   numReceivers,
+                                                                   numDataSamples,
+                                                                   blockSize,
+                                                                   numPartitions,
+                                                                   stride );
+
+    const sofa::CacheFile::Block block =
+    {
+        spectra,
+        numMeasurements * numReceivers * numPartitions * stride * sizeof( Complex )
+    };
+
+    return sofa::CacheFile::Read( path, header, &layout, sizeof( sofaLocal::SpectraLayout ), &block, 1 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if the spectra have been read from the spectra file
+ *                  (rather than computed)
+ *
+ */
+/************************************************************************************/
+bool HRTFSpectra::IsLoadedFromSpectraFile() const SOFA_NOEXCEPT
+{
+    return loadedFromSpectraFile;
+}
+
+std::size_t HRTFSpectra::GetNumMeasurements() const SOFA_NOEXCEPT
+{
+    return numMeasurements;
+}
+
+std::size_t HRTFSpectra::GetNumReceivers() const SOFA_NOEXCEPT
+{
+    return numReceivers;
+}
+
+std::size_t HRTFSpectra::GetNumDataSamples() const SOFA_NOEXCEPT
+{
+    return numDataSamples;
+}
+
+std::size_t HRTFSpectra::GetBlockSize() const SOFA_NOEXCEPT
+{
+    return blockSize;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the size of the transforms (twice the block size)
+ *
+ */
+/************************************************************************************/
+std::size_t HRTFSpectra::GetFFTSize() const SOFA_NOEXCEPT
+{
+    return 2 * blockSize;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of bins of a spectrum (blockSize + 1)
+ *
+ */
+/************************************************************************************/
+std::size_t HRTFSpectra::GetNumBins() const SOFA_NOEXCEPT
+{
+    return blockSize + 1;
+}
+
+std::size_t HRTFSpectra::GetNumPartitions() const SOFA_NOEXCEPT
+{
+    return numPartitions;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the distance between two consecutive spectra, in bins
+ *
+ */
+/************************************************************************************/
+std::size_t HRTFSpectra::GetStride() const SOFA_NOEXCEPT
+{
+    return stride;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the spectrum of a partition of an impulse response
+ *                  (blockSize + 1 bins, 64-bytes aligned), or NULL if the indices are out of range
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *  @param[in]      partitionIndex : index of the partition (between 0 and P-1)
+ *
+ */
+/************************************************************************************/
+const sofa::HRTFSpectra::Complex * HRTFSpectra::GetSpectrum(const std::size_t measurementIndex,
+                                                            const std::size_t receiverIndex,
+                                                            const std::size_t partitionIndex) const SOFA_NOEXCEPT
+{
+    if( measurementIndex >= numMeasurements || receiverIndex >= numReceivers || partitionIndex >= numPartitions )
+    {
+        return NULL;
+    }
+
+    return spectra + ( ( measurementIndex * numReceivers + receiverIndex ) * numPartitions + partitionIndex ) * stride;
+}
@@ -0,0 +1,151 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAHRTFSpectra.h
+ *   @brief      Precomputed spectra of the impulse responses of a SOFA file
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_HRTF_SPECTRA_H__
+#define _SOFA_HRTF_SPECTRA_H__
+
+#include "../src/SOFAPlatform.h"
+#include <vector>
+#include <string>
+#include <complex>
+#include <cstddef>
+
+namespace sofa
+{
+    class File;
+    class SimpleFreeFieldHRIR;
+    class SimpleHeadphoneIR;
+
+    /************************************************************************************/
+    /*!
+     *  @class          HRTFSpectra
+     *  @brief          Frequency-domain view of the Data.IR impulse responses [ M R N ]
+     *                  of a SimpleFreeFieldHRIR or SimpleHeadphoneIR file
+     *
+     *  @details        Each impulse response is split into partitions of blockSize samples,
+     *                  and each partition is zero-padded to 2 * blockSize samples (overlap-save),
+     *                  i.e. the uniform layout of PartitionedFilterSet.
+     *
+     *                  The spectra are stored contiguously, as [ M R P stride ] (P partitions of
+     *                  blockSize + 1 bins); each spectrum starts on a 64-bytes boundary.
+     *
+     *                  The spectra can be saved in a file next to the SOFA file
+     *                  (see GetSpectraFilename()) : when this file is up to date (same size and
+     *                  modification time of the SOFA file, same block size), it is read
+     *                  instead of computing the FFTs.
+     */
+    /************************************************************************************/
+    class SOFA_API HRTFSpectra
+    {
+    public:
+        typedef std::complex< float > Complex;
+
+    public:
+        static std::string GetSpectraFilename(const std::string &sofaFilename,
+                                              const std::size_t blockSize);
+
+    public:
+        HRTFSpectra(const sofa::SimpleFreeFieldHRIR &file,
+                    const std::size_t blockSize,
+                    const bool useSpectraFile = false);
+
+        HRTFSpectra(const sofa::SimpleHeadphoneIR &file,
+                    const std::size_t blockSize,
+                    const bool useSpectraFile = false);
+
+        ~HRTFSpectra();
+
+        bool Save(const std::string &path) const;
+
+        bool IsLoadedFromSpectraFile() const SOFA_NOEXCEPT;
+
+        std::size_t GetNumMeasurements() const SOFA_NOEXCEPT;
+        std::size_t GetNumReceivers() const SOFA_NOEXCEPT;
+        std::size_t GetNumDataSamples() const SOFA_NOEXCEPT;
+
+        std::size_t GetBlockSize() const SOFA_NOEXCEPT;
+        std::size_t GetFFTSize() const SOFA_NOEXCEPT;
+        std::size_t GetNumBins() const SOFA_NOEXCEPT;
+        std::size_t GetNumPartitions() const SOFA_NOEXCEPT;
+        std::size_t GetStride() const SOFA_NOEXCEPT;
+
+        const Complex * GetSpectrum(const std::size_t measurementIndex,
+                                    const std::size_t receiverIndex,
+                                    const std::size_t partitionIndex = 0) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        void initialize(const sofa::File &file, const bool useSpectraFile);
+        void allocate();
+        void computeSpectra(const std::vector< float > &impulseResponses);
+        bool load(const std::string &path);
+
+    private:
+        //==============================================================================
+        const std::size_t blockSize;
+        std::size_t numMeasurements;                ///< M
+        std::size_t numReceivers;                   ///< R
+        std::size_t numDataSamples;                 ///< N
+        std::size_t numPartitions;                  ///< P
+        std::size_t stride;                         ///< blockSize + 1 rounded up to the alignment
+
+        long long sofaFileSize;                     ///< to check that the spectra file is up to date
+        long long sofaModificationTime;
+
+        std::vector< Complex > storage;
+        Complex *spectra;                           ///< aligned, within storage
+        bool loadedFromSpectraFile;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( HRTFSpectra );
+    };
+
+}
+
+#endif /* _SOFA_HRTF_SPECTRA_H__ */
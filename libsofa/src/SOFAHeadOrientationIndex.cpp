@@ -0,0 +1,269 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAHeadOrientationIndex.cpp
+ *   @brief      Maps a head orientation to the closest ListenerView measurement(s)
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAHeadOrientationIndex.h"
+#include "../src/SOFAListenerRotation.h"
+#include "../src/SOFAFile.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAUtils.h"
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    /// below this angle (in degree), the head is on a measured orientation
+    static const double coincidentAngle = 1e-6;
+
+    static sofa::Coordinates::Type getListenerViewCoordinates(const sofa::File &file)
+    {
+        sofa::Coordinates::Type coordinates;
+        sofa::Units::Type units;
+
+        if( file.GetListenerView( coordinates, units ) == false )
+        {
+            SOFA_THROW( "invalid 'ListenerView' variable" );
+        }
+
+        return coordinates;
+    }
+
+    static std::vector< double > getListenerView(const sofa::File &file)
+    {
+        std::vector< double > views;
+
+        if( file.GetListenerView( views ) == false || views.size() % 3 != 0 )
+        {
+            SOFA_THROW( "invalid 'ListenerView' dimensions" );
+        }
+
+        return views;
+    }
+
+    /// a view vector has a direction : throws an exception for a null cartesian vector
+    static const double * checkViews(const double *views,
+                                     const std::size_t numViews,
+                                     const sofa::Coordinates::Type coordinates)
+    {
+        if( coordinates == sofa::Coordinates::kCartesian )
+        {
+            for( std::size_t i = 0; i < numViews; i++ )
+            {
+                if( views[ 3 * i + 0 ] == 0.0 && views[ 3 * i + 1 ] == 0.0 && views[ 3 * i + 2 ] == 0.0 )
+                {
+                    SOFA_THROW( "null 'ListenerView' vector" );
+                }
+            }
+        }
+
+        return views;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the index from the ListenerView variable of a file
+ *  @param[in]      file : a valid SOFA file (e.g. MultiSpeakerBRIR)
+ *
+ *  @details        Throws an exception if the ListenerView variable cannot be read
+ */
+/************************************************************************************/
+HeadOrientationIndex::HeadOrientationIndex(const sofa::File &file)
+: HeadOrientationIndex( sofaLocal::getListenerView( file ), sofaLocal::getListenerViewCoordinates( file ) )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the index from an array of view directions
+ *  @param[in]      views : interleaved view directions, e.g. [ x y z x y z ... ]
+ *  @param[in]      numViews : number of directions (the array holds 3 x numViews values)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *
+ */
+/************************************************************************************/
+HeadOrientationIndex::HeadOrientationIndex(const double *views,
+                                           const std::size_t numViews,
+                                           const sofa::Coordinates::Type coordinates)
+: index( sofaLocal::checkViews( views, numViews, coordinates ), numViews, coordinates, sofa::SourcePositionIndex::kAngular )
+{
+}
+
+HeadOrientationIndex::HeadOrientationIndex(const std::vector< double > &views,
+                                           const sofa::Coordinates::Type coordinates)
+: HeadOrientationIndex( views.empty() == false ? &views[0] : NULL, views.size() / 3, coordinates )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+HeadOrientationIndex::~HeadOrientationIndex()
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of orientations in the index (i.e. M, or 1 if ListenerView is [ I C ])
+ *
+ */
+/************************************************************************************/
+std::size_t HeadOrientationIndex::GetNumOrientations() const SOFA_NOEXCEPT
+{
+    return index.GetNumPositions();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the measurement whose ListenerView is the closest to a head orientation
+ *  @param[out]     nearest : index of the measurement, in [0 M-1]
+ *  @param[in]      yaw : azimuth of the view direction, in degree
+ *  @param[in]      pitch : elevation of the view direction, in degree
+ *  @return         false if the index is empty
+ *
+ */
+/************************************************************************************/
+bool HeadOrientationIndex::FindNearest(std::size_t &nearest,
+                                       const double yaw,
+                                       const double pitch) const SOFA_NOEXCEPT
+{
+    return index.FindNearest( nearest, yaw, pitch, 1.0, sofa::Coordinates::kSpherical );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the measurement whose ListenerView is the closest to a head orientation
+ *  @param[out]     nearest : index of the measurement, in [0 M-1]
+ *  @param[in]      head : orientation of the head (e.g. from a head tracker),
+ *                  in the coordinate system of ListenerView
+ *  @return         false if the index is empty
+ *
+ */
+/************************************************************************************/
+bool HeadOrientationIndex::FindNearest(std::size_t &nearest,
+                                       const sofa::ListenerRotation &head) const SOFA_NOEXCEPT
+{
+    double view[3];
+    head.GetView( view );
+
+    return index.FindNearest( nearest, view[0], view[1], view[2], sofa::Coordinates::kCartesian );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the two measurements whose ListenerView are the closest to a head orientation
+ *  @param[out]     indices : indices of the measurements, sorted by increasing angle
+ *  @param[out]     weights : crossfade weights of the measurements (their sum is 1)
+ *  @param[in]      yaw : azimuth of the view direction, in degree
+ *  @param[in]      pitch : elevation of the view direction, in degree
+ *  @return         the number of measurements to use : 0 if the index is empty,
+ *                  1 if the head is on a measured orientation (or if there is a single one), 2 otherwise
+ *
+ *  @details        The weights are inversely proportional to the angles between the head
+ *                  and the two measured orientations. On a regular grid of yaw angles,
+ *                  the two measurements surround the head orientation.
+ */
+/************************************************************************************/
+std::size_t HeadOrientationIndex::FindTwoNearest(std::size_t indices[2],
+                                                 double weights[2],
+                                                 const double yaw,
+                                                 const double pitch) const SOFA_NOEXCEPT
+{
+    return findTwoNearest( indices, weights, yaw, pitch, 1.0, sofa::Coordinates::kSpherical );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the two measurements whose ListenerView are the closest to a head orientation
+ *  @param[out]     indices : indices of the measurements, sorted by increasing angle
+ *  @param[out]     weights : crossfade weights of the measurements (their sum is 1)
+ *  @param[in]      head : orientation of the head (e.g. from a head tracker),
+ *                  in the coordinate system of ListenerView
+ *  @return         the number of measurements to use (0, 1 or 2)
+ *
+ */
+/************************************************************************************/
+std::size_t HeadOrientationIndex::FindTwoNearest(std::size_t indices[2],
+                                                 double weights[2],
+                                                 const sofa::ListenerRotation &head) const SOFA_NOEXCEPT
+{
+    double view[3];
+    head.GetView( view );
+
+    return findTwoNearest( indices, weights, view[0], view[1], view[2], sofa::Coordinates::kCartesian );
+}
+
+std::size_t HeadOrientationIndex::findTwoNearest(std::size_t indices[2],
+                                                 double weights[2],
+                                                 const double c1,
+                                                 const double c2,
+                                                 const double c3,
+                                                 const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT
+{
+    double angles[2];
+
+    const std::size_t numFound = index.FindKNearest( indices, angles, 2, c1, c2, c3, coordinates );
+
+    if( numFound == 0 )
+    {
+        return 0;
+    }
+
+    if( numFound == 1 || angles[0] <= sofaLocal::coincidentAngle )
+    {
+        weights[0] = 1.0;
+        weights[1] = 0.0;
+        return 1;
+    }
+
+    weights[0] = angles[1] / ( angles[0] + angles[1] );
+    weights[1] = angles[0] / ( angles[0] + angles[1] );
+
+    return 2;
+}
@@ -0,0 +1,132 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAHeadOrientationIndex.h
+ *   @brief      Maps a head orientation to the closest ListenerView measurement(s)
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_HEAD_ORIENTATION_INDEX_H__
+#define _SOFA_HEAD_ORIENTATION_INDEX_H__
+
+#include "../src/SOFASourcePositionIndex.h"
+#include <vector>
+
+namespace sofa
+{
+    class File;
+    class ListenerRotation;
+
+    /************************************************************************************/
+    /*!
+     *  @class          HeadOrientationIndex
+     *  @brief          Finds the measurement(s) whose ListenerView is the closest to a head orientation
+     *
+     *  @details        In a MultiSpeakerBRIR file, M usually samples the rotation of the head
+     *                  (ListenerView), the loudspeakers being indexed by E. The index is built once
+     *                  from the ListenerView variable, and replaces the linear scan of the M views
+     *                  by a query of a SourcePositionIndex (kAngular metric), which does not
+     *                  allocate memory : it can be queried at the rate of the head tracker.
+     *
+     *                  Only the view direction is compared (great-circle angle, in degree) :
+     *                  the roll of the head is ignored.
+     *
+     *                  FindTwoNearest() returns the two closest measurements and crossfade weights
+     *                  (inversely proportional to their angles), to switch smoothly between the
+     *                  filters. The BRIRs of one measurement and one loudspeaker, for all receivers,
+     *                  are read with MultiSpeakerBRIR::GetEmitterDataIR().
+     */
+    /************************************************************************************/
+    class SOFA_API HeadOrientationIndex
+    {
+    public:
+        HeadOrientationIndex(const sofa::File &file);
+
+        HeadOrientationIndex(const double *views,
+                             const std::size_t numViews,
+                             const sofa::Coordinates::Type coordinates);
+
+        ~HeadOrientationIndex();
+
+        std::size_t GetNumOrientations() const SOFA_NOEXCEPT;
+
+        bool FindNearest(std::size_t &nearest,
+                         const double yaw,
+                         const double pitch) const SOFA_NOEXCEPT;
+
+        bool FindNearest(std::size_t &nearest,
+                         const sofa::ListenerRotation &head) const SOFA_NOEXCEPT;
+
+        std::size_t FindTwoNearest(std::size_t indices[2],
+                                   double weights[2],
+                                   const double yaw,
+                                   const double pitch) const SOFA_NOEXCEPT;
+
+        std::size_t FindTwoNearest(std::size_t indices[2],
+                                   double weights[2],
+                                   const sofa::ListenerRotation &head) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        HeadOrientationIndex(const std::vector< double > &views,
+                             const sofa::Coordinates::Type coordinates);
+
+        std::size_t findTwoNearest(std::size_t indices[2],
+                                   double weights[2],
+                                   const double c1,
+                                   const double c2,
+                                   const double c3,
+                                   const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        const sofa::SourcePositionIndex index;      ///< the ListenerView directions
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( HeadOrientationIndex );
+    };
+
+}
+
+#endif /* _SOFA_HEAD_ORIENTATION_INDEX_H__ */
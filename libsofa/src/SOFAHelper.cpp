@@ -64,10 +64,8 @@ namespace sofaLocal
     template< class Type >
     bool isValid(const std::string &filename) SOFA_NOEXCEPT
     {
-        const bool exceptionState = sofa::Exception::IsLoggedToCerr();
-        
-        /// temporarily disable exceptions logging
-        sofa::Exception::LogToCerr( false );
+        /// disable exceptions logging in this thread (the other threads are not affected)
+        const sofa::Exception::ScopedLogToCerr noLogging( false );
         
         bool isValid = false;
         
@@ -82,9 +80,6 @@ namespace sofaLocal
             isValid = false;
         }
         
-        /// restore exceptions logging
-        sofa::Exception::LogToCerr( exceptionState );
-        
         return isValid;
     }
 }
@@ -240,3 +235,34 @@ bool sofa::IsValidSingleRoomDRIRFile(const std::string &filename) SOFA_NOEXCEPT
     return sofaLocal::isValid< sofa::SingleRoomDRIR >( filename );
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Returns all the conventions a file complies with, as a combination of
+ *                  sofa::File::ConventionFlag (0 if the file can not be opened)
+ *  @param[in]      filename : full path to a local file, or an OpenDAP URL
+ *                  (e.g. http://bili1.ircam.fr/opendap/hyrax/listen/irc_1002.sofa)
+ *
+ *  @details        This method wont raise any exception
+ *
+ */
+/************************************************************************************/
+unsigned int sofa::DetectConventions(const std::string &filename) SOFA_NOEXCEPT
+{
+    /// disable exceptions logging in this thread (the other threads are not affected)
+    const sofa::Exception::ScopedLogToCerr noLogging( false );
+    
+    unsigned int flags = 0;
+    
+    try
+    {
+        const sofa::File file( filename );
+        flags = file.DetectConventions();
+    }
+    catch( ... )
+    {
+        /// something went wrong
+        flags = 0;
+    }
+    
+    return flags;
+}
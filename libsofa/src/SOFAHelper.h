@@ -173,6 +173,21 @@ namespace sofa
      */
     /************************************************************************************/
     bool IsValidSingleRoomDRIRFile(const std::string &filename) SOFA_NOEXCEPT;
+    
+    /************************************************************************************/
+    /*!
+     *  @brief          Returns all the conventions a file complies with, as a combination of
+     *                  sofa::File::ConventionFlag (0 if the file can not be opened)
+     *  @param[in]      filename : full path to a local file, or an OpenDAP URL
+     *                  (e.g. http://bili1.ircam.fr/opendap/hyrax/listen/irc_1002.sofa)
+     *
+     *  @details        The file is opened only once, and the generic SOFA requirements are checked
+     *                  only once : this is much faster than calling all the IsValid...File functions.
+     *                  This method wont raise any exception
+     *
+     */
+    /************************************************************************************/
+    unsigned int DetectConventions(const std::string &filename) SOFA_NOEXCEPT;
 }
 
 #endif /* _SOFA_HELPER_H__ */
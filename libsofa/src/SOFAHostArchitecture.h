@@ -82,4 +82,29 @@ http://www.sofaconventions.org
 
 #endif
 
+//==============================================================================
+/// SIMD instruction set used for the double precision kernels :
+/// AVX when it is enabled at compile-time (e.g. -mavx or /arch:AVX),
+/// SSE2 on x86-64, NEON on ARM64, none otherwise (or if SOFA_DISABLE_SIMD is defined)
+//==============================================================================
+#if defined( SOFA_DISABLE_SIMD )
+
+    #undef SOFA_SIMD_AVX
+    #undef SOFA_SIMD_SSE2
+    #undef SOFA_SIMD_NEON
+
+#elif defined( __AVX__ )
+
+    #define SOFA_SIMD_AVX 1
+
+#elif ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+
+    #define SOFA_SIMD_SSE2 1
+
+#elif ( defined( __aarch64__ ) || defined( _M_ARM64 ) )
+
+    #define SOFA_SIMD_NEON 1
+
+#endif
+
 #endif /* _SOFA_HOST_ARCHITECTURE_H__ */
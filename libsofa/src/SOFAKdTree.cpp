@@ -0,0 +1,429 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAKdTree.cpp
+ *   @brief      A 3-dimensional k-d tree, for nearest neighbour queries
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAKdTree.h"
+#include <algorithm>
+#include <limits>
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    inline double squaredDistance(const double a[3], const double b[3]) SOFA_NOEXCEPT
+    {
+        const double dx = a[0] - b[0];
+        const double dy = a[1] - b[1];
+        const double dz = a[2] - b[2];
+
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    struct AxisComparator
+    {
+        AxisComparator(const unsigned int axis_) : axis( axis_ ) {}
+
+        template< class Node >
+        bool operator()(const Node &a, const Node &b) const
+        {
+            return a.point[axis] < b.point[axis];
+        }
+
+        const unsigned int axis;
+    };
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor
+ *
+ */
+/************************************************************************************/
+KdTree::KdTree()
+: nodes()
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+KdTree::~KdTree()
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Removes all the points from the tree
+ *
+ */
+/************************************************************************************/
+void KdTree::Clear()
+{
+    nodes.clear();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the tree
+ *  @param[in]      points : interleaved cartesian coordinates [ x y z x y z ... ]
+ *  @param[in]      numPoints : number of points (the array holds 3 x numPoints values)
+ *
+ *  @details        Any previous content of the tree is discarded.
+ *                  The index returned by the queries refers to the position of the
+ *                  point in this array.
+ */
+/************************************************************************************/
+void KdTree::Build(const double *points, const std::size_t numPoints)
+{
+    nodes.resize( numPoints );
+
+    for( std::size_t i = 0; i < numPoints; i++ )
+    {
+        nodes[i].point[0] = points[ 3 * i + 0 ];
+        nodes[i].point[1] = points[ 3 * i + 1 ];
+        nodes[i].point[2] = points[ 3 * i + 2 ];
+        nodes[i].index    = i;
+        nodes[i].axis     = 0;
+    }
+
+    build( 0, numPoints );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Recursively builds the subtree occupying the range [begin end[
+ *
+ *  @details        The splitting axis is the one with the largest spread, which suits
+ *                  points lying on a sphere better than a simple round-robin
+ */
+/************************************************************************************/
+void KdTree::build(const std::size_t begin, const std::size_t end)
+{
+    if( end - begin <= 1 )
+    {
+        return;
+    }
+
+    double minimum[3] = { nodes[begin].point[0], nodes[begin].point[1], nodes[begin].point[2] };
+    double maximum[3] = { nodes[begin].point[0], nodes[begin].point[1], nodes[begin].point[2] };
+
+    for( std::size_t i = begin + 1; i < end; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            minimum[j] = std::min( minimum[j], nodes[i].point[j] );
+            maximum[j] = std::max( maximum[j], nodes[i].point[j] );
+        }
+    }
+
+    unsigned int axis = 0;
+    for( unsigned int j = 1; j < 3; j++ )
+    {
+        if( maximum[j] - minimum[j] > maximum[axis] - minimum[axis] )
+        {
+            axis = j;
+        }
+    }
+
+    const std::size_t median = begin + ( end - begin ) / 2;
+
+    std::nth_element( nodes.begin() + begin,
+                      nodes.begin() + median,
+                      nodes.begin() + end,
+                      sofaLocal::AxisComparator( axis ) );
+
+    nodes[median].axis = axis;
+
+    build( begin, median );
+    build( median + 1, end );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of points in the tree
+ *
+ */
+/************************************************************************************/
+std::size_t KdTree::GetNumPoints() const SOFA_NOEXCEPT
+{
+    return nodes.size();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if the tree does not hold any point
+ *
+ */
+/************************************************************************************/
+bool KdTree::IsEmpty() const SOFA_NOEXCEPT
+{
+    return nodes.empty();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the point closest to a query point
+ *  @param[out]     index : index of the closest point
+ *  @param[out]     squaredDistance : squared euclidean distance to the closest point
+ *  @param[in]      x : query point
+ *  @param[in]      y : query point
+ *  @param[in]      z : query point
+ *  @return         false if the tree is empty
+ *
+ */
+/************************************************************************************/
+bool KdTree::FindNearest(std::size_t &index,
+                         double &squaredDistance,
+                         const double x,
+                         const double y,
+                         const double z) const SOFA_NOEXCEPT
+{
+    if( nodes.empty() == true )
+    {
+        return false;
+    }
+
+    const double query[3] = { x, y, z };
+
+    std::size_t bestIndex = 0;
+    double bestDistance   = -1.0;
+
+    searchNearest( 0, nodes.size(), query, bestIndex, bestDistance );
+
+    index           = bestIndex;
+    squaredDistance = bestDistance;
+
+    return true;
+}
+
+void KdTree::searchNearest(const std::size_t begin,
+                           const std::size_t end,
+                           const double query[3],
+                           std::size_t &bestIndex,
+                           double &bestDistance) const SOFA_NOEXCEPT
+{
+    if( begin >= end )
+    {
+        return;
+    }
+
+    const std::size_t median = begin + ( end - begin ) / 2;
+    const Node &node         = nodes[median];
+
+    const double distance = sofaLocal::squaredDistance( node.point, query );
+
+    if( bestDistance < 0.0 || distance < bestDistance )
+    {
+        bestDistance = distance;
+        bestIndex    = node.index;
+    }
+
+    if( end - begin == 1 )
+    {
+        return;
+    }
+
+    const double delta = query[node.axis] - node.point[node.axis];
+
+    /// visit first the side of the splitting plane which contains the query point
+    if( delta < 0.0 )
+    {
+        searchNearest( begin, median, query, bestIndex, bestDistance );
+
+        if( delta * delta < bestDistance )
+        {
+            searchNearest( median + 1, end, query, bestIndex, bestDistance );
+        }
+    }
+    else
+    {
+        searchNearest( median + 1, end, query, bestIndex, bestDistance );
+
+        if( delta * delta < bestDistance )
+        {
+            searchNearest( begin, median, query, bestIndex, bestDistance );
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the k points closest to a query point
+ *  @param[out]     indices : indices of the closest points, sorted by increasing distance.
+ *                  The array must be allocated large enough (k)
+ *  @param[out]     squaredDistances : the corresponding squared euclidean distances.
+ *                  The array must be allocated large enough (k)
+ *  @param[in]      k : number of requested neighbours
+ *  @param[in]      x : query point
+ *  @param[in]      y : query point
+ *  @param[in]      z : query point
+ *  @return         the number of neighbours actually found, i.e. min( k, GetNumPoints() )
+ *
+ */
+/************************************************************************************/
+std::size_t KdTree::FindKNearest(std::size_t *indices,
+                                 double *squaredDistances,
+                                 const std::size_t k,
+                                 const double x,
+                                 const double y,
+                                 const double z) const SOFA_NOEXCEPT
+{
+    if( nodes.empty() == true || k == 0 )
+    {
+        return 0;
+    }
+
+    const double query[3] = { x, y, z };
+
+    std::size_t numFound = 0;
+
+    searchKNearest( 0, nodes.size(), query, k, std::numeric_limits< double >::infinity(),
+                    indices, squaredDistances, numFound );
+
+    return numFound;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the points lying within a given distance of a query point
+ *  @param[out]     indices : indices of the points found, sorted by increasing distance.
+ *                  The array must be allocated large enough (maxCount)
+ *  @param[out]     squaredDistances : the corresponding squared euclidean distances.
+ *                  The array must be allocated large enough (maxCount)
+ *  @param[in]      maxCount : maximum number of points returned
+ *  @param[in]      x : query point
+ *  @param[in]      y : query point
+ *  @param[in]      z : query point
+ *  @param[in]      radius : euclidean distance (not squared)
+ *  @return         the number of points found, at most maxCount
+ *
+ *  @details        If more than maxCount points lie within the radius, the maxCount
+ *                  closest ones are returned
+ */
+/************************************************************************************/
+std::size_t KdTree::FindInRadius(std::size_t *indices,
+                                 double *squaredDistances,
+                                 const std::size_t maxCount,
+                                 const double x,
+                                 const double y,
+                                 const double z,
+                                 const double radius) const SOFA_NOEXCEPT
+{
+    if( nodes.empty() == true || maxCount == 0 || ( radius >= 0.0 ) == false )
+    {
+        return 0;
+    }
+
+    const double query[3] = { x, y, z };
+
+    std::size_t numFound = 0;
+
+    searchKNearest( 0, nodes.size(), query, maxCount, radius * radius,
+                    indices, squaredDistances, numFound );
+
+    return numFound;
+}
+
+void KdTree::searchKNearest(const std::size_t begin,
+                            const std::size_t end,
+                            const double query[3],
+                            const std::size_t k,
+                            const double maxSquaredDistance,
+                            std::size_t *indices,
+                            double *squaredDistances,
+                            std::size_t &numFound) const SOFA_NOEXCEPT
+{
+    if( begin >= end )
+    {
+        return;
+    }
+
+    const std::size_t median = begin + ( end - begin ) / 2;
+    const Node &node         = nodes[median];
+
+    const double distance = sofaLocal::squaredDistance( node.point, query );
+
+    /// insertion into the (sorted) list of candidates
+    if( distance <= maxSquaredDistance
+       && ( numFound < k || distance < squaredDistances[numFound - 1] ) )
+    {
+        std::size_t i = ( numFound < k ) ? numFound++ : numFound - 1;
+
+        while( i > 0 && squaredDistances[i - 1] > distance )
+        {
+            squaredDistances[i] = squaredDistances[i - 1];
+            indices[i]          = indices[i - 1];
+            i--;
+        }
+
+        squaredDistances[i] = distance;
+        indices[i]          = node.index;
+    }
+
+    if( end - begin == 1 )
+    {
+        return;
+    }
+
+    const double delta = query[node.axis] - node.point[node.axis];
+
+    const std::size_t nearBegin = ( delta < 0.0 ) ? begin      : median + 1;
+    const std::size_t nearEnd   = ( delta < 0.0 ) ? median     : end;
+    const std::size_t farBegin  = ( delta < 0.0 ) ? median + 1 : begin;
+    const std::size_t farEnd    = ( delta < 0.0 ) ? end        : median;
+
+    searchKNearest( nearBegin, nearEnd, query, k, maxSquaredDistance, indices, squaredDistances, numFound );
+
+    /// the far side is visited only if it may hold a closer point, within the maximum distance
+    if( delta * delta <= maxSquaredDistance
+       && ( numFound < k || delta * delta < squaredDistances[numFound - 1] ) )
+    {
+        searchKNearest( farBegin, farEnd, query, k, maxSquaredDistance, indices, squaredDistances, numFound );
+    }
+}
@@ -0,0 +1,143 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAKdTree.h
+ *   @brief      A 3-dimensional k-d tree, for nearest neighbour queries
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_KD_TREE_H__
+#define _SOFA_KD_TREE_H__
+
+#include "../src/SOFAPlatform.h"
+#include <vector>
+#include <cstddef>
+
+namespace sofa
+{
+
+    /************************************************************************************/
+    /*!
+     *  @class          KdTree
+     *  @brief          A balanced k-d tree over a set of points in 3D (cartesian coordinates)
+     *
+     *  @details        The tree is built once, from an interleaved [ x y z x y z ... ] array.
+     *                  The nodes are stored in a flat array (each subtree occupies a contiguous
+     *                  range whose median is the root of the subtree), so that the queries
+     *                  do not allocate any memory and can safely be called from the audio thread.
+     *                  Queries run in O(log M) on average.
+     *                  All distances returned by the tree are squared euclidean distances.
+     */
+    /************************************************************************************/
+    class SOFA_API KdTree
+    {
+    public:
+        KdTree();
+        ~KdTree();
+
+        void Build(const double *points, const std::size_t numPoints);
+        void Clear();
+
+        std::size_t GetNumPoints() const SOFA_NOEXCEPT;
+        bool IsEmpty() const SOFA_NOEXCEPT;
+
+        bool FindNearest(std::size_t &index,
+                         double &squaredDistance,
+                         const double x,
+                         const double y,
+                         const double z) const SOFA_NOEXCEPT;
+
+        std::size_t FindKNearest(std::size_t *indices,
+                                 double *squaredDistances,
+                                 const std::size_t k,
+                                 const double x,
+                                 const double y,
+                                 const double z) const SOFA_NOEXCEPT;
+
+        std::size_t FindInRadius(std::size_t *indices,
+                                 double *squaredDistances,
+                                 const std::size_t maxCount,
+                                 const double x,
+                                 const double y,
+                                 const double z,
+                                 const double radius) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        struct Node
+        {
+            double point[3];            ///< coordinates of the point
+            std::size_t index;          ///< index of the point in the original array
+            unsigned int axis;          ///< splitting axis of the subtree (0, 1 or 2)
+        };
+
+        //==============================================================================
+        void build(const std::size_t begin, const std::size_t end);
+
+        void searchNearest(const std::size_t begin,
+                           const std::size_t end,
+                           const double query[3],
+                           std::size_t &bestIndex,
+                           double &bestDistance) const SOFA_NOEXCEPT;
+
+        void searchKNearest(const std::size_t begin,
+                            const std::size_t end,
+                            const double query[3],
+                            const std::size_t k,
+                            const double maxSquaredDistance,
+                            std::size_t *indices,
+                            double *squaredDistances,
+                            std::size_t &numFound) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        std::vector< Node > nodes;      ///< flat storage of the tree
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( KdTree );
+    };
+
+}
+
+#endif /* _SOFA_KD_TREE_H__ */
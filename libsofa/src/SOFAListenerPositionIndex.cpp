@@ -0,0 +1,214 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAListenerPositionIndex.cpp
+ *   @brief      Spatial index over the ListenerPosition variable, for walkable rooms
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAListenerPositionIndex.h"
+#include "../src/SOFAFile.h"
+#include "../src/SOFAExceptions.h"
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    static sofa::Coordinates::Type getListenerPositionCoordinates(const sofa::File &file)
+    {
+        sofa::Coordinates::Type coordinates;
+        sofa::Units::Type units;
+
+        if( file.GetListenerPosition( coordinates, units ) == false )
+        {
+            SOFA_THROW( "invalid 'ListenerPosition' variable" );
+        }
+
+        return coordinates;
+    }
+
+    static std::vector< double > getListenerPosition(const sofa::File &file)
+    {
+        std::vector< double > positions;
+
+        if( file.GetListenerPosition( positions ) == false || positions.size() % 3 != 0 )
+        {
+            SOFA_THROW( "invalid 'ListenerPosition' dimensions" );
+        }
+
+        return positions;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the index from the ListenerPosition variable of a file
+ *  @param[in]      file : a valid SOFA file (e.g. SingleRoomDRIR)
+ *
+ *  @details        Throws an exception if the ListenerPosition variable cannot be read
+ */
+/************************************************************************************/
+ListenerPositionIndex::ListenerPositionIndex(const sofa::File &file)
+: ListenerPositionIndex( sofaLocal::getListenerPosition( file ), sofaLocal::getListenerPositionCoordinates( file ) )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the index from an array of positions
+ *  @param[in]      positions : interleaved positions, e.g. [ x y z x y z ... ]
+ *  @param[in]      numPositions : number of positions (the array holds 3 x numPositions values)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *
+ */
+/************************************************************************************/
+ListenerPositionIndex::ListenerPositionIndex(const double *positions,
+                                             const std::size_t numPositions,
+                                             const sofa::Coordinates::Type coordinates)
+: index( positions, numPositions, coordinates, sofa::SourcePositionIndex::kEuclidean )
+{
+}
+
+ListenerPositionIndex::ListenerPositionIndex(const std::vector< double > &positions,
+                                             const sofa::Coordinates::Type coordinates)
+: index( positions.empty() == false ? &positions[0] : NULL,
+         positions.size() / 3,
+         coordinates,
+         sofa::SourcePositionIndex::kEuclidean )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+ListenerPositionIndex::~ListenerPositionIndex()
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of positions in the index (i.e. M)
+ *
+ */
+/************************************************************************************/
+std::size_t ListenerPositionIndex::GetNumPositions() const SOFA_NOEXCEPT
+{
+    return index.GetNumPositions();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the measurement whose listener position is the closest
+ *  @param[out]     nearest : index of the measurement, in [0 M-1]
+ *  @param[out]     distance : distance to this measurement, in meter
+ *  @param[in]      x : position of the listener, in meter
+ *  @param[in]      y : position of the listener, in meter
+ *  @param[in]      z : position of the listener, in meter
+ *  @return         false if the index is empty
+ *
+ */
+/************************************************************************************/
+bool ListenerPositionIndex::FindNearest(std::size_t &nearest,
+                                        double &distance,
+                                        const double x,
+                                        const double y,
+                                        const double z) const SOFA_NOEXCEPT
+{
+    return index.FindNearest( nearest, distance, x, y, z, sofa::Coordinates::kCartesian );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the k measurements whose listener positions are the closest
+ *  @param[out]     indices : indices of the measurements, sorted by increasing distance.
+ *                  The array must be allocated large enough (k)
+ *  @param[out]     distances : the corresponding distances, in meter.
+ *                  The array must be allocated large enough (k)
+ *  @param[in]      k : number of requested neighbours
+ *  @param[in]      x : position of the listener, in meter
+ *  @param[in]      y : position of the listener, in meter
+ *  @param[in]      z : position of the listener, in meter
+ *  @return         the number of neighbours actually found, i.e. min( k, M )
+ *
+ */
+/************************************************************************************/
+std::size_t ListenerPositionIndex::FindKNearest(std::size_t *indices,
+                                                double *distances,
+                                                const std::size_t k,
+                                                const double x,
+                                                const double y,
+                                                const double z) const SOFA_NOEXCEPT
+{
+    return index.FindKNearest( indices, distances, k, x, y, z, sofa::Coordinates::kCartesian );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the measurements whose listener positions lie within a given distance
+ *  @param[out]     indices : indices of the measurements, sorted by increasing distance.
+ *                  The array must be allocated large enough (maxCount)
+ *  @param[out]     distances : the corresponding distances, in meter.
+ *                  The array must be allocated large enough (maxCount)
+ *  @param[in]      maxCount : maximum number of measurements returned
+ *  @param[in]      x : position of the listener, in meter
+ *  @param[in]      y : position of the listener, in meter
+ *  @param[in]      z : position of the listener, in meter
+ *  @param[in]      radius : in meter
+ *  @return         the number of measurements found, at most maxCount
+ *
+ *  @details        If more than maxCount measurements lie within the radius, the maxCount
+ *                  closest ones are returned
+ */
+/************************************************************************************/
+std::size_t ListenerPositionIndex::FindInRadius(std::size_t *indices,
+                                                double *distances,
+                                                const std::size_t maxCount,
+                                                const double x,
+                                                const double y,
+                                                const double z,
+                                                const double radius) const SOFA_NOEXCEPT
+{
+    return index.FindInRadius( indices, distances, maxCount, x, y, z, sofa::Coordinates::kCartesian, radius );
+}
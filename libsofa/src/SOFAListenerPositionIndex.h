@@ -0,0 +1,125 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAListenerPositionIndex.h
+ *   @brief      Spatial index over the ListenerPosition variable, for walkable rooms
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_LISTENER_POSITION_INDEX_H__
+#define _SOFA_LISTENER_POSITION_INDEX_H__
+
+#include "../src/SOFASourcePositionIndex.h"
+#include <vector>
+
+namespace sofa
+{
+    class File;
+
+    /************************************************************************************/
+    /*!
+     *  @class          ListenerPositionIndex
+     *  @brief          Finds the measurement(s) closest to a given listener position
+     *
+     *  @details        In a SingleRoomDRIR file, the ListenerPosition varies along M to sample
+     *                  the room. The index is built once from this variable, and answers
+     *                  nearest, k-nearest and radius queries in O(log M), without allocating memory
+     *                  (with a SourcePositionIndex using the kEuclidean metric).
+     *
+     *                  Positions are compared in cartesian coordinates : the queries are given
+     *                  in meter, in the coordinate system of the room, and the distances returned
+     *                  are euclidean distances in meter.
+     *                  Spherical ListenerPosition variables are converted when building the index.
+     */
+    /************************************************************************************/
+    class SOFA_API ListenerPositionIndex
+    {
+    public:
+        ListenerPositionIndex(const sofa::File &file);
+
+        ListenerPositionIndex(const double *positions,
+                              const std::size_t numPositions,
+                              const sofa::Coordinates::Type coordinates);
+
+        ~ListenerPositionIndex();
+
+        std::size_t GetNumPositions() const SOFA_NOEXCEPT;
+
+        bool FindNearest(std::size_t &nearest,
+                         double &distance,
+                         const double x,
+                         const double y,
+                         const double z) const SOFA_NOEXCEPT;
+
+        std::size_t FindKNearest(std::size_t *indices,
+                                 double *distances,
+                                 const std::size_t k,
+                                 const double x,
+                                 const double y,
+                                 const double z) const SOFA_NOEXCEPT;
+
+        std::size_t FindInRadius(std::size_t *indices,
+                                 double *distances,
+                                 const std::size_t maxCount,
+                                 const double x,
+                                 const double y,
+                                 const double z,
+                                 const double radius) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        ListenerPositionIndex(const std::vector< double > &positions,
+                              const sofa::Coordinates::Type coordinates);
+
+    private:
+        //==============================================================================
+        const sofa::SourcePositionIndex index;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( ListenerPositionIndex );
+    };
+
+}
+
+#endif /* _SOFA_LISTENER_POSITION_INDEX_H__ */
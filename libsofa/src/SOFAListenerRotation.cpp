@@ -0,0 +1,464 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAListenerRotation.cpp
+ *   @brief      Orientation of the listener's head, from ListenerView/ListenerUp or a head tracker
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAListenerRotation.h"
+#include "../src/SOFAFile.h"
+#include "../src/SOFAPoint3.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAUtils.h"
+#include <vector>
+#include <cmath>
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    inline double dot(const double a[3], const double b[3]) SOFA_NOEXCEPT
+    {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    inline void cross(double result[3], const double a[3], const double b[3]) SOFA_NOEXCEPT
+    {
+        result[0] = a[1] * b[2] - a[2] * b[1];
+        result[1] = a[2] * b[0] - a[0] * b[2];
+        result[2] = a[0] * b[1] - a[1] * b[0];
+    }
+
+    /// returns false for a null vector
+    inline bool normalize(double vector[3]) SOFA_NOEXCEPT
+    {
+        const double norm = std::sqrt( dot( vector, vector ) );
+
+        if( norm > 0.0 )
+        {
+            vector[0] /= norm;
+            vector[1] /= norm;
+            vector[2] /= norm;
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /// converts the first vector of ListenerView or ListenerUp to cartesian coordinates
+    static void toCartesian(double vector[3],
+                            const std::vector< double > &values,
+                            const sofa::Coordinates::Type coordinates,
+                            const sofa::Units::Type units,
+                            const std::string &variableName)
+    {
+        if( values.size() < 3 )
+        {
+            SOFA_THROW( "invalid '" + variableName + "' variable" );
+        }
+
+        sofa::Point3 point;
+        point.Set( coordinates );
+        point.Set( units );
+        point.Set( &values[0] );
+        point.ConvertTo( sofa::Coordinates::kCartesian );
+
+        vector[0] = point[0];
+        vector[1] = point[1];
+        vector[2] = point[2];
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : no rotation
+ *                  (the listener looks towards x, with the top of the head towards z)
+ *
+ */
+/************************************************************************************/
+ListenerRotation::ListenerRotation() SOFA_NOEXCEPT
+{
+    SetIdentity();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : orientation given by the ListenerView and ListenerUp
+ *                  variables of a file (of the first listener, if they vary)
+ *  @param[in]      file : a valid SOFA file
+ *
+ *  @details        Throws an exception if ListenerView or ListenerUp cannot be read, or if
+ *                  they do not define an orientation
+ */
+/************************************************************************************/
+ListenerRotation::ListenerRotation(const sofa::File &file)
+{
+    sofa::Coordinates::Type viewCoordinates;
+    sofa::Units::Type viewUnits;
+    std::vector< double > values;
+
+    if( file.GetListenerView( viewCoordinates, viewUnits ) == false || file.GetListenerView( values ) == false )
+    {
+        SOFA_THROW( "invalid 'ListenerView' variable" );
+    }
+
+    double view[3];
+    sofaLocal::toCartesian( view, values, viewCoordinates, viewUnits, "ListenerView" );
+
+    /// ListenerUp is often stored without Type and Units : it then shares those of ListenerView
+    sofa::Coordinates::Type upCoordinates;
+    sofa::Units::Type upUnits;
+
+    if( file.GetListenerUp( upCoordinates, upUnits ) == false )
+    {
+        upCoordinates   = viewCoordinates;
+        upUnits         = viewUnits;
+    }
+
+    if( file.GetListenerUp( values ) == false )
+    {
+        SOFA_THROW( "invalid 'ListenerUp' variable" );
+    }
+
+    double up[3];
+    sofaLocal::toCartesian( up, values, upCoordinates, upUnits, "ListenerUp" );
+
+    SetViewUp( view, up );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Copy constructor
+ *
+ */
+/************************************************************************************/
+ListenerRotation::ListenerRotation(const ListenerRotation &other) SOFA_NOEXCEPT
+{
+    *this = other;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Copy operator
+ *
+ */
+/************************************************************************************/
+const ListenerRotation & ListenerRotation::operator= (const ListenerRotation &other) SOFA_NOEXCEPT
+{
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        axes[i][0] = other.axes[i][0];
+        axes[i][1] = other.axes[i][1];
+        axes[i][2] = other.axes[i][2];
+    }
+
+    return *this;
+}
+
+void ListenerRotation::SetIdentity() SOFA_NOEXCEPT
+{
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        axes[i][0] = ( i == 0 ) ? 1.0 : 0.0;
+        axes[i][1] = ( i == 1 ) ? 1.0 : 0.0;
+        axes[i][2] = ( i == 2 ) ? 1.0 : 0.0;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Sets the orientation from the view and up vectors
+ *  @param[in]      view : view direction, in the global coordinate system (cartesian)
+ *  @param[in]      up : up direction, in the global coordinate system (cartesian)
+ *
+ *  @details        The vectors do not need to be normalized; up does not need to be
+ *                  orthogonal to view (only its component orthogonal to view is taken into account).
+ *                  Throws an exception if a vector is null, or if they are colinear
+ */
+/************************************************************************************/
+void ListenerRotation::SetViewUp(const double view_[3], const double up_[3])
+{
+    double view[3] = { view_[0], view_[1], view_[2] };
+
+    if( sofaLocal::normalize( view ) == false )
+    {
+        SOFA_THROW( "the view vector is null" );
+    }
+
+    const double projection = sofaLocal::dot( up_, view );
+
+    double up[3] =
+    {
+        up_[0] - projection * view[0],
+        up_[1] - projection * view[1],
+        up_[2] - projection * view[2]
+    };
+
+    if( sofaLocal::normalize( up ) == false )
+    {
+        SOFA_THROW( "the up vector is null or colinear to the view vector" );
+    }
+
+    double left[3];
+    sofaLocal::cross( left, up, view );
+
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        axes[0][j] = view[j];
+        axes[1][j] = left[j];
+        axes[2][j] = up[j];
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Sets the orientation from a quaternion
+ *  @param[in]      w, x, y, z : quaternion rotating the listener's frame into the global
+ *                  coordinate system (the orientation of the head)
+ *  @return         false (and the rotation is unchanged) if the quaternion is null
+ *
+ *  @details        The quaternion does not need to be normalized
+ */
+/************************************************************************************/
+bool ListenerRotation::SetQuaternion(const double w_,
+                                     const double x_,
+                                     const double y_,
+                                     const double z_) SOFA_NOEXCEPT
+{
+    const double norm = std::sqrt( w_ * w_ + x_ * x_ + y_ * y_ + z_ * z_ );
+
+    if( ( norm > 0.0 ) == false )
+    {
+        return false;
+    }
+
+    const double w = w_ / norm;
+    const double x = x_ / norm;
+    const double y = y_ / norm;
+    const double z = z_ / norm;
+
+    axes[0][0] = 1.0 - 2.0 * ( y * y + z * z );
+    axes[0][1] = 2.0 * ( x * y + w * z );
+    axes[0][2] = 2.0 * ( x * z - w * y );
+
+    axes[1][0] = 2.0 * ( x * y - w * z );
+    axes[1][1] = 1.0 - 2.0 * ( x * x + z * z );
+    axes[1][2] = 2.0 * ( y * z + w * x );
+
+    axes[2][0] = 2.0 * ( x * z + w * y );
+    axes[2][1] = 2.0 * ( y * z - w * x );
+    axes[2][2] = 1.0 - 2.0 * ( x * x + y * y );
+
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Sets the orientation from yaw, pitch and roll angles (in degree)
+ *  @param[in]      yaw : azimuth of the view direction (counterclockwise, as the SOFA azimuth)
+ *  @param[in]      pitch : elevation of the view direction (positive upwards)
+ *  @param[in]      roll : rotation around the view direction (positive when the left ear goes up)
+ *
+ *  @details        The rotations are applied in the order roll, pitch, yaw
+ */
+/************************************************************************************/
+void ListenerRotation::SetYawPitchRoll(const double yaw,
+                                       const double pitch,
+                                       const double roll) SOFA_NOEXCEPT
+{
+    const double cy = std::cos( sofa::DegreesToRadians( yaw ) );
+    const double sy = std::sin( sofa::DegreesToRadians( yaw ) );
+    const double cp = std::cos( sofa::DegreesToRadians( pitch ) );
+    const double sp = std::sin( sofa::DegreesToRadians( pitch ) );
+    const double cr = std::cos( sofa::DegreesToRadians( roll ) );
+    const double sr = std::sin( sofa::DegreesToRadians( roll ) );
+
+    axes[0][0] = cy * cp;
+    axes[0][1] = sy * cp;
+    axes[0][2] = sp;
+
+    axes[1][0] = - cy * sp * sr - sy * cr;
+    axes[1][1] = - sy * sp * sr + cy * cr;
+    axes[1][2] = cp * sr;
+
+    axes[2][0] = - cy * sp * cr + sy * sr;
+    axes[2][1] = - sy * sp * cr - cy * sr;
+    axes[2][2] = cp * cr;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Applies a rotation of the head, relative to the current orientation
+ *  @param[in]      headRotation : orientation of the head, expressed in the current listener's frame
+ *
+ *  @details        e.g. the reference orientation of a head tracker (its "look forward" reset),
+ *                  composed with the orientation it reports.
+ *                  Do not compose the orientation of the listener of a file (ListenerView and
+ *                  ListenerUp) into the rotation given to SourcePositionIndex : the index already
+ *                  expresses the positions in the listener's frame
+ */
+/************************************************************************************/
+void ListenerRotation::Compose(const ListenerRotation &headRotation) SOFA_NOEXCEPT
+{
+    double composed[3][3];
+
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            composed[i][j] = headRotation.axes[i][0] * axes[0][j]
+                           + headRotation.axes[i][1] * axes[1][j]
+                           + headRotation.axes[i][2] * axes[2][j];
+        }
+    }
+
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        axes[i][0] = composed[i][0];
+        axes[i][1] = composed[i][1];
+        axes[i][2] = composed[i][2];
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the view direction (unit vector), in the global coordinate system
+ *
+ */
+/************************************************************************************/
+void ListenerRotation::GetView(double view[3]) const SOFA_NOEXCEPT
+{
+    view[0] = axes[0][0];
+    view[1] = axes[0][1];
+    view[2] = axes[0][2];
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the up direction (unit vector), in the global coordinate system
+ *
+ */
+/************************************************************************************/
+void ListenerRotation::GetUp(double up[3]) const SOFA_NOEXCEPT
+{
+    up[0] = axes[2][0];
+    up[1] = axes[2][1];
+    up[2] = axes[2][2];
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Expresses a direction (or a position relative to the listener)
+ *                  in the listener's frame
+ *  @param[in,out]  direction : cartesian coordinates, in the global coordinate system on input,
+ *                  in the listener's frame on output
+ *
+ */
+/************************************************************************************/
+void ListenerRotation::ToListenerFrame(double direction[3]) const SOFA_NOEXCEPT
+{
+    const double x = direction[0];
+    const double y = direction[1];
+    const double z = direction[2];
+
+    direction[0] = axes[0][0] * x + axes[0][1] * y + axes[0][2] * z;
+    direction[1] = axes[1][0] * x + axes[1][1] * y + axes[1][2] * z;
+    direction[2] = axes[2][0] * x + axes[2][1] * y + axes[2][2] * z;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Expresses a direction of the listener's frame in the global coordinate system
+ *                  (inverse of ToListenerFrame)
+ *  @param[in,out]  direction : cartesian coordinates
+ *
+ */
+/************************************************************************************/
+void ListenerRotation::ToGlobalFrame(double direction[3]) const SOFA_NOEXCEPT
+{
+    const double x = direction[0];
+    const double y = direction[1];
+    const double z = direction[2];
+
+    direction[0] = axes[0][0] * x + axes[1][0] * y + axes[2][0] * z;
+    direction[1] = axes[0][1] * x + axes[1][1] * y + axes[2][1] * z;
+    direction[2] = axes[0][2] * x + axes[1][2] * y + axes[2][2] * z;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Expresses a set of positions in the listener's frame, in one pass
+ *  @param[in]      x, y, z : cartesian coordinates in the global coordinate system
+ *                  (e.g. from File::GetSourcePosition( positions, sofa::Coordinates::kCartesian ))
+ *  @param[out]     listenerX, listenerY, listenerZ : cartesian coordinates in the listener's frame.
+ *                  The arrays must be allocated large enough (numPositions); they may be the
+ *                  input arrays (in place rotation)
+ *  @param[in]      numPositions : number of positions
+ *
+ */
+/************************************************************************************/
+void ListenerRotation::ToListenerFrame(const double *x,
+                                       const double *y,
+                                       const double *z,
+                                       double *listenerX,
+                                       double *listenerY,
+                                       double *listenerZ,
+                                       const std::size_t numPositions) const SOFA_NOEXCEPT
+{
+    const double m00 = axes[0][0], m01 = axes[0][1], m02 = axes[0][2];
+    const double m10 = axes[1][0], m11 = axes[1][1], m12 = axes[1][2];
+    const double m20 = axes[2][0], m21 = axes[2][1], m22 = axes[2][2];
+
+    for( std::size_t i = 0; i < numPositions; i++ )
+    {
+        const double xi = x[i];
+        const double yi = y[i];
+        const double zi = z[i];
+
+        listenerX[i] = m00 * xi + m01 * yi + m02 * zi;
+        listenerY[i] = m10 * xi + m11 * yi + m12 * zi;
+        listenerZ[i] = m20 * xi + m21 * yi + m22 * zi;
+    }
+}
@@ -0,0 +1,133 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAListenerRotation.h
+ *   @brief      Orientation of the listener's head, from ListenerView/ListenerUp or a head tracker
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_LISTENER_ROTATION_H__
+#define _SOFA_LISTENER_ROTATION_H__
+
+#include "../src/SOFAPlatform.h"
+#include <cstddef>
+
+namespace sofa
+{
+    class File;
+
+    /************************************************************************************/
+    /*!
+     *  @class          ListenerRotation
+     *  @brief          Rotation between the global coordinate system and the listener's frame
+     *
+     *  @details        The listener's frame is the one of the head : x towards the view direction,
+     *                  y towards the left ear, z towards the top of the head (the frame of the
+     *                  SourcePosition of SimpleFreeFieldHRIR, when ListenerView = (1 0 0) and
+     *                  ListenerUp = (0 0 1)).
+     *
+     *                  The orientation of the head is given either by View/Up vectors (e.g. the
+     *                  ListenerView and ListenerUp variables of a file), by a unit quaternion
+     *                  or by yaw, pitch and roll angles (e.g. from a head tracker).
+     *
+     *                  ToListenerFrame() expresses global directions in the listener's frame,
+     *                  for a single query or for a whole set of positions in one pass (this is how
+     *                  SourcePositionIndex expresses the SourcePosition of a file in the frame given
+     *                  by ListenerView and ListenerUp); the SourcePositionIndex queries accept
+     *                  the rotation of a head tracker directly.
+     *
+     *                  A rotation is a small value object (a 3x3 matrix) : building it from a
+     *                  quaternion and rotating a query do not allocate memory, so this can be done
+     *                  for each audio block, with the latest head tracker data.
+     */
+    /************************************************************************************/
+    class SOFA_API ListenerRotation
+    {
+    public:
+        ListenerRotation() SOFA_NOEXCEPT;
+
+        explicit ListenerRotation(const sofa::File &file);
+
+        ListenerRotation(const ListenerRotation &other) SOFA_NOEXCEPT;
+        const ListenerRotation & operator= (const ListenerRotation &other) SOFA_NOEXCEPT;
+
+        ~ListenerRotation() {};
+
+        void SetIdentity() SOFA_NOEXCEPT;
+
+        void SetViewUp(const double view[3], const double up[3]);
+
+        bool SetQuaternion(const double w,
+                           const double x,
+                           const double y,
+                           const double z) SOFA_NOEXCEPT;
+
+        void SetYawPitchRoll(const double yaw,
+                             const double pitch,
+                             const double roll) SOFA_NOEXCEPT;
+
+        void Compose(const ListenerRotation &headRotation) SOFA_NOEXCEPT;
+
+        void GetView(double view[3]) const SOFA_NOEXCEPT;
+        void GetUp(double up[3]) const SOFA_NOEXCEPT;
+
+        void ToListenerFrame(double direction[3]) const SOFA_NOEXCEPT;
+        void ToGlobalFrame(double direction[3]) const SOFA_NOEXCEPT;
+
+        void ToListenerFrame(const double *x,
+                             const double *y,
+                             const double *z,
+                             double *listenerX,
+                             double *listenerY,
+                             double *listenerZ,
+                             const std::size_t numPositions) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        /// axes of the listener's frame, in the global coordinate system :
+        /// axes[0] = view, axes[1] = left, axes[2] = up
+        double axes[3][3];
+    };
+
+}
+
+#endif /* _SOFA_LISTENER_ROTATION_H__ */
@@ -0,0 +1,420 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAMeasurementPrefetcher.cpp
+ *   @brief      Asynchronous loading of the impulse responses of a SOFA file
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAMeasurementPrefetcher.h"
+#include "../src/SOFASharedFile.h"
+#include "../src/SOFAExceptions.h"
+#include <cstring>
+
+using namespace sofa;
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : starts the background thread
+ *  @param[in]      file : the file to read. It shall outlive this object
+ *  @param[in]      numSlots : number of measurements the ring can hold
+ *
+ *  @details        Throws an exception if the file is not valid
+ */
+/************************************************************************************/
+MeasurementPrefetcher::MeasurementPrefetcher(const sofa::SharedFile &file,
+                                             const std::size_t numSlots)
+: file( file )
+, numMeasurements( file.GetNumMeasurements() )
+, numReceivers( file.GetNumReceivers() )
+, numDataSamples( file.GetNumDataSamples() )
+, slots( new Slot[ numSlots ] )
+, numSlots( numSlots )
+, slotOfMeasurement( new std::atomic< long >[ numMeasurements ] )
+, numPrefetches( 0 )
+, mutex()
+, condition()
+, requests()
+, stopped( false )
+, thread()
+{
+    if( file.IsValid() == false )
+    {
+        SOFA_THROW( "invalid SOFA file : " + file.GetFilename() );
+    }
+
+    if( numSlots == 0 )
+    {
+        SOFA_THROW( "invalid number of slots" );
+    }
+
+    for( std::size_t i = 0; i < numSlots; i++ )
+    {
+        slots[ i ].pins.store( 0 );
+        slots[ i ].measurementIndex.store( -1 );
+        slots[ i ].values.resize( numReceivers * numDataSamples, 0.0f );
+        slots[ i ].lastPrefetch = 0;
+    }
+
+    for( std::size_t i = 0; i < numMeasurements; i++ )
+    {
+        slotOfMeasurement[ i ].store( -1 );
+    }
+
+    thread = std::thread( &MeasurementPrefetcher::run, this );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor : stops the background thread
+ *
+ *  @details        The pending requests are completed with false
+ */
+/************************************************************************************/
+MeasurementPrefetcher::~MeasurementPrefetcher()
+{
+    {
+        const std::lock_guard< std::mutex > lock( mutex );
+        stopped = true;
+    }
+
+    condition.notify_one();
+
+    thread.join();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Queues the loading of some measurements, and returns immediately
+ *  @param[in]      measurementIndices : indices of the measurements (between 0 and M-1)
+ *
+ *  @details        The future becomes ready when all the measurements have been loaded
+ *                  (true), or when one of them could not be read (false)
+ */
+/************************************************************************************/
+std::future< bool > MeasurementPrefetcher::PrefetchMeasurements(const std::vector< std::size_t > &measurementIndices)
+{
+    Request request;
+    request.measurementIndices = measurementIndices;
+    request.promise            = std::make_shared< std::promise< bool > >();
+
+    std::future< bool > future = request.promise->get_future();
+
+    queue( request );
+
+    return future;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Queues the loading of some measurements, and returns immediately
+ *  @param[in]      measurementIndices : indices of the measurements (between 0 and M-1)
+ *  @param[in]      callback : called by the background thread when the request is completed.
+ *                  It shall not throw
+ *
+ */
+/************************************************************************************/
+void MeasurementPrefetcher::PrefetchMeasurements(const std::vector< std::size_t > &measurementIndices,
+                                                 const Callback &callback)
+{
+    Request request;
+    request.measurementIndices = measurementIndices;
+    request.callback           = callback;
+
+    queue( request );
+}
+
+void MeasurementPrefetcher::queue(Request &request)
+{
+    {
+        const std::lock_guard< std::mutex > lock( mutex );
+        requests.push_back( std::move( request ) );
+    }
+
+    condition.notify_one();
+}
+
+/// body of the background thread
+void MeasurementPrefetcher::run()
+{
+    for( ;; )
+    {
+        Request request;
+
+        {
+            std::unique_lock< std::mutex > lock( mutex );
+
+            condition.wait( lock, [this]() { return stopped == true || requests.empty() == false; } );
+
+            if( stopped == true )
+            {
+                break;
+            }
+
+            request = std::move( requests.front() );
+            requests.pop_front();
+        }
+
+        bool success = true;
+        for( std::size_t i = 0; i < request.measurementIndices.size(); i++ )
+        {
+            success = prefetch( request.measurementIndices[ i ] ) && success;
+        }
+
+        if( request.promise != nullptr )
+        {
+            request.promise->set_value( success );
+        }
+        if( request.callback )
+        {
+            request.callback( success );
+        }
+    }
+
+    /// cancels the pending requests
+    std::deque< Request > pending;
+    {
+        const std::lock_guard< std::mutex > lock( mutex );
+        pending.swap( requests );
+    }
+
+    for( std::size_t i = 0; i < pending.size(); i++ )
+    {
+        if( pending[ i ].promise != nullptr )
+        {
+            pending[ i ].promise->set_value( false );
+        }
+        if( pending[ i ].callback )
+        {
+            pending[ i ].callback( false );
+        }
+    }
+}
+
+/// loads one measurement into the ring (background thread only)
+bool MeasurementPrefetcher::prefetch(const std::size_t measurementIndex)
+{
+    if( measurementIndex >= numMeasurements )
+    {
+        return false;
+    }
+
+    /// slotOfMeasurement is only written by this thread
+    const long current = slotOfMeasurement[ measurementIndex ].load();
+    if( current >= 0 )
+    {
+        slots[ current ].lastPrefetch = ++numPrefetches;
+        return true;
+    }
+
+    const std::size_t slotIndex = findVictim();
+    Slot &slot = slots[ slotIndex ];
+
+    const long previous = slot.measurementIndex.load();
+    if( previous >= 0 )
+    {
+        slotOfMeasurement[ previous ].store( -1 );
+    }
+    slot.measurementIndex.store( -1 );
+
+    bool success = true;
+    try
+    {
+        for( std::size_t r = 0; r < numReceivers && success == true; r++ )
+        {
+            success = file.GetDataIR( measurementIndex, r, &slot.values[ r * numDataSamples ], numDataSamples );
+        }
+    }
+    catch( std::exception & )
+    {
+        success = false;
+    }
+
+    if( success == true )
+    {
+        slot.measurementIndex.store( (long) measurementIndex );
+        slotOfMeasurement[ measurementIndex ].store( (long) slotIndex );
+        slot.lastPrefetch = ++numPrefetches;
+    }
+    else
+    {
+        /// reused first
+        slot.lastPrefetch = 0;
+    }
+
+    /// releases the slot to the readers
+    slot.pins.store( 0, std::memory_order_release );
+
+    return success;
+}
+
+/// reserves the least recently prefetched slot which is not being read (background thread only)
+std::size_t MeasurementPrefetcher::findVictim()
+{
+    for( ;; )
+    {
+        std::size_t victim = numSlots;
+
+        for( std::size_t i = 0; i < numSlots; i++ )
+        {
+            if( slots[ i ].pins.load() == 0
+               && ( victim == numSlots || slots[ i ].lastPrefetch < slots[ victim ].lastPrefetch ) )
+            {
+                victim = i;
+            }
+        }
+
+        if( victim < numSlots )
+        {
+            int expected = 0;
+            if( slots[ victim ].pins.compare_exchange_strong( expected, -1, std::memory_order_acquire ) == true )
+            {
+                return victim;
+            }
+        }
+
+        /// all the slots are being read : the readers only hold them for a copy
+        std::this_thread::yield();
+    }
+}
+
+/// prevents the background thread from replacing the slot of a measurement
+bool MeasurementPrefetcher::pin(const std::size_t measurementIndex, std::size_t &slotIndex) const SOFA_NOEXCEPT
+{
+    if( measurementIndex >= numMeasurements )
+    {
+        return false;
+    }
+
+    const long current = slotOfMeasurement[ measurementIndex ].load( std::memory_order_acquire );
+    if( current < 0 )
+    {
+        return false;
+    }
+
+    Slot &slot = slots[ current ];
+
+    int pins = slot.pins.load();
+    do
+    {
+        if( pins < 0 )
+        {
+            /// being replaced
+            return false;
+        }
+    }
+    while( slot.pins.compare_exchange_weak( pins, pins + 1, std::memory_order_acquire ) == false );
+
+    if( slot.measurementIndex.load() != (long) measurementIndex )
+    {
+        unpin( (std::size_t) current );
+        return false;
+    }
+
+    slotIndex = (std::size_t) current;
+    return true;
+}
+
+void MeasurementPrefetcher::unpin(const std::size_t slotIndex) const SOFA_NOEXCEPT
+{
+    slots[ slotIndex ].pins.fetch_sub( 1, std::memory_order_release );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if a measurement is in the ring
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *
+ *  @details        Lock-free. The measurement may be replaced just after the call
+ */
+/************************************************************************************/
+bool MeasurementPrefetcher::IsReady(const std::size_t measurementIndex) const SOFA_NOEXCEPT
+{
+    std::size_t slotIndex = 0;
+
+    if( pin( measurementIndex, slotIndex ) == false )
+    {
+        return false;
+    }
+
+    unpin( slotIndex );
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Copies one prefetched impulse response
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *  @param[out]     values : the impulse response
+ *  @param[in]      numValues : size of the values array (shall be N)
+ *
+ *  @details        Lock-free : returns false if the measurement is not in the ring
+ */
+/************************************************************************************/
+bool MeasurementPrefetcher::GetDataIR(const std::size_t measurementIndex,
+                                      const std::size_t receiverIndex,
+                                      float *values,
+                                      const std::size_t numValues) const SOFA_NOEXCEPT
+{
+    if( receiverIndex >= numReceivers || numValues != numDataSamples || values == nullptr )
+    {
+        return false;
+    }
+
+    std::size_t slotIndex = 0;
+
+    if( pin( measurementIndex, slotIndex ) == false )
+    {
+        return false;
+    }
+
+    std::memcpy( values, &slots[ slotIndex ].values[ receiverIndex * numDataSamples ], numDataSamples * sizeof( float ) );
+
+    unpin( slotIndex );
+    return true;
+}
+
+std::size_t MeasurementPrefetcher::GetNumSlots() const SOFA_NOEXCEPT
+{
+    return numSlots;
+}
@@ -0,0 +1,168 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAMeasurementPrefetcher.h
+ *   @brief      Asynchronous loading of the impulse responses of a SOFA file
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_MEASUREMENT_PREFETCHER_H__
+#define _SOFA_MEASUREMENT_PREFETCHER_H__
+
+#include "../src/SOFAPlatform.h"
+#include <vector>
+#include <deque>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <functional>
+#include <thread>
+#include <cstddef>
+
+namespace sofa
+{
+    class SharedFile;
+
+    /************************************************************************************/
+    /*!
+     *  @class          MeasurementPrefetcher
+     *  @brief          Loads the impulse responses of some measurements in the background,
+     *                  so that they can be read without blocking on the file
+     *
+     *  @details        PrefetchMeasurements() queues a request and returns immediately;
+     *                  a background thread reads Data.IR (all the receivers of each requested
+     *                  measurement) into a ring of numSlots slots, then completes the request
+     *                  (future and/or callback). When all the slots are used, the measurement
+     *                  prefetched the longest ago is replaced.
+     *
+     *                  GetDataIR() copies a prefetched impulse response, or returns false if it is
+     *                  not (or no longer) in the ring. It never waits for the background thread
+     *                  nor for the file, and does not allocate memory : it can be called from
+     *                  an audio thread. Several threads may call it simultaneously.
+     *
+     *                  The file shall have a Data.IR variable of size [ M R N ]
+     *                  (e.g. SimpleFreeFieldHRIR), and outlive the prefetcher.
+     */
+    /************************************************************************************/
+    class SOFA_API MeasurementPrefetcher
+    {
+    public:
+        /// called by the background thread when a request is completed
+        /// (with false if one of the measurements could not be read)
+        typedef std::function< void (bool) > Callback;
+
+    public:
+        MeasurementPrefetcher(const sofa::SharedFile &file,
+                              const std::size_t numSlots);
+
+        ~MeasurementPrefetcher();
+
+        std::future< bool > PrefetchMeasurements(const std::vector< std::size_t > &measurementIndices);
+
+        void PrefetchMeasurements(const std::vector< std::size_t > &measurementIndices,
+                                  const Callback &callback);
+
+        bool IsReady(const std::size_t measurementIndex) const SOFA_NOEXCEPT;
+
+        bool GetDataIR(const std::size_t measurementIndex,
+                       const std::size_t receiverIndex,
+                       float *values,
+                       const std::size_t numValues) const SOFA_NOEXCEPT;
+
+        std::size_t GetNumSlots() const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        struct Request
+        {
+            std::vector< std::size_t > measurementIndices;
+            std::shared_ptr< std::promise< bool > > promise;
+            Callback callback;
+        };
+
+        struct Slot
+        {
+            /// number of readers, or -1 while the background thread writes the slot
+            std::atomic< int > pins;
+            std::atomic< long > measurementIndex;           ///< -1 if empty
+            std::vector< float > values;                    ///< [ R N ]
+            unsigned long long lastPrefetch;                ///< only used by the background thread
+        };
+
+        void queue(Request &request);
+        void run();
+        bool prefetch(const std::size_t measurementIndex);
+        std::size_t findVictim();
+
+        bool pin(const std::size_t measurementIndex, std::size_t &slotIndex) const SOFA_NOEXCEPT;
+        void unpin(const std::size_t slotIndex) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        const sofa::SharedFile &file;
+        const std::size_t numMeasurements;                  ///< M
+        const std::size_t numReceivers;                     ///< R
+        const std::size_t numDataSamples;                   ///< N
+
+        std::unique_ptr< Slot[] > slots;
+        const std::size_t numSlots;
+        std::unique_ptr< std::atomic< long >[] > slotOfMeasurement;   ///< [ M ], -1 if not in the ring
+        unsigned long long numPrefetches;
+
+        std::mutex mutex;                                   ///< protects the queue
+        std::condition_variable condition;
+        std::deque< Request > requests;
+        bool stopped;
+
+        std::thread thread;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( MeasurementPrefetcher );
+    };
+
+}
+
+#endif /* _SOFA_MEASUREMENT_PREFETCHER_H__ */
@@ -0,0 +1,603 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAMinimumPhaseHRIR.cpp
+ *   @brief      Minimum-phase impulse responses and pure delays of a SimpleFreeFieldHRIR file
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAMinimumPhaseHRIR.h"
+#include "../src/SOFASimpleFreeFieldHRIR.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAFFT.h"
+#include "../src/SOFACacheFile.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <cstring>
+#include <cstdint>
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    static const char minimumPhaseMagic[8]          = { 'S', 'O', 'F', 'A', 'M', 'I', 'N', 'P' };
+    static const std::uint32_t minimumPhaseVersion  = 1;
+
+    /// the layout of a cache file, followed by the impulse responses [ M R N ] and the delays [ M R ]
+    struct MinimumPhaseLayout
+    {
+        std::uint32_t numMeasurements;
+        std::uint32_t numReceivers;
+        std::uint32_t numDataSamples;
+        std::uint32_t fftSize;
+    };
+
+    static MinimumPhaseLayout makeLayout(const std::size_t numMeasurements,
+                                         const std::size_t numReceivers,
+                                         const std::size_t numDataSamples,
+                                         const std::size_t fftSize) SOFA_NOEXCEPT
+    {
+        MinimumPhaseLayout layout;
+        std::memset( &layout, 0, sizeof( MinimumPhaseLayout ) );
+
+        layout.numMeasurements  = (std::uint32_t) numMeasurements;
+        layout.numReceivers     = (std::uint32_t) numReceivers;
+        layout.numDataSamples   = (std::uint32_t) numDataSamples;
+        layout.fftSize          = (std::uint32_t) fftSize;
+
+        return layout;
+    }
+
+    /// lower bound of the magnitude spectrum, relative to its peak (-200 dB), to keep the logarithm finite
+    static const double magnitudeFloor = 1e-10;
+
+    /************************************************************************************/
+    /*!
+     *  @class          MinimumPhaseProcessor
+     *  @brief          Cepstral minimum-phase conversion and delay estimation of one impulse response
+     *
+     *  @details        Holds the FFT and the work buffers of one thread
+     */
+    /************************************************************************************/
+    class MinimumPhaseProcessor
+    {
+    public:
+        typedef sofa::FFT< double >::Complex Complex;
+
+        explicit MinimumPhaseProcessor(const std::size_t fftSize)
+        : fft( fftSize )
+        , signal( fftSize )
+        , spectrum( fftSize / 2 + 1 )
+        , minimumPhaseSpectrum( fftSize / 2 + 1 )
+        {
+        }
+
+        void Process(double *minimumPhase,
+                     double &delay,
+                     const double *impulseResponse,
+                     const std::size_t numDataSamples) SOFA_NOEXCEPT
+        {
+            const std::size_t size      = fft.GetSize();
+            const std::size_t numBins   = fft.GetNumBins();
+
+            std::fill( signal.begin(), signal.end(), 0.0 );
+            std::copy( impulseResponse, impulseResponse + numDataSamples, signal.begin() );
+
+            fft.Forward( &signal[0], &spectrum[0] );
+
+            double peak = 0.0;
+            for( std::size_t k = 0; k < numBins; k++ )
+            {
+                peak = std::max( peak, std::abs( spectrum[k] ) );
+            }
+
+            if( peak <= 0.0 )
+            {
+                std::fill( minimumPhase, minimumPhase + numDataSamples, 0.0 );
+                delay = 0.0;
+                return;
+            }
+
+            /// real cepstrum : inverse transform of the log-magnitude spectrum
+            const double floor = peak * magnitudeFloor;
+
+            for( std::size_t k = 0; k < numBins; k++ )
+            {
+                minimumPhaseSpectrum[k] = Complex( std::log( std::max( std::abs( spectrum[k] ), floor ) ), 0.0 );
+            }
+
+            fft.Inverse( &minimumPhaseSpectrum[0], &signal[0] );
+
+            /// folding onto the positive quefrencies
+            for( std::size_t n = 1; n < size / 2; n++ )
+            {
+                signal[n] *= 2.0;
+            }
+
+            for( std::size_t n = size / 2 + 1; n < size; n++ )
+            {
+                signal[n] = 0.0;
+            }
+
+            fft.Forward( &signal[0], &minimumPhaseSpectrum[0] );
+
+            for( std::size_t k = 0; k < numBins; k++ )
+            {
+                minimumPhaseSpectrum[k] = std::exp( minimumPhaseSpectrum[k] );
+            }
+
+            fft.Inverse( &minimumPhaseSpectrum[0], &signal[0] );
+
+            std::copy( signal.begin(), signal.begin() + numDataSamples, minimumPhase );
+
+            /// cross-correlation between the impulse response and its minimum-phase version
+            for( std::size_t k = 0; k < numBins; k++ )
+            {
+                spectrum[k] *= std::conj( minimumPhaseSpectrum[k] );
+            }
+
+            fft.Inverse( &spectrum[0], &signal[0] );
+
+            std::size_t best = 0;
+            for( std::size_t n = 1; n < size; n++ )
+            {
+                if( signal[n] > signal[best] )
+                {
+                    best = n;
+                }
+            }
+
+            /// parabolic interpolation around the maximum (the correlation is circular)
+            const double previous   = signal[ ( best + size - 1 ) % size ];
+            const double current    = signal[ best ];
+            const double next       = signal[ ( best + 1 ) % size ];
+
+            const double curvature  = previous - 2.0 * current + next;
+            const double offset     = ( curvature < 0.0 ) ? 0.5 * ( previous - next ) / curvature : 0.0;
+
+            /// the second half holds the negative lags
+            const double lag = ( best < size / 2 ) ? (double) best : (double) best - (double) size;
+
+            delay = lag + offset;
+        }
+
+    private:
+        sofa::FFT< double > fft;
+        std::vector< double > signal;
+        std::vector< Complex > spectrum;
+        std::vector< Complex > minimumPhaseSpectrum;
+    };
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Default options : automatic FFT size, one thread per core, no cache file
+ *
+ */
+/************************************************************************************/
+MinimumPhaseHRIR::Options::Options()
+: fftSize( 0 )
+, numThreads( 0 )
+, useCacheFile( false )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the path of the cache file of a SOFA file
+ *                  (e.g. "subject_003.sofa.minphase")
+ *
+ */
+/************************************************************************************/
+std::string MinimumPhaseHRIR::GetCacheFilename(const std::string &sofaFilename)
+{
+    return sofaFilename + ".minphase";
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes (or reads) the minimum-phase filters and delays of a SimpleFreeFieldHRIR file
+ *  @param[in]      file : a valid SimpleFreeFieldHRIR file
+ *  @param[in]      options : FFT size, number of threads and cache file
+ *
+ *  @details        Throws an exception if the file is not valid or the options are invalid.
+ *                  Failing to write the cache file (e.g. in a read-only directory) is not an error
+ */
+/************************************************************************************/
+MinimumPhaseHRIR::MinimumPhaseHRIR(const sofa::SimpleFreeFieldHRIR &file,
+                                   const Options &options)
+: numMeasurements( 0 )
+, numReceivers( 0 )
+, numDataSamples( 0 )
+, fftSize( 0 )
+, sofaFileSize( 0 )
+, sofaModificationTime( 0 )
+, impulseResponses()
+, delays()
+, loadedFromCacheFile( false )
+{
+    if( file.IsValid() == false )
+    {
+        SOFA_THROW( "invalid SimpleFreeFieldHRIR file : " + file.GetFilename() );
+    }
+
+    numMeasurements = (std::size_t) file.GetNumMeasurements();
+    numReceivers    = (std::size_t) file.GetNumReceivers();
+
+    initialize( (std::size_t) file.GetNumDataSamples(), options );
+
+    const std::string cacheFilename = GetCacheFilename( file.GetFilename() );
+
+    const bool hasStatus = sofa::CacheFile::GetFileStatus( sofaFileSize, sofaModificationTime, file.GetFilename() );
+
+    if( options.useCacheFile == true && hasStatus == true && load( cacheFilename ) == true )
+    {
+        loadedFromCacheFile = true;
+        return;
+    }
+
+    std::vector< double > fileImpulseResponses;
+
+    if( file.GetDataIR( fileImpulseResponses ) == false
+       || fileImpulseResponses.size() != numMeasurements * numReceivers * numDataSamples )
+    {
+        SOFA_THROW( "invalid 'Data.IR' variable" );
+    }
+
+    process( fileImpulseResponses.empty() == false ? &fileImpulseResponses[0] : NULL, options.numThreads );
+
+    std::vector< double > fileDelays;
+
+    if( file.GetDataDelay( fileDelays ) == false )
+    {
+        SOFA_THROW( "invalid 'Data.Delay' variable" );
+    }
+
+    /// Data.Delay is [ I R ] or [ M R ]
+    if( fileDelays.size() == numMeasurements * numReceivers )
+    {
+        for( std::size_t i = 0; i < delays.size(); i++ )
+        {
+            delays[i] += fileDelays[i];
+        }
+    }
+    else if( fileDelays.size() == numReceivers )
+    {
+        for( std::size_t i = 0; i < delays.size(); i++ )
+        {
+            delays[i] += fileDelays[ i % numReceivers ];
+        }
+    }
+    else
+    {
+        SOFA_THROW( "invalid 'Data.Delay' dimensions" );
+    }
+
+    if( options.useCacheFile == true && hasStatus == true )
+    {
+        Save( cacheFilename );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes the minimum-phase filters and delays of an array of impulse responses
+ *  @param[in]      impulseResponses : [ M R N ]
+ *  @param[in]      numMeasurements : M
+ *  @param[in]      numReceivers : R
+ *  @param[in]      numDataSamples : N
+ *  @param[in]      options : FFT size and number of threads (the cache file is not used)
+ *
+ */
+/************************************************************************************/
+MinimumPhaseHRIR::MinimumPhaseHRIR(const double *impulseResponses_,
+                                   const std::size_t numMeasurements_,
+                                   const std::size_t numReceivers_,
+                                   const std::size_t numDataSamples_,
+                                   const Options &options)
+: numMeasurements( numMeasurements_ )
+, numReceivers( numReceivers_ )
+, numDataSamples( 0 )
+, fftSize( 0 )
+, sofaFileSize( 0 )
+, sofaModificationTime( 0 )
+, impulseResponses()
+, delays()
+, loadedFromCacheFile( false )
+{
+    initialize( numDataSamples_, options );
+
+    process( impulseResponses_, options.numThreads );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+MinimumPhaseHRIR::~MinimumPhaseHRIR()
+{
+}
+
+void MinimumPhaseHRIR::initialize(const std::size_t numDataSamples_,
+                                  const Options &options)
+{
+    numDataSamples = numDataSamples_;
+
+    if( options.fftSize == 0 )
+    {
+        fftSize = 2;
+        while( fftSize < 8 * numDataSamples )
+        {
+            fftSize *= 2;
+        }
+    }
+    else
+    {
+        fftSize = options.fftSize;
+
+        if( fftSize < 2 || ( fftSize & ( fftSize - 1 ) ) != 0 || fftSize < 2 * numDataSamples )
+        {
+            SOFA_THROW( "invalid FFT size (should be a power of 2, at least twice the number of samples)" );
+        }
+    }
+
+    impulseResponses.assign( numMeasurements * numReceivers * numDataSamples, 0.0 );
+    delays.assign( numMeasurements * numReceivers, 0.0 );
+}
+
+void MinimumPhaseHRIR::process(const double *impulseResponses_,
+                               const unsigned int numThreads)
+{
+    const std::size_t numResponses = numMeasurements * numReceivers;
+
+    if( numResponses == 0 || numDataSamples == 0 )
+    {
+        return;
+    }
+
+    SOFA_ASSERT( impulseResponses_ != NULL );
+
+    /// each worker picks the next impulse response which is not processed yet
+    unsigned int numWorkers = ( numThreads > 0 ) ? numThreads : std::thread::hardware_concurrency();
+    numWorkers = (unsigned int) std::max( (std::size_t) 1, std::min( (std::size_t) numWorkers, numResponses ) );
+
+    std::atomic< std::size_t > nextResponse( 0 );
+
+    const auto work = [this, impulseResponses_, numResponses, &nextResponse]()
+    {
+        sofaLocal::MinimumPhaseProcessor processor( fftSize );
+
+        for( std::size_t i = nextResponse++; i < numResponses; i = nextResponse++ )
+        {
+            processor.Process( &impulseResponses[ i * numDataSamples ],
+                               delays[ i ],
+                               impulseResponses_ + i * numDataSamples,
+                               numDataSamples );
+        }
+    };
+
+    std::vector< std::thread > workers;
+    for( unsigned int i = 1; i < numWorkers; i++ )
+    {
+        workers.push_back( std::thread( work ) );
+    }
+
+    work();
+
+    for( std::size_t i = 0; i < workers.size(); i++ )
+    {
+        workers[ i ].join();
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Writes the cache file
+ *  @param[in]      path : path of the file to write (see GetCacheFilename())
+ *
+ *  @details        The file is replaced atomically (see CacheFile::Write()).
+ *                  Returns false if the file can not be written
+ */
+/************************************************************************************/
+bool MinimumPhaseHRIR::Save(const std::string &path) const
+{
+    const sofa::CacheFile::Header header = sofa::CacheFile::MakeHeader( sofaLocal::minimumPhaseMagic,
+                                                                        sofaLocal::minimumPhaseVersion,
+                                                                        sofaFileSize,
+                                                                        sofaModificationTime );
+
+    const sofaLocal::MinimumPhaseLayout layout = sofaLocal::makeLayout( numMeasurements,
+                                                                        numReceivers,
+                                                                        numDataSamples,
+                                                                        fftSize );
+
+    const sofa::CacheFile::ConstBlock blocks[2] =
+    {
+        { impulseResponses.empty() == false ? &impulseResponses[0] : NULL, impulseResponses.size() * sizeof( double ) },
+        { delays.empty() == false ? &delays[0] : NULL, delays.size() * sizeof( double ) }
+    };
+
+    return sofa::CacheFile::Write( path, header, &layout, sizeof( sofaLocal::MinimumPhaseLayout ), blocks, 2 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads the cache file, if it matches the SOFA file and the options
+ *
+ */
+/************************************************************************************/
+bool MinimumPhaseHRIR::load(const std::string &path)
+{
+    const sofa::CacheFile::Header header = sofa::CacheFile::MakeHeader( sofaLocal::minimumPhaseMagic,
+                                                                        sofaLocal::minimumPhaseVersion,
+                                                                        sofaFileSize,
+                                                                        sofaModificationTime );
+
+    const sofaLocal::MinimumPhaseLayout layout = sofaLocal::makeLayout( numMeasurements,
+                                                                        numReceivers,
+                                                                        numDataSamples,
+                                                                        fftSize );
+
+    const sofa::CacheFile::Block blocks[2] =
+    {
+        { impulseResponses.empty() == false ? &impulseResponses[0] : NULL, impulseResponses.size() * sizeof( double ) },
+        { delays.empty() == false ? &delays[0] : NULL, delays.size() * sizeof( double ) }
+    };
+
+    return sofa::CacheFile::Read( path, header, &layout, sizeof( sofaLocal::MinimumPhaseLayout ), blocks, 2 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if the result has been read from the cache file
+ *                  (rather than computed)
+ *
+ */
+/************************************************************************************/
+bool MinimumPhaseHRIR::IsLoadedFromCacheFile() const SOFA_NOEXCEPT
+{
+    return loadedFromCacheFile;
+}
+
+std::size_t MinimumPhaseHRIR::GetNumMeasurements() const SOFA_NOEXCEPT
+{
+    return numMeasurements;
+}
+
+std::size_t MinimumPhaseHRIR::GetNumReceivers() const SOFA_NOEXCEPT
+{
+    return numReceivers;
+}
+
+std::size_t MinimumPhaseHRIR::GetNumDataSamples() const SOFA_NOEXCEPT
+{
+    return numDataSamples;
+}
+
+std::size_t MinimumPhaseHRIR::GetFFTSize() const SOFA_NOEXCEPT
+{
+    return fftSize;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the minimum-phase impulse responses [ M R N ]
+ *
+ */
+/************************************************************************************/
+const double * MinimumPhaseHRIR::GetImpulseResponses() const SOFA_NOEXCEPT
+{
+    return impulseResponses.empty() == false ? &impulseResponses[0] : NULL;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the minimum-phase impulse response (N samples) of one measurement
+ *                  and one receiver, or NULL if the indices are out of range
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *
+ */
+/************************************************************************************/
+const double * MinimumPhaseHRIR::GetImpulseResponse(const std::size_t measurementIndex,
+                                                    const std::size_t receiverIndex) const SOFA_NOEXCEPT
+{
+    if( measurementIndex >= numMeasurements || receiverIndex >= numReceivers || numDataSamples == 0 )
+    {
+        return NULL;
+    }
+
+    return &impulseResponses[ ( measurementIndex * numReceivers + receiverIndex ) * numDataSamples ];
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the pure delays, in samples [ M R ] (the layout of Data.Delay)
+ *
+ */
+/************************************************************************************/
+const double * MinimumPhaseHRIR::GetDelays() const SOFA_NOEXCEPT
+{
+    return delays.empty() == false ? &delays[0] : NULL;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the pure delay of one measurement and one receiver, in samples
+ *                  (0 if the indices are out of range)
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *
+ */
+/************************************************************************************/
+double MinimumPhaseHRIR::GetDelay(const std::size_t measurementIndex,
+                                  const std::size_t receiverIndex) const SOFA_NOEXCEPT
+{
+    if( measurementIndex >= numMeasurements || receiverIndex >= numReceivers )
+    {
+        return 0.0;
+    }
+
+    return delays[ measurementIndex * numReceivers + receiverIndex ];
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the interaural time difference of one measurement, in samples :
+ *                  the delay of the first receiver minus the delay of the second one
+ *                  (0 if there are less than two receivers)
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *
+ */
+/************************************************************************************/
+double MinimumPhaseHRIR::GetITD(const std::size_t measurementIndex) const SOFA_NOEXCEPT
+{
+    if( measurementIndex >= numMeasurements || numReceivers < 2 )
+    {
+        return 0.0;
+    }
+
+    return delays[ measurementIndex * numReceivers + 0 ] - delays[ measurementIndex * numReceivers + 1 ];
+}
@@ -0,0 +1,170 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAMinimumPhaseHRIR.h
+ *   @brief      Minimum-phase impulse responses and pure delays of a SimpleFreeFieldHRIR file
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_MINIMUM_PHASE_HRIR_H__
+#define _SOFA_MINIMUM_PHASE_HRIR_H__
+
+#include "../src/SOFAPlatform.h"
+#include <vector>
+#include <string>
+#include <cstddef>
+
+namespace sofa
+{
+    class SimpleFreeFieldHRIR;
+
+    /************************************************************************************/
+    /*!
+     *  @class          MinimumPhaseHRIR
+     *  @brief          Splits each impulse response of Data.IR [ M R N ] into a minimum-phase
+     *                  filter and a pure (fractional) delay
+     *
+     *  @details        Interpolating raw HRIRs mixes responses whose onsets do not line up,
+     *                  which causes comb filtering. Once split, the minimum-phase filters and
+     *                  the delays can be interpolated separately (e.g. with HRIRInterpolator,
+     *                  whose delays are given per measurement).
+     *
+     *                  The minimum-phase filter is computed with the real cepstrum : the log-magnitude
+     *                  spectrum is transformed back to the cepstral domain, folded onto the positive
+     *                  quefrencies, and exponentiated. The FFT is larger than N (Options::fftSize)
+     *                  to limit the aliasing of the cepstrum.
+     *
+     *                  The pure delay is the lag which maximizes the cross-correlation between the
+     *                  impulse response and its minimum-phase version, refined by parabolic
+     *                  interpolation. The delays are given in samples, with the layout of Data.Delay
+     *                  [ M R ] : the delay of the file (Data.Delay) is added to the estimated one,
+     *                  so that they can replace Data.Delay. The interaural time difference of a
+     *                  measurement is the difference between the delays of its first two receivers.
+     *
+     *                  The impulse responses are processed by a pool of threads.
+     *
+     *                  The result can be saved in a cache file next to the SOFA file
+     *                  (see GetCacheFilename()) : when this file is up to date (same size and
+     *                  modification time of the SOFA file, same options), it is read instead of
+     *                  processing the impulse responses again.
+     */
+    /************************************************************************************/
+    class SOFA_API MinimumPhaseHRIR
+    {
+    public:
+        /// processing options
+        struct Options
+        {
+            Options();
+
+            std::size_t fftSize;                ///< power of 2, at least 2N (0 : 8 times N, rounded up to a power of 2)
+            unsigned int numThreads;            ///< number of threads (0 : one per core)
+            bool useCacheFile;                  ///< read the cache file if it is up to date; otherwise write it
+        };
+
+    public:
+        static std::string GetCacheFilename(const std::string &sofaFilename);
+
+    public:
+        MinimumPhaseHRIR(const sofa::SimpleFreeFieldHRIR &file,
+                         const Options &options = Options());
+
+        MinimumPhaseHRIR(const double *impulseResponses,
+                         const std::size_t numMeasurements,
+                         const std::size_t numReceivers,
+                         const std::size_t numDataSamples,
+                         const Options &options = Options());
+
+        ~MinimumPhaseHRIR();
+
+        bool Save(const std::string &path) const;
+
+        bool IsLoadedFromCacheFile() const SOFA_NOEXCEPT;
+
+        std::size_t GetNumMeasurements() const SOFA_NOEXCEPT;
+        std::size_t GetNumReceivers() const SOFA_NOEXCEPT;
+        std::size_t GetNumDataSamples() const SOFA_NOEXCEPT;
+        std::size_t GetFFTSize() const SOFA_NOEXCEPT;
+
+        const double * GetImpulseResponses() const SOFA_NOEXCEPT;
+        const double * GetImpulseResponse(const std::size_t measurementIndex,
+                                          const std::size_t receiverIndex) const SOFA_NOEXCEPT;
+
+        const double * GetDelays() const SOFA_NOEXCEPT;
+        double GetDelay(const std::size_t measurementIndex,
+                        const std::size_t receiverIndex) const SOFA_NOEXCEPT;
+
+        double GetITD(const std::size_t measurementIndex) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        void initialize(const std::size_t numDataSamples,
+                        const Options &options);
+
+        void process(const double *impulseResponses,
+                     const unsigned int numThreads);
+
+        bool load(const std::string &path);
+
+    private:
+        //==============================================================================
+        std::size_t numMeasurements;                ///< M
+        std::size_t numReceivers;                   ///< R
+        std::size_t numDataSamples;                 ///< N
+        std::size_t fftSize;
+
+        long long sofaFileSize;                     ///< to check that the cache file is up to date
+        long long sofaModificationTime;
+
+        std::vector< double > impulseResponses;     ///< minimum-phase filters [ M R N ]
+        std::vector< double > delays;               ///< pure delays, in samples [ M R ]
+        bool loadedFromCacheFile;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( MinimumPhaseHRIR );
+    };
+
+}
+
+#endif /* _SOFA_MINIMUM_PHASE_HRIR_H__ */
@@ -77,6 +77,49 @@ MultiSpeakerBRIR::MultiSpeakerBRIR(const std::string &path,
 {
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file for reading, with tuned storage access
+ *  @param[in]      path : the file path
+ *  @param[in]      options : chunk cache, diskless and read-ahead options
+ *
+ */
+/************************************************************************************/
+MultiSpeakerBRIR::MultiSpeakerBRIR(const std::string &path,
+                                   const sofa::NetCDFFile::OpenOptions &options)
+: sofa::File( path, options )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file stored in memory (read-only, without copy)
+ *  @param[in]      buffer : the content of the file. It shall outlive this object
+ *  @param[in]      size : size of the buffer, in bytes
+ *  @param[in]      name : name returned by GetFilename()
+ *
+ */
+/************************************************************************************/
+MultiSpeakerBRIR::MultiSpeakerBRIR(const void *buffer,
+                                   const std::size_t size,
+                                   const std::string &name)
+: sofa::File( buffer, size, name )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a view on a file already opened,
+ *                  sharing its netCDF handle (the file is not opened again)
+ *  @param[in]      file : the opened file
+ *
+ */
+/************************************************************************************/
+MultiSpeakerBRIR::MultiSpeakerBRIR(const sofa::File &file)
+: sofa::File( &file )
+{
+}
+
 bool MultiSpeakerBRIR::checkGlobalAttributes() const
 {
     sofa::Attributes attributes;
@@ -191,6 +234,18 @@ bool MultiSpeakerBRIR::IsValid() const
         return false;
     }
     
+    return checkConvention();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Checks the requirements specific to the MultiSpeakerBRIR convention
+ *                  (the generic SOFA requirements are checked by File::IsValid)
+ *
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::checkConvention() const
+{
     sofa::File::ensureGlobalAttribute( "DatabaseName" );
     
     if( IsFIREDataType() == false )
@@ -310,6 +365,155 @@ bool MultiSpeakerBRIR::GetDataIR(std::vector< double > &values) const
     return sofa::File::getDataIR( values );
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for all receivers and emitters.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : the array is resized if needed (R x E x N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetDataIR(const unsigned long measurementIndex, std::vector< double > &values) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    const unsigned long R = (unsigned long) GetNumReceivers();
+    const unsigned long E = (unsigned long) GetNumEmitters();
+    const unsigned long N = (unsigned long) GetNumDataSamples();
+    
+    values.resize( R * E * N );
+    
+    return sofa::File::getDataIR( measurementIndex, &values[0], R, E, N );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for all receivers and emitters.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim2 x dim3 x dim4)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim3 : third dimension (E)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetDataIR(const unsigned long measurementIndex,
+                                 double *values,
+                                 const unsigned long dim2,
+                                 const unsigned long dim3,
+                                 const unsigned long dim4) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    return sofa::File::getDataIR( measurementIndex, values, dim2, dim3, dim4 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse response of one measurement, for one receiver and one emitter.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : the array is resized if needed (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetDataIR(const unsigned long measurementIndex,
+                                 const unsigned long receiverIndex,
+                                 const unsigned long emitterIndex,
+                                 std::vector< double > &values) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    const unsigned long N = (unsigned long) GetNumDataSamples();
+    
+    values.resize( N );
+    
+    return sofa::File::getDataIR( measurementIndex, receiverIndex, emitterIndex, &values[0], N );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse response of one measurement, for one receiver and one emitter.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim4)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetDataIR(const unsigned long measurementIndex,
+                                 const unsigned long receiverIndex,
+                                 const unsigned long emitterIndex,
+                                 double *values,
+                                 const unsigned long dim4) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    return sofa::File::getDataIR( measurementIndex, receiverIndex, emitterIndex, values, dim4 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse responses of one measurement, for all receivers and one emitter.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : the array is resized if needed (R x N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetEmitterDataIR(const unsigned long measurementIndex,
+                                        const unsigned long emitterIndex,
+                                        std::vector< double > &values) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    const unsigned long R = (unsigned long) GetNumReceivers();
+    const unsigned long N = (unsigned long) GetNumDataSamples();
+    
+    values.resize( R * N );
+    
+    return sofa::File::getEmitterDataIR( measurementIndex, emitterIndex, &values[0], R, N );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse responses of one measurement, for all receivers and one emitter.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : array containing the values [ R N ].
+ *                  The array must be allocated large enough (dim2 x dim4)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetEmitterDataIR(const unsigned long measurementIndex,
+                                        const unsigned long emitterIndex,
+                                        double *values,
+                                        const unsigned long dim2,
+                                        const unsigned long dim4) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    return sofa::File::getEmitterDataIR( measurementIndex, emitterIndex, values, dim2, dim4 );
+}
+
 
 bool MultiSpeakerBRIR::GetDataDelay(double *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const
 {
@@ -318,4 +522,207 @@ bool MultiSpeakerBRIR::GetDataDelay(double *values, const unsigned long dim1, co
     return sofa::File::getDataDelay( values, dim1, dim2, dim3 );
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough
+ *  @param[in]      dim1 : first dimension (M)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim3 : third dimension (N)
+ *  @param[in]      dim4 : fourth dimension (E)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetDataIR(float *values,
+                                 const unsigned long dim1,
+                                 const unsigned long dim2,
+                                 const unsigned long dim3,
+                                 const unsigned long dim4) const
+{
+    return NetCDFFile::GetValues( values, dim1, dim2, dim3, dim4, "Data.IR" );
+}
+
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values
+ *  @param[in]      values : the array is resized if needed
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetDataIR(std::vector< float > &values) const
+{
+    /// Data.IR is [ M R N E ]
+    
+    return sofa::File::getDataIR( values );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for all receivers and emitters.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : the array is resized if needed (R x E x N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetDataIR(const unsigned long measurementIndex, std::vector< float > &values) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    const unsigned long R = (unsigned long) GetNumReceivers();
+    const unsigned long E = (unsigned long) GetNumEmitters();
+    const unsigned long N = (unsigned long) GetNumDataSamples();
+    
+    values.resize( R * E * N );
+    
+    return sofa::File::getDataIR( measurementIndex, &values[0], R, E, N );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for all receivers and emitters.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim2 x dim3 x dim4)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim3 : third dimension (E)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetDataIR(const unsigned long measurementIndex,
+                                 float *values,
+                                 const unsigned long dim2,
+                                 const unsigned long dim3,
+                                 const unsigned long dim4) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    return sofa::File::getDataIR( measurementIndex, values, dim2, dim3, dim4 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse response of one measurement, for one receiver and one emitter.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : the array is resized if needed (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetDataIR(const unsigned long measurementIndex,
+                                 const unsigned long receiverIndex,
+                                 const unsigned long emitterIndex,
+                                 std::vector< float > &values) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    const unsigned long N = (unsigned long) GetNumDataSamples();
+    
+    values.resize( N );
+    
+    return sofa::File::getDataIR( measurementIndex, receiverIndex, emitterIndex, &values[0], N );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse response of one measurement, for one receiver and one emitter.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim4)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetDataIR(const unsigned long measurementIndex,
+                                 const unsigned long receiverIndex,
+                                 const unsigned long emitterIndex,
+                                 float *values,
+                                 const unsigned long dim4) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    return sofa::File::getDataIR( measurementIndex, receiverIndex, emitterIndex, values, dim4 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse responses of one measurement, for all receivers and one emitter.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : the array is resized if needed (R x N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetEmitterDataIR(const unsigned long measurementIndex,
+                                        const unsigned long emitterIndex,
+                                        std::vector< float > &values) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    const unsigned long R = (unsigned long) GetNumReceivers();
+    const unsigned long N = (unsigned long) GetNumDataSamples();
+    
+    values.resize( R * N );
+    
+    return sofa::File::getEmitterDataIR( measurementIndex, emitterIndex, &values[0], R, N );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse responses of one measurement, for all receivers and one emitter.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      emitterIndex : index of the emitter, in [0 E-1]
+ *  @param[in]      values : array containing the values [ R N ].
+ *                  The array must be allocated large enough (dim2 x dim4)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim4 : fourth dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool MultiSpeakerBRIR::GetEmitterDataIR(const unsigned long measurementIndex,
+                                        const unsigned long emitterIndex,
+                                        float *values,
+                                        const unsigned long dim2,
+                                        const unsigned long dim4) const
+{
+    /// Data.IR is [ M R E N ]
+    
+    return sofa::File::getEmitterDataIR( measurementIndex, emitterIndex, values, dim2, dim4 );
+}
+
+
+bool MultiSpeakerBRIR::GetDataDelay(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const
+{
+    /// Data.Delay is [ I R E ] or [ M R E ]
+    
+    return sofa::File::getDataDelay( values, dim1, dim2, dim3 );
+}
+
  
@@ -0,0 +1,252 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFANcCatalogue.cpp
+ *   @brief      Metadata of a netCDF file, read once when the file is opened
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFANcCatalogue.h"
+#include "../src/SOFANcUtils.h"
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    template< typename AttributeType >
+    sofa::NcCatalogue::Attribute makeAttribute(const std::string &name, const AttributeType &att)
+    {
+        sofa::NcCatalogue::Attribute attribute;
+
+        attribute.name  = name;
+        attribute.type  = sofa::NcUtils::GetType( att ).getId();
+        attribute.value = sofa::NcUtils::GetAttributeValueAsString( att );
+
+        return attribute;
+    }
+
+    template< typename ElementType >
+    const ElementType * find(const std::unordered_map< std::string, std::size_t > &index,
+                             const std::vector< ElementType > &elements,
+                             const std::string &name) SOFA_NOEXCEPT
+    {
+        const std::unordered_map< std::string, std::size_t >::const_iterator it = index.find( name );
+
+        if( it == index.end() )
+        {
+            return NULL;
+        }
+
+        return &elements[ it->second ];
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if the variable has a given attribute
+ *  @param[in]      attributeName : name of the attribute to query
+ *
+ */
+/************************************************************************************/
+bool NcCatalogue::Variable::HasAttribute(const std::string &attributeName) const SOFA_NOEXCEPT
+{
+    for( std::size_t i = 0; i < attributes.size(); i++ )
+    {
+        if( attributes[i].name == attributeName )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads the metadata of a netCDF file
+ *  @param[in]      file : an opened netCDF file
+ *
+ */
+/************************************************************************************/
+NcCatalogue::NcCatalogue(const netCDF::NcFile &file)
+: attributes()
+, dimensions()
+, variables()
+, attributesIndex()
+, dimensionsIndex()
+, variablesIndex()
+{
+    if( sofa::NcUtils::IsValid( file ) == false )
+    {
+        return;
+    }
+
+    {
+        const std::multimap< std::string, netCDF::NcGroupAtt > atts = file.getAtts();
+
+        for( std::multimap< std::string, netCDF::NcGroupAtt >::const_iterator it = atts.begin();
+            it != atts.end();
+            ++it )
+        {
+            if( attributesIndex.count( (*it).first ) == 0 )
+            {
+                attributesIndex[ (*it).first ] = attributes.size();
+                attributes.push_back( sofaLocal::makeAttribute( (*it).first, (*it).second ) );
+            }
+        }
+    }
+
+    {
+        const std::multimap< std::string, netCDF::NcDim > dims = file.getDims();
+
+        for( std::multimap< std::string, netCDF::NcDim >::const_iterator it = dims.begin();
+            it != dims.end();
+            ++it )
+        {
+            if( dimensionsIndex.count( (*it).first ) == 0 && sofa::NcUtils::IsValid( (*it).second ) == true )
+            {
+                Dimension dimension;
+                dimension.name = (*it).first;
+                dimension.size = (*it).second.getSize();
+
+                dimensionsIndex[ (*it).first ] = dimensions.size();
+                dimensions.push_back( dimension );
+            }
+        }
+    }
+
+    {
+        const std::multimap< std::string, netCDF::NcVar > vars = file.getVars();
+
+        variables.reserve( vars.size() );
+
+        for( std::multimap< std::string, netCDF::NcVar >::const_iterator it = vars.begin();
+            it != vars.end();
+            ++it )
+        {
+            const netCDF::NcVar var = (*it).second;
+
+            if( variablesIndex.count( (*it).first ) != 0 || sofa::NcUtils::IsValid( var ) == false )
+            {
+                continue;
+            }
+
+            Variable variable;
+            variable.name   = (*it).first;
+            variable.var    = var;
+            variable.type   = sofa::NcUtils::GetType( var ).getId();
+
+            sofa::NcUtils::GetDimensions( variable.dimensions, var );
+            sofa::NcUtils::GetDimensionsNames( variable.dimensionsNames, var );
+
+            const std::map< std::string, netCDF::NcVarAtt > atts = var.getAtts();
+
+            for( std::map< std::string, netCDF::NcVarAtt >::const_iterator att = atts.begin();
+                att != atts.end();
+                ++att )
+            {
+                variable.attributes.push_back( sofaLocal::makeAttribute( (*att).first, (*att).second ) );
+            }
+
+            variablesIndex[ (*it).first ] = variables.size();
+            variables.push_back( variable );
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+NcCatalogue::~NcCatalogue()
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns a global attribute given its name, or NULL if it does not exist
+ *
+ */
+/************************************************************************************/
+const sofa::NcCatalogue::Attribute * NcCatalogue::GetAttribute(const std::string &attributeName) const SOFA_NOEXCEPT
+{
+    return sofaLocal::find( attributesIndex, attributes, attributeName );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns a dimension given its name, or NULL if it does not exist
+ *
+ */
+/************************************************************************************/
+const sofa::NcCatalogue::Dimension * NcCatalogue::GetDimension(const std::string &dimensionName) const SOFA_NOEXCEPT
+{
+    return sofaLocal::find( dimensionsIndex, dimensions, dimensionName );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns a variable given its name, or NULL if it does not exist
+ *
+ */
+/************************************************************************************/
+const sofa::NcCatalogue::Variable * NcCatalogue::GetVariable(const std::string &variableName) const SOFA_NOEXCEPT
+{
+    return sofaLocal::find( variablesIndex, variables, variableName );
+}
+
+const std::vector< sofa::NcCatalogue::Attribute > & NcCatalogue::GetAttributes() const SOFA_NOEXCEPT
+{
+    return attributes;
+}
+
+const std::vector< sofa::NcCatalogue::Dimension > & NcCatalogue::GetDimensions() const SOFA_NOEXCEPT
+{
+    return dimensions;
+}
+
+const std::vector< sofa::NcCatalogue::Variable > & NcCatalogue::GetVariables() const SOFA_NOEXCEPT
+{
+    return variables;
+}
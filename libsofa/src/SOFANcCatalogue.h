@@ -0,0 +1,138 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFANcCatalogue.h
+ *   @brief      Metadata of a netCDF file, read once when the file is opened
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_NC_CATALOGUE_H__
+#define _SOFA_NC_CATALOGUE_H__
+
+#include "../src/SOFAPlatform.h"
+#include "netcdf.h"
+#include "ncFile.h"
+#include "ncVar.h"
+#include "ncDim.h"
+#include "ncGroupAtt.h"
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+namespace sofa
+{
+
+    /************************************************************************************/
+    /*!
+     *  @class          NcCatalogue
+     *  @brief          Names, types, shapes and attributes of all the dimensions and variables
+     *                  of a netCDF file (global attributes included)
+     *
+     *  @details        The catalogue is built once, when the file is opened, so that the
+     *                  metadata queries (which are performed hundreds of times when validating
+     *                  a SOFA file) are answered without calling the netCDF library.
+     *                  The types are stored as netCDF ids (SOFA only uses the atomic types).
+     *                  The names are stored in alphabetical order (i.e. the order of the
+     *                  maps returned by the netCDF library).
+     */
+    /************************************************************************************/
+    class NcCatalogue
+    {
+    public:
+        struct Attribute
+        {
+            std::string name;
+            nc_type type;                                   ///< NC_NAT if unknown
+            std::string value;                              ///< empty if the attribute is not nc_CHAR
+        };
+
+        struct Dimension
+        {
+            std::string name;
+            std::size_t size;
+        };
+
+        struct Variable
+        {
+            std::string name;
+            netCDF::NcVar var;
+            nc_type type;
+            std::vector< std::size_t > dimensions;
+            std::vector< std::string > dimensionsNames;
+            std::vector< Attribute > attributes;
+
+            bool HasAttribute(const std::string &attributeName) const SOFA_NOEXCEPT;
+        };
+
+    public:
+        explicit NcCatalogue(const netCDF::NcFile &file);
+        ~NcCatalogue();
+
+        const Attribute * GetAttribute(const std::string &attributeName) const SOFA_NOEXCEPT;
+        const Dimension * GetDimension(const std::string &dimensionName) const SOFA_NOEXCEPT;
+        const Variable * GetVariable(const std::string &variableName) const SOFA_NOEXCEPT;
+
+        const std::vector< Attribute > & GetAttributes() const SOFA_NOEXCEPT;
+        const std::vector< Dimension > & GetDimensions() const SOFA_NOEXCEPT;
+        const std::vector< Variable > & GetVariables() const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        typedef std::unordered_map< std::string, std::size_t > Index;
+
+        std::vector< Attribute > attributes;
+        std::vector< Dimension > dimensions;
+        std::vector< Variable > variables;
+
+        Index attributesIndex;
+        Index dimensionsIndex;
+        Index variablesIndex;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( NcCatalogue );
+    };
+
+}
+
+#endif /* _SOFA_NC_CATALOGUE_H__ */
@@ -48,11 +48,413 @@ http://www.sofaconventions.org
 /************************************************************************************/
 #include "../src/SOFANcFile.h"
 #include "../src/SOFANcUtils.h"
+#include "../src/SOFANcCatalogue.h"
 #include "../src/SOFAUtils.h"
 #include "../src/SOFAString.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAHostArchitecture.h"
+#include "netcdf_mem.h"
+#include "netcdf_meta.h"
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+
+#if ( SOFA_WINDOWS == 1 )
+    #include <windows.h>
+#else
+    #include <cstdlib>
+    #include <unistd.h>
+    #include <fcntl.h>
+#endif
 
 using namespace sofa;
 
+namespace sofaLocal
+{
+#if ( NC_VERSION_MAJOR * 100 + NC_VERSION_MINOR < 405 )
+    /// netCDF < 4.5 checks the format of a netCDF-4 file by reading the signature from the path,
+    /// even when the file is opened from memory : the path given to the library is then a file
+    /// which only holds the HDF5 signature (created once, and removed at exit)
+    static const char hdf5Signature[8] = { '\x89', 'H', 'D', 'F', '\r', '\n', '\x1a', '\n' };
+    
+    class SignatureFile
+    {
+    public:
+        SignatureFile()
+        : path()
+        {
+#if ( SOFA_WINDOWS == 1 )
+            char directory[ MAX_PATH + 1 ];
+            char filename[ MAX_PATH + 1 ];
+            
+            if( GetTempPathA( sizeof( directory ), directory ) == 0
+               || GetTempFileNameA( directory, "sofa", 0, filename ) == 0 )
+            {
+                return;
+            }
+            
+            path = filename;
+#else
+            const char *directory = std::getenv( "TMPDIR" );
+            std::string pattern = std::string( ( directory != NULL ) ? directory : "/tmp" ) + "/sofa_hdf5_XXXXXX";
+            
+            const int descriptor = mkstemp( &pattern[0] );
+            
+            if( descriptor < 0 )
+            {
+                return;
+            }
+            
+            close( descriptor );
+            path = pattern;
+#endif
+            
+            FILE *file = std::fopen( path.c_str(), "wb" );
+            
+            if( file == NULL || std::fwrite( hdf5Signature, 1, sizeof( hdf5Signature ), file ) != sizeof( hdf5Signature ) )
+            {
+                path.clear();
+            }
+            
+            if( file != NULL )
+            {
+                std::fclose( file );
+            }
+        }
+        
+        ~SignatureFile()
+        {
+            if( path.empty() == false )
+            {
+                std::remove( path.c_str() );
+            }
+        }
+        
+        std::string path;
+    };
+    
+    inline std::string getMemoryFilePath(const void *buffer, const std::size_t size, const std::string &name)
+    {
+        if( size < sizeof( hdf5Signature ) || std::memcmp( buffer, hdf5Signature, sizeof( hdf5Signature ) ) != 0 )
+        {
+            return name;
+        }
+        
+        static const SignatureFile signatureFile;
+        
+        return ( signatureFile.path.empty() == false ) ? signatureFile.path : name;
+    }
+#else
+    inline std::string getMemoryFilePath(const void *, const std::size_t, const std::string &name)
+    {
+        return name;
+    }
+#endif
+    
+    /// a netCDF file opened with the C API (netCDF::NcFile can only open a path, with the default flags)
+    class OpenedNcFile : public netCDF::NcFile
+    {
+    public:
+        /// the destructor of netCDF::NcFile closes the id : it shall be valid
+        explicit OpenedNcFile(const int ncid)
+        {
+            myId        = ncid;
+            nullObject  = false;
+        }
+    };
+    
+    inline std::shared_ptr< netCDF::NcFile > openMemoryFile(const void *buffer, const std::size_t size, const std::string &name)
+    {
+        const std::string path = getMemoryFilePath( buffer, size, name );
+        
+        int ncid = -1;
+        
+        /// read-only : the library does not modify the buffer
+        const int status = nc_open_mem( path.c_str(), NC_NOWRITE, size, const_cast< void * >( buffer ), &ncid );
+        
+        if( status != NC_NOERR )
+        {
+            SOFA_THROW( "cannot open file from memory : " + std::string( nc_strerror( status ) ) );
+        }
+        
+        return std::make_shared< OpenedNcFile >( ncid );
+    }
+    
+    /// asks the system to load the whole file into its cache (where supported)
+    inline void readAhead(const std::string &path)
+    {
+#if defined( POSIX_FADV_WILLNEED )
+        const int descriptor = open( path.c_str(), O_RDONLY );
+        
+        if( descriptor >= 0 )
+        {
+            posix_fadvise( descriptor, 0, 0, POSIX_FADV_WILLNEED );
+            close( descriptor );
+        }
+#else
+        (void) path;
+#endif
+    }
+    
+    /// sets the chunk cache of the measurement data variables.
+    /// The variables which are not chunked (e.g. in netCDF-3 files) are left unchanged
+    inline void setChunkCache(const int ncid, const sofa::NetCDFFile::OpenOptions &options)
+    {
+        if( options.chunkCacheSize == 0 && options.chunkCacheNumSlots == 0 && options.chunkCachePreemption < 0.0f )
+        {
+            return;
+        }
+        
+        const char * const variableNames[] = { "Data.IR", "Data.Real", "Data.Imag", "Data.SOS" };
+        
+        for( std::size_t i = 0; i < sizeof( variableNames ) / sizeof( variableNames[0] ); i++ )
+        {
+            int varid = -1;
+            
+            if( nc_inq_varid( ncid, variableNames[i], &varid ) != NC_NOERR )
+            {
+                continue;
+            }
+            
+            std::size_t size        = 0;
+            std::size_t numSlots    = 0;
+            float preemption        = 0.0f;
+            
+            if( nc_get_var_chunk_cache( ncid, varid, &size, &numSlots, &preemption ) != NC_NOERR )
+            {
+                continue;
+            }
+            
+            if( options.chunkCacheSize > 0 )
+            {
+                size = options.chunkCacheSize;
+            }
+            if( options.chunkCacheNumSlots > 0 )
+            {
+                numSlots = options.chunkCacheNumSlots;
+            }
+            if( options.chunkCachePreemption >= 0.0f )
+            {
+                preemption = std::min( options.chunkCachePreemption, 1.0f );
+            }
+            
+            nc_set_var_chunk_cache( ncid, varid, size, numSlots, preemption );
+        }
+    }
+    
+    inline std::shared_ptr< netCDF::NcFile > openFile(const std::string &path, const sofa::NetCDFFile::OpenOptions &options)
+    {
+        if( options.readAhead == true )
+        {
+            readAhead( path );
+        }
+        
+        int mode = NC_NOWRITE;
+        
+        if( options.diskless == true )
+        {
+            mode |= NC_DISKLESS;
+        }
+        
+        int ncid = -1;
+        
+        const int status = nc_open( path.c_str(), mode, &ncid );
+        
+        if( status != NC_NOERR )
+        {
+            SOFA_THROW( "cannot open file " + path + " : " + std::string( nc_strerror( status ) ) );
+        }
+        
+        setChunkCache( ncid, options );
+        
+        return std::make_shared< OpenedNcFile >( ncid );
+    }
+    
+    /// only floating-point variables can be read as float or double :
+    /// netCDF converts the values when the storage type differs
+    inline bool isFloatingPointVariable(const netCDF::NcVar &var)
+    {
+        return ( sofa::NcUtils::IsValid( var ) == true && sofa::NcUtils::IsFloatingPoint( var ) == true );
+    }
+    
+    template< typename Type >
+    bool getValues(Type *values,
+                   const netCDF::NcVar &var,
+                   const std::size_t dim1,
+                   const std::size_t dim2)
+    {
+        if( isFloatingPointVariable( var ) == false )
+        {
+            return false;
+        }
+        
+        if( sofa::NcUtils::HasDimensions( dim1, dim2, var ) == false )
+        {
+            return false;
+        }
+        
+        var.getVar( values );
+        
+        return true;
+    }
+    
+    template< typename Type >
+    bool getValues(Type *values,
+                   const netCDF::NcVar &var,
+                   const std::size_t dim1,
+                   const std::size_t dim2,
+                   const std::size_t dim3)
+    {
+        if( isFloatingPointVariable( var ) == false )
+        {
+            return false;
+        }
+        
+        if( sofa::NcUtils::HasDimensions( dim1, dim2, dim3, var ) == false )
+        {
+            return false;
+        }
+        
+        var.getVar( values );
+        
+        return true;
+    }
+    
+    template< typename Type >
+    bool getValues(Type *values,
+                   const netCDF::NcVar &var,
+                   const std::size_t dim1,
+                   const std::size_t dim2,
+                   const std::size_t dim3,
+                   const std::size_t dim4)
+    {
+        if( isFloatingPointVariable( var ) == false )
+        {
+            return false;
+        }
+        
+        if( sofa::NcUtils::HasDimensions( dim1, dim2, dim3, dim4, var ) == false )
+        {
+            return false;
+        }
+        
+        var.getVar( values );
+        
+        return true;
+    }
+    
+    template< typename Type >
+    bool getValues(std::vector< Type > &values,
+                   const netCDF::NcVar &var)
+    {
+        if( isFloatingPointVariable( var ) == false )
+        {
+            return false;
+        }
+        
+        std::vector< std::size_t > dims;
+        sofa::NcUtils::GetDimensions( dims, var );
+        
+        if( dims.size() == 0 )
+        {
+            return false;
+        }
+        
+        std::size_t totalSize = dims[0];
+        for( std::size_t i = 1; i < dims.size(); i++ )
+        {
+            totalSize *= dims[i];
+        }
+        
+        values.resize( totalSize );
+        
+        SOFA_ASSERT( totalSize > 0 );
+        
+        var.getVar( &values[0] );
+        
+        return true;
+    }
+    
+    template< typename Type >
+    bool getValues(Type *values,
+                   const netCDF::NcVar &var,
+                   const std::vector< std::size_t > &start,
+                   const std::vector< std::size_t > &count)
+    {
+        if( isFloatingPointVariable( var ) == false )
+        {
+            return false;
+        }
+        
+        std::vector< std::size_t > dims;
+        sofa::NcUtils::GetDimensions( dims, var );
+        
+        if( dims.size() == 0
+         || start.size() != dims.size()
+         || count.size() != dims.size() )
+        {
+            return false;
+        }
+        
+        for( std::size_t i = 0; i < dims.size(); i++ )
+        {
+            if( count[i] == 0 || start[i] + count[i] > dims[i] )
+            {
+                return false;
+            }
+        }
+        
+        SOFA_ASSERT( values != nullptr );
+        
+        var.getVar( start, count, values );
+        
+        return true;
+    }
+    
+    template< typename Type >
+    bool getValues(std::vector< Type > &values,
+                   const netCDF::NcVar &var,
+                   const std::vector< std::size_t > &start,
+                   const std::vector< std::size_t > &count)
+    {
+        if( count.size() == 0 )
+        {
+            return false;
+        }
+        
+        std::size_t totalSize = count[0];
+        for( std::size_t i = 1; i < count.size(); i++ )
+        {
+            totalSize *= count[i];
+        }
+        
+        if( totalSize == 0 )
+        {
+            return false;
+        }
+        
+        values.resize( totalSize );
+        
+        return getValues( &values[0], var, start, count );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the mutex serializing the calls to the netCDF library
+ *
+ *  @details        The netCDF and HDF5 libraries are not thread-safe : a NetCDFFile (or any
+ *                  derived class) shall not be used by several threads simultaneously, and the
+ *                  threads opening, reading or closing files (even different files) shall hold
+ *                  this mutex meanwhile. sofa::SharedFile and sofa::DatasetCache do so internally.
+ */
+/************************************************************************************/
+std::recursive_mutex & NetCDFFile::GetLibraryMutex()
+{
+    static std::recursive_mutex libraryMutex;
+    return libraryMutex;
+}
+
 /************************************************************************************/
 /*!
  *  @brief          Class constructor
@@ -63,11 +465,83 @@ using namespace sofa;
 /************************************************************************************/
 NetCDFFile::NetCDFFile(const std::string & path,
                        const netCDF::NcFile::FileMode &mode)
-: file( path, mode )
+: handle( std::make_shared< netCDF::NcFile >( path, mode ) )
+, catalogue( std::make_shared< const sofa::NcCatalogue >( *handle ) )
+, file( *handle )
+, filename( path )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Default options : the storage access is left to the library
+ *
+ */
+/************************************************************************************/
+NetCDFFile::OpenOptions::OpenOptions()
+: diskless( false )
+, readAhead( false )
+, chunkCacheSize( 0 )
+, chunkCacheNumSlots( 0 )
+, chunkCachePreemption( -1.0f )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file for reading, with tuned storage access
+ *  @param[in]      path : the file path
+ *  @param[in]      options : chunk cache, diskless and read-ahead options
+ *
+ *  @details        The chunk cache trades the latency of random measurement reads against
+ *                  memory : it should hold at least one chunk of the measurement data
+ */
+/************************************************************************************/
+NetCDFFile::NetCDFFile(const std::string &path,
+                       const OpenOptions &options)
+: handle( sofaLocal::openFile( path, options ) )
+, catalogue( std::make_shared< const sofa::NcCatalogue >( *handle ) )
+, file( *handle )
 , filename( path )
 {
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file stored in memory (read-only, without copy)
+ *  @param[in]      buffer : the content of the file. It shall outlive this object
+ *  @param[in]      size : size of the buffer, in bytes
+ *  @param[in]      name : name returned by GetFilename()
+ *
+ *  @details        This allows to read files packed in an archive, without writing them to disk
+ */
+/************************************************************************************/
+NetCDFFile::NetCDFFile(const void *buffer,
+                       const std::size_t size,
+                       const std::string &name)
+: handle( sofaLocal::openMemoryFile( buffer, size, name ) )
+, catalogue( std::make_shared< const sofa::NcCatalogue >( *handle ) )
+, file( *handle )
+, filename( name )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a view on a file already opened,
+ *                  sharing its netCDF handle (the file is not opened again)
+ *  @param[in]      other : the opened file
+ *
+ */
+/************************************************************************************/
+NetCDFFile::NetCDFFile(const sofa::NetCDFFile *other)
+: handle( other->handle )
+, catalogue( other->catalogue )
+, file( *handle )
+, filename( other->filename )
+{
+}
+
 /************************************************************************************/
 /*!
  *  @brief          Returns true if this is a valid netCDF file
@@ -98,21 +572,13 @@ const std::string & NetCDFFile::GetFilename() const
 /************************************************************************************/
 void NetCDFFile::GetAllAttributesNames(std::vector< std::string > &attributeNames) const
 {        
-    const std::multimap< std::string, netCDF::NcGroupAtt > attributes = file.getAtts();
-    
-    const std::size_t size = attributes.size();
+    const std::vector< sofa::NcCatalogue::Attribute > &attributes = catalogue->GetAttributes();
     
-    attributeNames.resize( size );
+    attributeNames.resize( attributes.size() );
     
-    std::size_t i = 0;
-    for( std::multimap< std::string, netCDF::NcGroupAtt >::const_iterator it = attributes.begin();
-        it != attributes.end();
-        ++it )
+    for( std::size_t i = 0; i < attributes.size(); i++ )
     {
-        const std::string attributeName = (*it).first;
-        
-        attributeNames[ i ] = attributeName;
-        i++;
+        attributeNames[ i ] = attributes[i].name;
     }
 }
 
@@ -129,21 +595,14 @@ void NetCDFFile::GetAllCharAttributes(std::vector< std::string > &attributeNames
     attributeNames.clear();
     attributeValues.clear();
     
-    const std::multimap< std::string, netCDF::NcGroupAtt > attributes = file.getAtts();
+    const std::vector< sofa::NcCatalogue::Attribute > &attributes = catalogue->GetAttributes();
     
-    for( std::multimap< std::string, netCDF::NcGroupAtt >::const_iterator it = attributes.begin();
-        it != attributes.end();
-        ++it )
+    for( std::size_t i = 0; i < attributes.size(); i++ )
     {
-        const std::string attributeName = (*it).first;
-        const netCDF::NcGroupAtt att    = (*it).second;
-        
-        if( sofa::NcUtils::IsChar( att ) == true )
+        if( attributes[i].type == NC_CHAR )
         {
-            const std::string value = sofa::NcUtils::GetAttributeValueAsString( att );
-            
-            attributeNames.push_back( attributeName );
-            attributeValues.push_back( value );
+            attributeNames.push_back( attributes[i].name );
+            attributeValues.push_back( attributes[i].value );
         }
     }
 }
@@ -188,19 +647,13 @@ void NetCDFFile::PrintAllAttributes(std::ostream & output,
 /************************************************************************************/
 void NetCDFFile::GetAllDimensionsNames(std::vector< std::string > &dimensionNames) const
 {
-    const std::multimap< std::string, netCDF::NcDim > dims = file.getDims();
-    
-    const std::size_t size = dims.size();
+    const std::vector< sofa::NcCatalogue::Dimension > &dimensions = catalogue->GetDimensions();
     
-    dimensionNames.resize( size );
+    dimensionNames.resize( dimensions.size() );
     
-    std::size_t i = 0;
-    for( std::multimap< std::string, netCDF::NcDim >::const_iterator it = dims.begin();
-        it != dims.end();
-        ++it )
+    for( std::size_t i = 0; i < dimensions.size(); i++ )
     {
-        dimensionNames[i] = (*it).first;
-        i++;
+        dimensionNames[i] = dimensions[i].name;
     }
 }
 
@@ -213,20 +666,11 @@ void NetCDFFile::GetAllDimensionsNames(std::vector< std::string > &dimensionName
 /************************************************************************************/
 void NetCDFFile::PrintAllDimensions(std::ostream & output) const
 {
-    const std::multimap< std::string, netCDF::NcDim > dims = file.getDims();
+    const std::vector< sofa::NcCatalogue::Dimension > &dimensions = catalogue->GetDimensions();
     
-    for( std::multimap< std::string, netCDF::NcDim >::const_iterator it = dims.begin();
-        it != dims.end();
-        ++it )
+    for( std::size_t i = 0; i < dimensions.size(); i++ )
     {
-        const std::string dimName = (*it).first;
-        const netCDF::NcDim dim   = (*it).second;
-        
-        if( sofa::NcUtils::IsValid( dim ) == true )
-        {
-            const std::size_t size = dim.getSize();
-            output << dimName << " = " << size << std::endl;
-        }
+        output << dimensions[i].name << " = " << dimensions[i].size << std::endl;
     }
 }
 
@@ -238,19 +682,13 @@ void NetCDFFile::PrintAllDimensions(std::ostream & output) const
 /************************************************************************************/
 void NetCDFFile::GetAllVariablesNames(std::vector< std::string > &variableNames) const
 {
-    const std::multimap< std::string, netCDF::NcVar > vars = file.getVars();
+    const std::vector< sofa::NcCatalogue::Variable > &variables = catalogue->GetVariables();
     
-    const std::size_t size = vars.size();
+    variableNames.resize( variables.size() );
     
-    variableNames.resize( size );
-    
-    std::size_t i = 0;
-    for( std::multimap< std::string, netCDF::NcVar >::const_iterator it = vars.begin();
-        it != vars.end();
-        ++it )
+    for( std::size_t i = 0; i < variables.size(); i++ )
     {
-        variableNames[i]       = (*it).first;
-        i++;
+        variableNames[i] = variables[i].name;
     }
 }
 
@@ -263,19 +701,13 @@ void NetCDFFile::GetAllVariablesNames(std::vector< std::string > &variableNames)
 /************************************************************************************/
 void NetCDFFile::PrintAllVariables(std::ostream & output) const
 {
-    /// retrieves all the variables
-    const std::multimap< std::string, netCDF::NcVar > vars = file.getVars();
+    const std::vector< sofa::NcCatalogue::Variable > &variables = catalogue->GetVariables();
     
-    for( std::multimap< std::string, netCDF::NcVar >::const_iterator it = vars.begin();
-        it != vars.end();
-        ++it )
+    for( std::size_t i = 0; i < variables.size(); i++ )
     {
-        const std::string varName       = (*it).first;
-        
-        std::vector< std::size_t > dimensions;
-        GetVariableDimensions( dimensions, varName ),
+        const std::vector< std::size_t > &dimensions = variables[i].dimensions;
         
-        output << varName << " = " << "(";
+        output << variables[i].name << " = " << "(";
         
         for( std::size_t k = 0; k < dimensions.size(); k++ )
         {
@@ -287,9 +719,7 @@ void NetCDFFile::PrintAllVariables(std::ostream & output) const
             }
         }
         output << ")" << std::endl;
-        
     }
-    
 }
 
 /************************************************************************************/
@@ -300,9 +730,7 @@ void NetCDFFile::PrintAllVariables(std::ostream & output) const
 /************************************************************************************/
 unsigned int NetCDFFile::GetNumGlobalAttributes() const
 {
-    const int nattr = file.getAttCount();
-    
-    return (unsigned int) sofa::smax( (int) 0 , nattr );
+    return (unsigned int) catalogue->GetAttributes().size();
 }
 
 /************************************************************************************/
@@ -313,9 +741,7 @@ unsigned int NetCDFFile::GetNumGlobalAttributes() const
 /************************************************************************************/
 unsigned int NetCDFFile::GetNumDimensions() const
 {
-    const int ndims = file.getDimCount();
-    
-    return (unsigned int) sofa::smax( (int) 0 , ndims );
+    return (unsigned int) catalogue->GetDimensions().size();
 }
 
 /************************************************************************************/
@@ -326,9 +752,7 @@ unsigned int NetCDFFile::GetNumDimensions() const
 /************************************************************************************/
 unsigned int NetCDFFile::GetNumVariables() const
 {
-    const int nvars = file.getVarCount();
-    
-    return (unsigned int) sofa::smax( (int) 0 , nvars );
+    return (unsigned int) catalogue->GetVariables().size();
 }
 
 /************************************************************************************/
@@ -340,15 +764,9 @@ unsigned int NetCDFFile::GetNumVariables() const
 /************************************************************************************/
 std::size_t NetCDFFile::GetDimension(const std::string &dimensionName) const
 {
-    if( HasDimension( dimensionName ) == false )
-    {
-        return 0;
-    }
-    else
-    {
-        const netCDF::NcDim dim = file.getDim( dimensionName );
-        return dim.getSize();
-    }
+    const sofa::NcCatalogue::Dimension *dimension = catalogue->GetDimension( dimensionName );
+    
+    return ( dimension != NULL ) ? dimension->size : 0;
 }
 
 /************************************************************************************/
@@ -360,9 +778,7 @@ std::size_t NetCDFFile::GetDimension(const std::string &dimensionName) const
 /************************************************************************************/
 bool NetCDFFile::HasDimension(const std::string &dimensionName) const
 {
-    const netCDF::NcDim dim = getDimension( dimensionName );
-    
-    return sofa::NcUtils::IsValid( dim );
+    return ( catalogue->GetDimension( dimensionName ) != NULL );
 }
 
 /************************************************************************************/
@@ -374,9 +790,7 @@ bool NetCDFFile::HasDimension(const std::string &dimensionName) const
 /************************************************************************************/
 bool NetCDFFile::HasVariable(const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    
-    return sofa::NcUtils::IsValid( var );
+    return ( catalogue->GetVariable( variableName ) != NULL );
 }
 
 /************************************************************************************/
@@ -389,9 +803,9 @@ bool NetCDFFile::HasVariable(const std::string &variableName) const
 /************************************************************************************/
 netCDF::NcType NetCDFFile::GetAttributeType(const std::string &attributeName) const
 {
-    const netCDF::NcGroupAtt att = getAttribute( attributeName );
+    const sofa::NcCatalogue::Attribute *attribute = catalogue->GetAttribute( attributeName );
     
-    return sofa::NcUtils::GetType( att );
+    return ( attribute != NULL ) ? netCDF::NcType( attribute->type ) : netCDF::NcType();
 }
 
 /************************************************************************************/
@@ -404,8 +818,9 @@ netCDF::NcType NetCDFFile::GetAttributeType(const std::string &attributeName) co
 /************************************************************************************/
 int NetCDFFile::GetVariableDimensionality(const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    return sofa::NcUtils::GetDimensionality( var );
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
+    
+    return ( variable != NULL ) ? (int) variable->dimensions.size() : -1;
 }
 
 /************************************************************************************/
@@ -482,8 +897,16 @@ std::string NetCDFFile::GetVariableDimensionsAsString(const std::string &variabl
 /************************************************************************************/
 void NetCDFFile::GetVariableDimensionsNames(std::vector< std::string > &dims, const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    sofa::NcUtils::GetDimensionsNames( dims, var );
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
+    
+    if( variable != NULL )
+    {
+        dims = variable->dimensionsNames;
+    }
+    else
+    {
+        dims.clear();
+    }
 }
 
 /************************************************************************************/
@@ -496,8 +919,16 @@ void NetCDFFile::GetVariableDimensionsNames(std::vector< std::string > &dims, co
 /************************************************************************************/
 void NetCDFFile::GetVariableDimensions(std::vector< std::size_t > &dims, const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    sofa::NcUtils::GetDimensions( dims, var );    
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
+    
+    if( variable != NULL )
+    {
+        dims = variable->dimensions;
+    }
+    else
+    {
+        dims.clear();
+    }
 }
 
 /************************************************************************************/
@@ -509,8 +940,7 @@ void NetCDFFile::GetVariableDimensions(std::vector< std::size_t > &dims, const s
 /************************************************************************************/
 bool NetCDFFile::VariableIsScalar(const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    return sofa::NcUtils::IsScalar( var );
+    return VariableHasDimension( 1, variableName );
 }
 
 /************************************************************************************/
@@ -523,8 +953,9 @@ bool NetCDFFile::VariableIsScalar(const std::string &variableName) const
 /************************************************************************************/
 netCDF::NcType NetCDFFile::GetVariableType(const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    return sofa::NcUtils::GetType( var );
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
+    
+    return ( variable != NULL ) ? netCDF::NcType( variable->type ) : netCDF::NcType();
 }
 
 /************************************************************************************/
@@ -544,16 +975,23 @@ std::string NetCDFFile::GetVariableTypeName(const std::string &variableName) con
 bool NetCDFFile::VariableHasDimension(const std::size_t dim,
                                       const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    return sofa::NcUtils::HasDimension( dim, var );    
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
+    
+    return ( variable != NULL
+            && variable->dimensions.size() == 1
+            && variable->dimensions[0] == dim );
 }
 
 bool NetCDFFile::VariableHasDimensions(const std::size_t dim1,
                                        const std::size_t dim2,
                                        const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    return sofa::NcUtils::HasDimensions( dim1, dim2, var );    
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
+    
+    return ( variable != NULL
+            && variable->dimensions.size() == 2
+            && variable->dimensions[0] == dim1
+            && variable->dimensions[1] == dim2 );
 }
 
 bool NetCDFFile::VariableHasDimensions(const std::size_t dim1,
@@ -561,8 +999,13 @@ bool NetCDFFile::VariableHasDimensions(const std::size_t dim1,
                                        const std::size_t dim3,
                                        const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    return sofa::NcUtils::HasDimensions( dim1, dim2, dim3, var );
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
+    
+    return ( variable != NULL
+            && variable->dimensions.size() == 3
+            && variable->dimensions[0] == dim1
+            && variable->dimensions[1] == dim2
+            && variable->dimensions[2] == dim3 );
 }
 
 bool NetCDFFile::VariableHasDimensions(const std::size_t dim1,
@@ -571,8 +1014,14 @@ bool NetCDFFile::VariableHasDimensions(const std::size_t dim1,
                                        const std::size_t dim4,
                                        const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    return sofa::NcUtils::HasDimensions( dim1, dim2, dim3, dim4, var );
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
+    
+    return ( variable != NULL
+            && variable->dimensions.size() == 4
+            && variable->dimensions[0] == dim1
+            && variable->dimensions[1] == dim2
+            && variable->dimensions[2] == dim3
+            && variable->dimensions[3] == dim4 );
 }
 
 /************************************************************************************/
@@ -585,8 +1034,9 @@ bool NetCDFFile::VariableHasDimensions(const std::size_t dim1,
 /************************************************************************************/
 bool NetCDFFile::VariableHasAttribute(const std::string &attributeName, const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    return sofa::NcUtils::HasAttribute( var, attributeName );
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
+    
+    return ( variable != NULL && variable->HasAttribute( attributeName ) == true );
 }
 
 /************************************************************************************/
@@ -599,22 +1049,16 @@ bool NetCDFFile::VariableHasAttribute(const std::string &attributeName, const st
 void NetCDFFile::GetVariablesAttributes(std::vector< std::string > &attributeNames,
                                         const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
     
-    if( sofa::NcUtils::IsValid( var ) == true )
+    if( variable != NULL )
     {
-        const std::map< std::string, netCDF::NcVarAtt > attributes = var.getAtts();
-        
-        const std::size_t size = attributes.size();
+        const std::size_t size = variable->attributes.size();
         attributeNames.resize( size );
         
-        std::size_t i = 0;
-        for( std::multimap< std::string, netCDF::NcVarAtt >::const_iterator it = attributes.begin();
-            it != attributes.end();
-            ++it )
+        for( std::size_t i = 0; i < size; i++ )
         {
-            attributeNames[i] = (*it).first;
-            i++;
+            attributeNames[i] = variable->attributes[i].name;
         }
     }
     else
@@ -635,27 +1079,18 @@ void NetCDFFile::GetVariablesAttributes(std::vector< std::string > &attributeNam
                                         std::vector< std::string > &attributeValues,
                                         const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
     
-    if( sofa::NcUtils::IsValid( var ) == true )
+    if( variable != NULL )
     {
-        const std::map< std::string, netCDF::NcVarAtt > attributes = var.getAtts();
-        
-        const std::size_t size = attributes.size();
+        const std::size_t size = variable->attributes.size();
         attributeNames.resize( size );
         attributeValues.resize( size );
         
-        std::size_t i = 0;
-        for( std::multimap< std::string, netCDF::NcVarAtt >::const_iterator it = attributes.begin();
-            it != attributes.end();
-            ++it )
+        for( std::size_t i = 0; i < size; i++ )
         {
-            attributeNames[i]   = (*it).first;
-            const netCDF::NcVarAtt att = (*it).second;
-            
-            attributeValues[i] = sofa::NcUtils::GetAttributeValueAsString( att );
-            
-            i++;
+            attributeNames[i]   = variable->attributes[i].name;
+            attributeValues[i]  = variable->attributes[i].value;
         }
     }
     else
@@ -677,8 +1112,9 @@ void NetCDFFile::GetVariablesAttributes(std::vector< std::string > &attributeNam
 /************************************************************************************/
 bool NetCDFFile::HasVariableType(const netCDF::NcType &type_, const std::string &variableName) const
 {
-    const netCDF::NcVar var = getVariable( variableName );
-    return sofa::NcUtils::CheckType( var, type_ );    
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
+    
+    return ( variable != NULL && variable->type == type_.getId() );
 }
 
 /************************************************************************************/
@@ -690,9 +1126,7 @@ bool NetCDFFile::HasVariableType(const netCDF::NcType &type_, const std::string
 /************************************************************************************/
 bool NetCDFFile::HasAttribute(const std::string & attributeName) const
 {
-    const netCDF::NcGroupAtt att = getAttribute( attributeName );
-    
-    return sofa::NcUtils::IsValid( att );
+    return ( catalogue->GetAttribute( attributeName ) != NULL );
 }
 
 /************************************************************************************/
@@ -705,14 +1139,9 @@ bool NetCDFFile::HasAttribute(const std::string & attributeName) const
 /************************************************************************************/
 std::string NetCDFFile::GetAttributeValueAsString(const std::string &attributeName) const
 {
-    if( HasAttribute( attributeName ) == false )
-    {
-        return std::string();
-    }
+    const sofa::NcCatalogue::Attribute *attribute = catalogue->GetAttribute( attributeName );
     
-    const netCDF::NcGroupAtt att = file.getAtt( attributeName );
-    
-    return sofa::NcUtils::GetAttributeValueAsString( att );
+    return ( attribute != NULL ) ? attribute->value : std::string();
 }
 
 /************************************************************************************/
@@ -725,29 +1154,21 @@ std::string NetCDFFile::GetAttributeValueAsString(const std::string &attributeNa
 /************************************************************************************/
 netCDF::NcGroupAtt NetCDFFile::getAttribute(const std::string &attributeName) const
 {    
-    if( attributeName.empty() == true )
+    if( catalogue->GetAttribute( attributeName ) == NULL )
     {
         /// returns a null object
         return netCDF::NcGroupAtt();
     }
     
-    const std::multimap< std::string, netCDF::NcGroupAtt > attributes = file.getAtts();
+    /// NcGroup::getAtt() would list all the attributes again : look up this one only
+    int attributeId = -1;
     
-    for( std::multimap< std::string, netCDF::NcGroupAtt >::const_iterator it = attributes.begin();
-        it != attributes.end();
-        ++it )
+    if( nc_inq_attid( file.getId(), NC_GLOBAL, attributeName.c_str(), &attributeId ) != NC_NOERR )
     {
-        const std::string attrName      = (*it).first;
-        
-        if( attrName == attributeName )
-        {
-            const netCDF::NcGroupAtt att    = (*it).second;
-            
-            return att;
-        }
+        return netCDF::NcGroupAtt();
     }
     
-    return netCDF::NcGroupAtt();
+    return netCDF::NcGroupAtt( file, attributeId );
 }
 
 /************************************************************************************/
@@ -760,30 +1181,13 @@ netCDF::NcGroupAtt NetCDFFile::getAttribute(const std::string &attributeName) co
 /************************************************************************************/
 netCDF::NcDim NetCDFFile::getDimension(const std::string &dimensionName) const
 {
-    if( dimensionName.empty() == true )
+    if( catalogue->GetDimension( dimensionName ) == NULL )
     {
         /// returns a null object
         return netCDF::NcDim();
     }
     
-    const std::multimap< std::string, netCDF::NcDim > dims = file.getDims();
-    
-    for( std::multimap< std::string, netCDF::NcDim >::const_iterator it = dims.begin();
-        it != dims.end();
-        ++it )
-    {
-        const std::string dimName = (*it).first;
-        
-        if( dimName == dimensionName )
-        {
-            const netCDF::NcDim dim   = (*it).second;
-            return dim;
-        }
-        
-    }
-    
-    /// returns a null object
-    return netCDF::NcDim();
+    return file.getDim( dimensionName );
 }
 
 /************************************************************************************/
@@ -796,29 +1200,15 @@ netCDF::NcDim NetCDFFile::getDimension(const std::string &dimensionName) const
 /************************************************************************************/
 netCDF::NcVar NetCDFFile::getVariable(const std::string &variableName) const
 {
-    if( variableName.empty() == true )
+    const sofa::NcCatalogue::Variable *variable = catalogue->GetVariable( variableName );
+    
+    if( variable == NULL )
     {
         /// returns a null object
         return netCDF::NcVar();
     }
     
-    const std::multimap< std::string, netCDF::NcVar > vars = file.getVars();
-    
-    for( std::multimap< std::string, netCDF::NcVar >::const_iterator it = vars.begin();
-        it != vars.end();
-        ++it )
-    {
-        const std::string varName       = (*it).first;
-        
-        if( varName == variableName )
-        {
-            const netCDF::NcVar var         = (*it).second;
-            return var;
-        }
-    }
-    
-    /// returns a null object
-    return netCDF::NcVar();
+    return variable->var;
 }
 
 
@@ -833,8 +1223,8 @@ netCDF::NcVar NetCDFFile::getVariable(const std::string &variableName) const
 /************************************************************************************/
 bool NetCDFFile::IsAttributeFloat(const std::string &attributeName) const
 {
-    const netCDF::NcGroupAtt attr = getAttribute( attributeName );
-    return sofa::NcUtils::IsFloat( attr );
+    const sofa::NcCatalogue::Attribute *attribute = catalogue->GetAttribute( attributeName );
+    return ( attribute != NULL && attribute->type == NC_FLOAT );
 }
 
 /************************************************************************************/
@@ -848,8 +1238,8 @@ bool NetCDFFile::IsAttributeFloat(const std::string &attributeName) const
 /************************************************************************************/
 bool NetCDFFile::IsAttributeDouble(const std::string &attributeName) const
 {
-    const netCDF::NcGroupAtt attr = getAttribute( attributeName );
-    return sofa::NcUtils::IsDouble( attr );
+    const sofa::NcCatalogue::Attribute *attribute = catalogue->GetAttribute( attributeName );
+    return ( attribute != NULL && attribute->type == NC_DOUBLE );
 }
 
 /************************************************************************************/
@@ -863,8 +1253,8 @@ bool NetCDFFile::IsAttributeDouble(const std::string &attributeName) const
 /************************************************************************************/
 bool NetCDFFile::IsAttributeByte(const std::string &attributeName) const
 {
-    const netCDF::NcGroupAtt attr = getAttribute( attributeName );
-    return sofa::NcUtils::IsByte( attr );
+    const sofa::NcCatalogue::Attribute *attribute = catalogue->GetAttribute( attributeName );
+    return ( attribute != NULL && attribute->type == NC_BYTE );
 }
 
 /************************************************************************************/
@@ -878,8 +1268,8 @@ bool NetCDFFile::IsAttributeByte(const std::string &attributeName) const
 /************************************************************************************/
 bool NetCDFFile::IsAttributeChar(const std::string &attributeName) const
 {
-    const netCDF::NcGroupAtt attr = getAttribute( attributeName );
-    return sofa::NcUtils::IsChar( attr );
+    const sofa::NcCatalogue::Attribute *attribute = catalogue->GetAttribute( attributeName );
+    return ( attribute != NULL && attribute->type == NC_CHAR );
 }
 
 /************************************************************************************/
@@ -893,8 +1283,8 @@ bool NetCDFFile::IsAttributeChar(const std::string &attributeName) const
 /************************************************************************************/
 bool NetCDFFile::IsAttributeShort(const std::string &attributeName) const
 {
-    const netCDF::NcGroupAtt attr = getAttribute( attributeName );
-    return sofa::NcUtils::IsShort( attr );
+    const sofa::NcCatalogue::Attribute *attribute = catalogue->GetAttribute( attributeName );
+    return ( attribute != NULL && attribute->type == NC_SHORT );
 }
 
 /************************************************************************************/
@@ -908,8 +1298,8 @@ bool NetCDFFile::IsAttributeShort(const std::string &attributeName) const
 /************************************************************************************/
 bool NetCDFFile::IsAttributeInt(const std::string &attributeName) const
 {
-    const netCDF::NcGroupAtt attr = getAttribute( attributeName );
-    return sofa::NcUtils::IsInt( attr );
+    const sofa::NcCatalogue::Attribute *attribute = catalogue->GetAttribute( attributeName );
+    return ( attribute != NULL && attribute->type == NC_INT );
 }
 
 /************************************************************************************/
@@ -923,15 +1313,15 @@ bool NetCDFFile::IsAttributeInt(const std::string &attributeName) const
 /************************************************************************************/
 bool NetCDFFile::IsAttributeInt64(const std::string &attributeName) const
 {
-    const netCDF::NcGroupAtt attr = getAttribute( attributeName );
-    return sofa::NcUtils::IsInt64( attr );
+    const sofa::NcCatalogue::Attribute *attribute = catalogue->GetAttribute( attributeName );
+    return ( attribute != NULL && attribute->type == NC_INT64 );
 }
 
 /************************************************************************************/
 /*!
- *  @brief          Reads values of variable stored as a 2-dimensional array of double
+ *  @brief          Reads values of variable stored as a 2-dimensional array of floating-point values, as double
  *                  Returns true if everything goes well, false otherwise (not a valid variable,
- *                  not a double variable, not the proper dimensions)
+ *                  not a floating-point variable, not the proper dimensions)
  *  @param[out]     values :
  *  @param[in]      variableName : the named variable to query
  *  @param[in]      dim1 : first dimension of the array
@@ -944,34 +1334,14 @@ bool NetCDFFile::GetValues(double *values,
                            const std::size_t dim2,
                            const std::string &variableName) const
 {
-    const netCDF::NcVar var = NetCDFFile::getVariable( variableName );
-    
-    if( sofa::NcUtils::IsValid( var ) == false )
-    {
-        return false;
-    }
-    
-    if( sofa::NcUtils::IsDouble( var ) == false )
-    {
-        return false;
-    }
-    
-    if( sofa::NcUtils::HasDimensions( dim1, dim2, var ) == false )
-    {
-        return false;
-    }
-    
-    var.getVar( values );
-    
-    return true;
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ), dim1, dim2 );
 }
 
-
 /************************************************************************************/
 /*!
- *  @brief          Reads values of variable stored as a 3-dimensional array of double
+ *  @brief          Reads values of variable stored as a 3-dimensional array of floating-point values, as double
  *                  Returns true if everything goes well, false otherwise (not a valid variable,
- *                  not a double variable, not the proper dimensions)
+ *                  not a floating-point variable, not the proper dimensions)
  *  @param[out]     values :
  *  @param[in]      variableName : the named variable to query
  *  @param[in]      dim1 : first dimension of the array
@@ -986,33 +1356,14 @@ bool NetCDFFile::GetValues(double *values,
                            const std::size_t dim3,
                            const std::string &variableName) const
 {
-    const netCDF::NcVar var = NetCDFFile::getVariable( variableName );
-    
-    if( sofa::NcUtils::IsValid( var ) == false )
-    {
-        return false;
-    }
-    
-    if( sofa::NcUtils::IsDouble( var ) == false )
-    {
-        return false;
-    }
-    
-    if( sofa::NcUtils::HasDimensions( dim1, dim2, dim3, var ) == false )
-    {
-        return false;
-    }
-    
-    var.getVar( values );
-    
-    return true;
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ), dim1, dim2, dim3 );
 }
 
 /************************************************************************************/
 /*!
- *  @brief          Reads values of variable stored as a 3-dimensional array of double
+ *  @brief          Reads values of variable stored as a 4-dimensional array of floating-point values, as double
  *                  Returns true if everything goes well, false otherwise (not a valid variable,
- *                  not a double variable, not the proper dimensions)
+ *                  not a floating-point variable, not the proper dimensions)
  *  @param[out]     values :
  *  @param[in]      variableName : the named variable to query
  *  @param[in]      dim1 : first dimension of the array
@@ -1029,74 +1380,195 @@ bool NetCDFFile::GetValues(double *values,
                            const std::size_t dim4,
                            const std::string &variableName) const
 {
-    const netCDF::NcVar var = NetCDFFile::getVariable( variableName );
-    
-    if( sofa::NcUtils::IsValid( var ) == false )
-    {
-        return false;
-    }
-    
-    if( sofa::NcUtils::IsDouble( var ) == false )
-    {
-        return false;
-    }
-    
-    if( sofa::NcUtils::HasDimensions( dim1, dim2, dim3, dim4, var ) == false )
-    {
-        return false;
-    }
-    
-    var.getVar( values );
-    
-    return true;
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ), dim1, dim2, dim3, dim4 );
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Reads values of named variable stored as a N-dimensional array of floating-point values, as double
+ *                  Returns true if everything goes well, false otherwise (not a valid variable,
+ *                  not a floating-point variable)
+ *  @param[out]     values : the array is resized if needed
+ *  @param[in]      variableName : the named variable to query
+ *
+ */
+/************************************************************************************/
+bool NetCDFFile::GetValues(std::vector< double > &values,
+                           const std::string &variableName) const
+{
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ) );
+}
 
 /************************************************************************************/
 /*!
- *  @brief          Reads values of named variable stored as a N-dimensional array of double
+ *  @brief          Reads a hyperslab of a named variable stored as a N-dimensional array of floating-point values, as double
  *                  Returns true if everything goes well, false otherwise (not a valid variable,
- *                  not a double variable, not the proper dimensions)
- *  @param[out]     values :
+ *                  not a floating-point variable, or the hyperslab does not fit in the variable)
+ *  @param[out]     values : the array must be allocated large enough,
+ *                  i.e. the product of all the count values
+ *  @param[in]      start : index of the first element to read, along each dimension
+ *  @param[in]      count : number of elements to read, along each dimension
+ *  @param[in]      variableName : the named variable to query
+ *
+ *  @details        only the requested slice is read from the file.
+ *                  For instance, with Data.IR of size [M R N], start = { m, 0, 0 } and
+ *                  count = { 1, R, N } retrieves the R impulse responses of the m-th measurement
+ */
+/************************************************************************************/
+bool NetCDFFile::GetValues(double *values,
+                           const std::vector< std::size_t > &start,
+                           const std::vector< std::size_t > &count,
+                           const std::string &variableName) const
+{
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ), start, count );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads a hyperslab of a named variable stored as a N-dimensional array of floating-point values, as double
+ *                  Returns true if everything goes well, false otherwise
+ *  @param[out]     values : the array is resized if needed
+ *  @param[in]      start : index of the first element to read, along each dimension
+ *  @param[in]      count : number of elements to read, along each dimension
  *  @param[in]      variableName : the named variable to query
  *
  */
 /************************************************************************************/
 bool NetCDFFile::GetValues(std::vector< double > &values,
+                           const std::vector< std::size_t > &start,
+                           const std::vector< std::size_t > &count,
                            const std::string &variableName) const
 {
-    const netCDF::NcVar var = NetCDFFile::getVariable( variableName );
-    
-    if( sofa::NcUtils::IsValid( var ) == false )
-    {
-        return false;
-    }
-    
-    if( sofa::NcUtils::IsDouble( var ) == false )
-    {
-        return false;
-    }
-    
-    std::vector< std::size_t > dims;
-    GetVariableDimensions( dims, variableName );
-    
-    if( dims.size() == 0 )
-    {
-        return false;
-    }
-    
-    std::size_t totalSize = dims[0];
-    for( std::size_t i = 1; i < dims.size(); i++ )
-    {
-        totalSize *= dims[i];
-    }
-    
-    values.resize( totalSize );
-    
-    SOFA_ASSERT( totalSize > 0 );
-    
-    var.getVar( &values[0] );
-    
-    return true;
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ), start, count );
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Reads values of variable stored as a 2-dimensional array of floating-point values, as float
+ *                  Returns true if everything goes well, false otherwise (not a valid variable,
+ *                  not a floating-point variable, not the proper dimensions)
+ *                  The values are converted to single precision if the variable is stored as double
+ *  @param[out]     values :
+ *  @param[in]      variableName : the named variable to query
+ *  @param[in]      dim1 : first dimension of the array
+ *  @param[in]      dim2 : second dimension of the array
+ *
+ */
+/************************************************************************************/
+bool NetCDFFile::GetValues(float *values,
+                           const std::size_t dim1,
+                           const std::size_t dim2,
+                           const std::string &variableName) const
+{
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ), dim1, dim2 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads values of variable stored as a 3-dimensional array of floating-point values, as float
+ *                  Returns true if everything goes well, false otherwise (not a valid variable,
+ *                  not a floating-point variable, not the proper dimensions)
+ *                  The values are converted to single precision if the variable is stored as double
+ *  @param[out]     values :
+ *  @param[in]      variableName : the named variable to query
+ *  @param[in]      dim1 : first dimension of the array
+ *  @param[in]      dim2 : second dimension of the array
+ *  @param[in]      dim3 : third dimension of the array
+ *
+ */
+/************************************************************************************/
+bool NetCDFFile::GetValues(float *values,
+                           const std::size_t dim1,
+                           const std::size_t dim2,
+                           const std::size_t dim3,
+                           const std::string &variableName) const
+{
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ), dim1, dim2, dim3 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads values of variable stored as a 4-dimensional array of floating-point values, as float
+ *                  Returns true if everything goes well, false otherwise (not a valid variable,
+ *                  not a floating-point variable, not the proper dimensions)
+ *                  The values are converted to single precision if the variable is stored as double
+ *  @param[out]     values :
+ *  @param[in]      variableName : the named variable to query
+ *  @param[in]      dim1 : first dimension of the array
+ *  @param[in]      dim2 : second dimension of the array
+ *  @param[in]      dim3 : third dimension of the array
+ *  @param[in]      dim4 : fourth dimension of the array
+ *
+ */
+/************************************************************************************/
+bool NetCDFFile::GetValues(float *values,
+                           const std::size_t dim1,
+                           const std::size_t dim2,
+                           const std::size_t dim3,
+                           const std::size_t dim4,
+                           const std::string &variableName) const
+{
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ), dim1, dim2, dim3, dim4 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads values of named variable stored as a N-dimensional array of floating-point values, as float
+ *                  Returns true if everything goes well, false otherwise (not a valid variable,
+ *                  not a floating-point variable)
+ *                  The values are converted to single precision if the variable is stored as double
+ *  @param[out]     values : the array is resized if needed
+ *  @param[in]      variableName : the named variable to query
+ *
+ */
+/************************************************************************************/
+bool NetCDFFile::GetValues(std::vector< float > &values,
+                           const std::string &variableName) const
+{
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ) );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads a hyperslab of a named variable stored as a N-dimensional array of floating-point values, as float
+ *                  Returns true if everything goes well, false otherwise (not a valid variable,
+ *                  not a floating-point variable, or the hyperslab does not fit in the variable)
+ *                  The values are converted to single precision if the variable is stored as double
+ *  @param[out]     values : the array must be allocated large enough,
+ *                  i.e. the product of all the count values
+ *  @param[in]      start : index of the first element to read, along each dimension
+ *  @param[in]      count : number of elements to read, along each dimension
+ *  @param[in]      variableName : the named variable to query
+ *
+ *  @details        only the requested slice is read from the file.
+ *                  For instance, with Data.IR of size [M R N], start = { m, 0, 0 } and
+ *                  count = { 1, R, N } retrieves the R impulse responses of the m-th measurement
+ */
+/************************************************************************************/
+bool NetCDFFile::GetValues(float *values,
+                           const std::vector< std::size_t > &start,
+                           const std::vector< std::size_t > &count,
+                           const std::string &variableName) const
+{
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ), start, count );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads a hyperslab of a named variable stored as a N-dimensional array of floating-point values, as float
+ *                  Returns true if everything goes well, false otherwise
+ *                  The values are converted to single precision if the variable is stored as double
+ *  @param[out]     values : the array is resized if needed
+ *  @param[in]      start : index of the first element to read, along each dimension
+ *  @param[in]      count : number of elements to read, along each dimension
+ *  @param[in]      variableName : the named variable to query
+ *
+ */
+/************************************************************************************/
+bool NetCDFFile::GetValues(std::vector< float > &values,
+                           const std::vector< std::size_t > &start,
+                           const std::vector< std::size_t > &count,
+                           const std::string &variableName) const
+{
+    return sofaLocal::getValues( values, NetCDFFile::getVariable( variableName ), start, count );
+}
@@ -52,9 +52,12 @@ http://www.sofaconventions.org
 #include "../src/SOFAPlatform.h"
 #include "netcdf.h"
 #include "ncFile.h"
+#include <memory>
+#include <mutex>
 
 namespace sofa
 {
+    class NcCatalogue;
     
     /************************************************************************************/
     /*!
@@ -66,10 +69,35 @@ namespace sofa
     /************************************************************************************/
     class SOFA_API NetCDFFile
     {
+    public:
+        static std::recursive_mutex & GetLibraryMutex();
+        
+        /// tuning of the storage access, for a file opened for reading
+        /// (NC_MMAP is not offered : it only applies to netCDF-3 files, and the bundled netCDF is built without it)
+        struct SOFA_API OpenOptions
+        {
+            OpenOptions();
+            
+            bool diskless;                      ///< reads the whole file into memory when opening (NC_DISKLESS)
+            bool readAhead;                     ///< asks the system to load the whole file into its cache when opening
+            
+            /// chunk cache of the measurement data (Data.IR, Data.Real, Data.Imag, Data.SOS)
+            std::size_t chunkCacheSize;         ///< in bytes (0 for the library default)
+            std::size_t chunkCacheNumSlots;     ///< number of hash slots, preferably a prime number (0 for the library default)
+            float chunkCachePreemption;         ///< between 0 and 1 (negative for the library default)
+        };
+        
     public:
         NetCDFFile(const std::string &path,
                    const netCDF::NcFile::FileMode &mode = netCDF::NcFile::read);
         
+        NetCDFFile(const std::string &path,
+                   const OpenOptions &options);
+        
+        NetCDFFile(const void *buffer,
+                   const std::size_t size,
+                   const std::string &name = "");
+        
         virtual ~NetCDFFile() {};
         
         const std::string & GetFilename() const;
@@ -180,6 +208,49 @@ namespace sofa
         bool GetValues(std::vector< double > &values,
                        const std::string &variableName) const;
         
+        bool GetValues(double *values,
+                       const std::vector< std::size_t > &start,
+                       const std::vector< std::size_t > &count,
+                       const std::string &variableName) const;
+        
+        bool GetValues(std::vector< double > &values,
+                       const std::vector< std::size_t > &start,
+                       const std::vector< std::size_t > &count,
+                       const std::string &variableName) const;
+        
+        //==============================================================================
+        /// single precision : the values are converted while reading, if the variable is stored as double
+        bool GetValues(float *values,
+                       const std::size_t dim1,
+                       const std::size_t dim2,
+                       const std::string &variableName) const;
+        
+        bool GetValues(float *values,
+                       const std::size_t dim1,
+                       const std::size_t dim2,
+                       const std::size_t dim3,
+                       const std::string &variableName) const;
+        
+        bool GetValues(float *values,
+                       const std::size_t dim1,
+                       const std::size_t dim2,
+                       const std::size_t dim3,
+                       const std::size_t dim4,
+                       const std::string &variableName) const;
+        
+        bool GetValues(std::vector< float > &values,
+                       const std::string &variableName) const;
+        
+        bool GetValues(float *values,
+                       const std::vector< std::size_t > &start,
+                       const std::vector< std::size_t > &count,
+                       const std::string &variableName) const;
+        
+        bool GetValues(std::vector< float > &values,
+                       const std::vector< std::size_t > &start,
+                       const std::vector< std::size_t > &count,
+                       const std::string &variableName) const;
+        
     protected:
         //==============================================================================
         netCDF::NcGroupAtt getAttribute(const std::string &attributeName) const;
@@ -190,7 +261,13 @@ namespace sofa
         
 
     protected:
-        netCDF::NcFile file;
+        //==============================================================================
+        explicit NetCDFFile(const sofa::NetCDFFile *other);
+        
+    protected:
+        const std::shared_ptr< netCDF::NcFile > handle;     ///< shared by the views opened on the same file
+        const std::shared_ptr< const sofa::NcCatalogue > catalogue; ///< metadata, read when the file is opened
+        netCDF::NcFile &file;
         const std::string filename;
         
     private:
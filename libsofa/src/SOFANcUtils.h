@@ -116,6 +116,21 @@ namespace sofa
             return CheckType( ncStuff, netCDF::NcType::nc_DOUBLE );
         }
         
+        /************************************************************************************/
+        /*!
+         *  @brief          Returns true if a NcVar or NcAtt is of type nc_FLOAT or nc_DOUBLE
+         *  @param[in]      ncStuff : the stuff to query
+         *
+         *  @details        netCDF converts between float and double when reading,
+         *                  so either type can be read into a float or a double array
+         */
+        /************************************************************************************/
+        template< typename NetCDFType >
+        bool IsFloatingPoint(const NetCDFType & ncStuff)
+        {
+            return ( IsFloat( ncStuff ) == true || IsDouble( ncStuff ) == true );
+        }
+        
         /************************************************************************************/
         /*!
          *  @brief          Returns true if a NcVar or NcAtt is of type nc_BYTE
@@ -299,7 +314,7 @@ namespace sofa
         /************************************************************************************/
         inline bool GetValue(double &value, const netCDF::NcVar & ncStuff)
         {
-            if( IsScalar( ncStuff ) == true && IsDouble( ncStuff ) == true )
+            if( IsScalar( ncStuff ) == true && IsFloatingPoint( ncStuff ) == true )
             {
                 ncStuff.getVar( &value );
                  
@@ -394,7 +409,7 @@ namespace sofa
                               const netCDF::NcVar & ncStuff)
         {
             
-            if( IsValid( ncStuff ) == true && IsDouble( ncStuff ) == true  )
+            if( IsValid( ncStuff ) == true && IsFloatingPoint( ncStuff ) == true  )
             {
                 /// dimensionality might be 2 for instance for a [I C] variable
                 std::vector< std::size_t > dims;
@@ -456,21 +471,10 @@ namespace sofa
             }
             else
             {
-                const std::map< std::string, netCDF::NcVarAtt > attributes = var.getAtts();
-                
-                for( std::map< std::string, netCDF::NcVarAtt >::const_iterator it = attributes.begin();
-                    it != attributes.end();
-                    ++it )
-                {
-                    const std::string attrName      = (*it).first;
-                    
-                    if( attrName == attributeName )
-                    {
-                        return true;
-                    }
-                }
+                /// queries the attribute id, rather than copying all the attributes of the variable
+                int attributeId = 0;
                 
-                return false;
+                return ( nc_inq_attid( var.getParentGroup().getId(), var.getId(), attributeName.c_str(), &attributeId ) == NC_NOERR );
             }
         }
         
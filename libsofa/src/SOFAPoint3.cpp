@@ -49,9 +49,363 @@ http://www.sofaconventions.org
 #include "../src/SOFAPoint3.h"
 #include "../src/SOFAPosition.h"
 #include "../src/SOFANcUtils.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAHostArchitecture.h"
+#include "../src/SOFAUtils.h"
+#include <cmath>
+
+/// the vector and the scalar kernels must round identically : no fused multiply-add.
+/// GCC ignores this pragma when FMA is enabled ( -mfma, -march=native ... ) : the build files
+/// also compile this file with -ffp-contract=off ( /fp:strict with Visual Studio )
+#if defined( __clang__ )
+    #pragma STDC FP_CONTRACT OFF
+#elif defined( __GNUC__ )
+    #pragma GCC optimize ( "fp-contract=off" )
+#elif defined( _MSC_VER )
+    #pragma fp_contract ( off )
+#endif
+
+#if ( SOFA_SIMD_AVX == 1 )
+    #include <immintrin.h>
+#elif ( SOFA_SIMD_SSE2 == 1 )
+    #include <emmintrin.h>
+#elif ( SOFA_SIMD_NEON == 1 )
+    #include <arm_neon.h>
+#endif
 
 using namespace sofa;
 
+namespace sofaLocal
+{
+    //==============================================================================
+    /// Elementary operations on one double (scalar path, and remaining points of the vector paths)
+    //==============================================================================
+    struct ScalarOps
+    {
+        typedef double Vector;
+        typedef bool Mask;
+        
+        static const std::size_t kWidth = 1;
+        
+        static inline Vector Load(const double *p)                      { return *p; }
+        static inline void Store(double *p, const Vector a)             { *p = a; }
+        static inline Vector Set(const double a)                        { return a; }
+        static inline Vector Add(const Vector a, const Vector b)        { return a + b; }
+        static inline Vector Sub(const Vector a, const Vector b)        { return a - b; }
+        static inline Vector Mul(const Vector a, const Vector b)        { return a * b; }
+        static inline Vector Div(const Vector a, const Vector b)        { return a / b; }
+        static inline Vector Sqrt(const Vector a)                       { return std::sqrt( a ); }
+        static inline Vector Abs(const Vector a)                        { return std::fabs( a ); }
+        static inline Mask Less(const Vector a, const Vector b)         { return a < b; }
+        static inline Mask Greater(const Vector a, const Vector b)      { return a > b; }
+        static inline Mask Equal(const Vector a, const Vector b)        { return a == b; }
+        static inline Mask Or(const Mask a, const Mask b)               { return a || b; }
+        static inline Vector Select(const Mask m, const Vector a, const Vector b) { return ( m == true ) ? a : b; }
+    };
+    
+#if ( SOFA_SIMD_AVX == 1 )
+    //==============================================================================
+    /// AVX : 4 doubles
+    //==============================================================================
+    struct VectorOps
+    {
+        typedef __m256d Vector;
+        typedef __m256d Mask;
+        
+        static const std::size_t kWidth = 4;
+        
+        static inline Vector Load(const double *p)                      { return _mm256_loadu_pd( p ); }
+        static inline void Store(double *p, const Vector a)             { _mm256_storeu_pd( p, a ); }
+        static inline Vector Set(const double a)                        { return _mm256_set1_pd( a ); }
+        static inline Vector Add(const Vector a, const Vector b)        { return _mm256_add_pd( a, b ); }
+        static inline Vector Sub(const Vector a, const Vector b)        { return _mm256_sub_pd( a, b ); }
+        static inline Vector Mul(const Vector a, const Vector b)        { return _mm256_mul_pd( a, b ); }
+        static inline Vector Div(const Vector a, const Vector b)        { return _mm256_div_pd( a, b ); }
+        static inline Vector Sqrt(const Vector a)                       { return _mm256_sqrt_pd( a ); }
+        static inline Vector Abs(const Vector a)                        { return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a ); }
+        static inline Mask Less(const Vector a, const Vector b)         { return _mm256_cmp_pd( a, b, _CMP_LT_OQ ); }
+        static inline Mask Greater(const Vector a, const Vector b)      { return _mm256_cmp_pd( a, b, _CMP_GT_OQ ); }
+        static inline Mask Equal(const Vector a, const Vector b)        { return _mm256_cmp_pd( a, b, _CMP_EQ_OQ ); }
+        static inline Mask Or(const Mask a, const Mask b)               { return _mm256_or_pd( a, b ); }
+        static inline Vector Select(const Mask m, const Vector a, const Vector b) { return _mm256_or_pd( _mm256_and_pd( m, a ), _mm256_andnot_pd( m, b ) ); }
+    };
+    
+    static const char * const simdInstructionSet = "AVX";
+    
+#elif ( SOFA_SIMD_SSE2 == 1 )
+    //==============================================================================
+    /// SSE2 : 2 doubles
+    //==============================================================================
+    struct VectorOps
+    {
+        typedef __m128d Vector;
+        typedef __m128d Mask;
+        
+        static const std::size_t kWidth = 2;
+        
+        static inline Vector Load(const double *p)                      { return _mm_loadu_pd( p ); }
+        static inline void Store(double *p, const Vector a)             { _mm_storeu_pd( p, a ); }
+        static inline Vector Set(const double a)                        { return _mm_set1_pd( a ); }
+        static inline Vector Add(const Vector a, const Vector b)        { return _mm_add_pd( a, b ); }
+        static inline Vector Sub(const Vector a, const Vector b)        { return _mm_sub_pd( a, b ); }
+        static inline Vector Mul(const Vector a, const Vector b)        { return _mm_mul_pd( a, b ); }
+        static inline Vector Div(const Vector a, const Vector b)        { return _mm_div_pd( a, b ); }
+        static inline Vector Sqrt(const Vector a)                       { return _mm_sqrt_pd( a ); }
+        static inline Vector Abs(const Vector a)                        { return _mm_andnot_pd( _mm_set1_pd( -0.0 ), a ); }
+        static inline Mask Less(const Vector a, const Vector b)         { return _mm_cmplt_pd( a, b ); }
+        static inline Mask Greater(const Vector a, const Vector b)      { return _mm_cmpgt_pd( a, b ); }
+        static inline Mask Equal(const Vector a, const Vector b)        { return _mm_cmpeq_pd( a, b ); }
+        static inline Mask Or(const Mask a, const Mask b)               { return _mm_or_pd( a, b ); }
+        static inline Vector Select(const Mask m, const Vector a, const Vector b) { return _mm_or_pd( _mm_and_pd( m, a ), _mm_andnot_pd( m, b ) ); }
+    };
+    
+    static const char * const simdInstructionSet = "SSE2";
+    
+#elif ( SOFA_SIMD_NEON == 1 )
+    //==============================================================================
+    /// NEON (ARM64) : 2 doubles
+    //==============================================================================
+    struct VectorOps
+    {
+        typedef float64x2_t Vector;
+        typedef uint64x2_t Mask;
+        
+        static const std::size_t kWidth = 2;
+        
+        static inline Vector Load(const double *p)                      { return vld1q_f64( p ); }
+        static inline void Store(double *p, const Vector a)             { vst1q_f64( p, a ); }
+        static inline Vector Set(const double a)                        { return vdupq_n_f64( a ); }
+        static inline Vector Add(const Vector a, const Vector b)        { return vaddq_f64( a, b ); }
+        static inline Vector Sub(const Vector a, const Vector b)        { return vsubq_f64( a, b ); }
+        static inline Vector Mul(const Vector a, const Vector b)        { return vmulq_f64( a, b ); }
+        static inline Vector Div(const Vector a, const Vector b)        { return vdivq_f64( a, b ); }
+        static inline Vector Sqrt(const Vector a)                       { return vsqrtq_f64( a ); }
+        static inline Vector Abs(const Vector a)                        { return vabsq_f64( a ); }
+        static inline Mask Less(const Vector a, const Vector b)         { return vcltq_f64( a, b ); }
+        static inline Mask Greater(const Vector a, const Vector b)      { return vcgtq_f64( a, b ); }
+        static inline Mask Equal(const Vector a, const Vector b)        { return vceqq_f64( a, b ); }
+        static inline Mask Or(const Mask a, const Mask b)               { return vorrq_u64( a, b ); }
+        static inline Vector Select(const Mask m, const Vector a, const Vector b) { return vbslq_f64( m, a, b ); }
+    };
+    
+    static const char * const simdInstructionSet = "NEON";
+    
+#else
+    
+    static const char * const simdInstructionSet = "none";
+    
+#endif
+    
+    //==============================================================================
+    /// Conversion kernels, written once for all the instruction sets.
+    /// sin, cos and atan are evaluated with polynomials (Cephes) rather than with the
+    /// C library, so that the scalar and the vector paths give the same results
+    //==============================================================================
+    template< class Ops >
+    struct Point3Kernel
+    {
+        typedef typename Ops::Vector Vector;
+        typedef typename Ops::Mask Mask;
+        
+        /// round to nearest integer, for |x| < 2^51
+        static inline Vector Round(const Vector x)
+        {
+            const Vector magic = Ops::Set( 6755399441055744.0 );
+            
+            return Ops::Sub( Ops::Add( x, magic ), magic );
+        }
+        
+        static inline Vector Negate(const Vector x)
+        {
+            return Ops::Sub( Ops::Set( 0.0 ), x );
+        }
+        
+        /// sine and cosine of an angle in degree
+        static inline void SinCos(Vector &sine, Vector &cosine, const Vector degrees)
+        {
+            /// reduction to [-45 45] degrees, exact for the multiples of 90 degrees
+            const Vector quadrant = Round( Ops::Mul( degrees, Ops::Set( 1.0 / 90.0 ) ) );
+            const Vector reduced  = Ops::Sub( degrees, Ops::Mul( quadrant, Ops::Set( 90.0 ) ) );
+            
+            const Vector x = Ops::Mul( reduced, Ops::Set( 0.017453292519943295769 ) );
+            const Vector z = Ops::Mul( x, x );
+            
+            Vector sp = Ops::Set( 1.58962301576546568060E-10 );
+            sp = Ops::Add( Ops::Mul( sp, z ), Ops::Set( -2.50507477628578072866E-8 ) );
+            sp = Ops::Add( Ops::Mul( sp, z ), Ops::Set( 2.75573136213857245213E-6 ) );
+            sp = Ops::Add( Ops::Mul( sp, z ), Ops::Set( -1.98412698295895385996E-4 ) );
+            sp = Ops::Add( Ops::Mul( sp, z ), Ops::Set( 8.33333333332211858878E-3 ) );
+            sp = Ops::Add( Ops::Mul( sp, z ), Ops::Set( -1.66666666666666307295E-1 ) );
+            
+            Vector cp = Ops::Set( -1.13585365213876817300E-11 );
+            cp = Ops::Add( Ops::Mul( cp, z ), Ops::Set( 2.08757008419747316778E-9 ) );
+            cp = Ops::Add( Ops::Mul( cp, z ), Ops::Set( -2.75573141792967388112E-7 ) );
+            cp = Ops::Add( Ops::Mul( cp, z ), Ops::Set( 2.48015872888517045348E-5 ) );
+            cp = Ops::Add( Ops::Mul( cp, z ), Ops::Set( -1.38888888888730564116E-3 ) );
+            cp = Ops::Add( Ops::Mul( cp, z ), Ops::Set( 4.16666666666665929218E-2 ) );
+            
+            const Vector s = Ops::Add( x, Ops::Mul( Ops::Mul( x, z ), sp ) );
+            const Vector c = Ops::Add( Ops::Sub( Ops::Set( 1.0 ), Ops::Mul( Ops::Set( 0.5 ), z ) ),
+                                      Ops::Mul( Ops::Mul( z, z ), cp ) );
+            
+            /// quadrant modulo 4, in { -2, -1, 0, 1, 2 }
+            const Vector q = Ops::Sub( quadrant, Ops::Mul( Ops::Set( 4.0 ), Round( Ops::Mul( quadrant, Ops::Set( 0.25 ) ) ) ) );
+            
+            const Mask swap     = Ops::Equal( Ops::Abs( q ), Ops::Set( 1.0 ) );
+            const Mask half     = Ops::Equal( Ops::Abs( q ), Ops::Set( 2.0 ) );
+            const Mask sinNeg   = Ops::Or( half, Ops::Equal( q, Ops::Set( -1.0 ) ) );
+            const Mask cosNeg   = Ops::Or( half, Ops::Equal( q, Ops::Set( 1.0 ) ) );
+            
+            const Vector sine_      = Ops::Select( swap, c, s );
+            const Vector cosine_    = Ops::Select( swap, s, c );
+            
+            sine    = Ops::Select( sinNeg, Negate( sine_ ), sine_ );
+            cosine  = Ops::Select( cosNeg, Negate( cosine_ ), cosine_ );
+        }
+        
+        /// arc tangent in degree, for t in [0 1]
+        static inline Vector Atan(const Vector t)
+        {
+            const Vector one = Ops::Set( 1.0 );
+            
+            /// reduction to [0 0.66] : atan( t ) = 45 + atan( ( t - 1 ) / ( t + 1 ) )
+            const Mask reduce   = Ops::Greater( t, Ops::Set( 0.66 ) );
+            const Vector x      = Ops::Select( reduce, Ops::Div( Ops::Sub( t, one ), Ops::Add( t, one ) ), t );
+            const Vector z      = Ops::Mul( x, x );
+            
+            Vector p = Ops::Set( -8.750608600031904122785E-1 );
+            p = Ops::Add( Ops::Mul( p, z ), Ops::Set( -1.615753718733365076637E1 ) );
+            p = Ops::Add( Ops::Mul( p, z ), Ops::Set( -7.500855792314704667340E1 ) );
+            p = Ops::Add( Ops::Mul( p, z ), Ops::Set( -1.228866684490136173410E2 ) );
+            p = Ops::Add( Ops::Mul( p, z ), Ops::Set( -6.485021904942025371773E1 ) );
+            
+            Vector q = Ops::Add( z, Ops::Set( 2.485846490142306297962E1 ) );
+            q = Ops::Add( Ops::Mul( q, z ), Ops::Set( 1.650270098316988542046E2 ) );
+            q = Ops::Add( Ops::Mul( q, z ), Ops::Set( 4.328810604912902668951E2 ) );
+            q = Ops::Add( Ops::Mul( q, z ), Ops::Set( 4.853903996359136964868E2 ) );
+            q = Ops::Add( Ops::Mul( q, z ), Ops::Set( 1.945506571482613964425E2 ) );
+            
+            const Vector w = Ops::Div( Ops::Mul( z, p ), q );
+            const Vector a = Ops::Mul( Ops::Add( Ops::Mul( x, w ), x ), Ops::Set( 57.295779513082320877 ) );
+            
+            return Ops::Select( reduce, Ops::Add( Ops::Set( 45.0 ), a ), a );
+        }
+        
+        /// atan2( y, x ) in degree, in [-180 180]
+        static inline Vector Atan2(const Vector y, const Vector x)
+        {
+            const Vector zero   = Ops::Set( 0.0 );
+            const Vector ax     = Ops::Abs( x );
+            const Vector ay     = Ops::Abs( y );
+            
+            const Mask steep    = Ops::Less( ax, ay );
+            const Vector num    = Ops::Select( steep, ax, ay );
+            const Vector den    = Ops::Select( steep, ay, ax );
+            
+            /// atan2( 0, 0 ) = 0
+            const Vector t      = Ops::Div( num, Ops::Select( Ops::Equal( den, zero ), Ops::Set( 1.0 ), den ) );
+            
+            Vector a = Atan( t );
+            a = Ops::Select( steep, Ops::Sub( Ops::Set( 90.0 ), a ), a );
+            a = Ops::Select( Ops::Less( x, zero ), Ops::Sub( Ops::Set( 180.0 ), a ), a );
+            
+            return Ops::Select( Ops::Less( y, zero ), Negate( a ), a );
+        }
+        
+        /// azimuth, elevation (degree), radius -> x, y, z
+        static inline void SphericalToCartesian(double *c1, double *c2, double *c3)
+        {
+            const Vector azimuth    = Ops::Load( c1 );
+            const Vector elevation  = Ops::Load( c2 );
+            const Vector radius     = Ops::Load( c3 );
+            
+            Vector sinAz, cosAz, sinEl, cosEl;
+            SinCos( sinAz, cosAz, azimuth );
+            SinCos( sinEl, cosEl, elevation );
+            
+            const Vector rCosEl = Ops::Mul( radius, cosEl );
+            
+            Ops::Store( c1, Ops::Mul( rCosEl, cosAz ) );
+            Ops::Store( c2, Ops::Mul( rCosEl, sinAz ) );
+            Ops::Store( c3, Ops::Mul( radius, sinEl ) );
+        }
+        
+        /// x, y, z -> azimuth in [0 360[, elevation in [-90 90] (degree), radius
+        static inline void CartesianToSpherical(double *c1, double *c2, double *c3)
+        {
+            const Vector x = Ops::Load( c1 );
+            const Vector y = Ops::Load( c2 );
+            const Vector z = Ops::Load( c3 );
+            
+            const Vector rho2   = Ops::Add( Ops::Mul( x, x ), Ops::Mul( y, y ) );
+            const Vector rho    = Ops::Sqrt( rho2 );
+            const Vector radius = Ops::Sqrt( Ops::Add( rho2, Ops::Mul( z, z ) ) );
+            
+            Vector azimuth = Atan2( y, x );
+            azimuth = Ops::Select( Ops::Less( azimuth, Ops::Set( 0.0 ) ), Ops::Add( azimuth, Ops::Set( 360.0 ) ), azimuth );
+            azimuth = Ops::Select( Ops::Less( azimuth, Ops::Set( 360.0 ) ), azimuth, Ops::Set( 0.0 ) );
+            
+            Ops::Store( c1, azimuth );
+            Ops::Store( c2, Atan2( z, rho ) );
+            Ops::Store( c3, radius );
+        }
+        
+        /// converts the points [begin end[, by groups of Ops::kWidth
+        static std::size_t Convert(double *c1,
+                                   double *c2,
+                                   double *c3,
+                                   const std::size_t begin,
+                                   const std::size_t end,
+                                   const bool toCartesian)
+        {
+            std::size_t i = begin;
+            
+            for( ; i + Ops::kWidth <= end; i += Ops::kWidth )
+            {
+                if( toCartesian == true )
+                {
+                    SphericalToCartesian( c1 + i, c2 + i, c3 + i );
+                }
+                else
+                {
+                    CartesianToSpherical( c1 + i, c2 + i, c3 + i );
+                }
+            }
+            
+            return i;
+        }
+    };
+    
+    static void convert(double *c1,
+                        double *c2,
+                        double *c3,
+                        const std::size_t numPoints,
+                        const bool toCartesian)
+    {
+        std::size_t i = 0;
+        
+#if ( SOFA_SIMD_AVX == 1 || SOFA_SIMD_SSE2 == 1 || SOFA_SIMD_NEON == 1 )
+        i = Point3Kernel< VectorOps >::Convert( c1, c2, c3, i, numPoints, toCartesian );
+#endif
+        
+        Point3Kernel< ScalarOps >::Convert( c1, c2, c3, i, numPoints, toCartesian );
+    }
+    
+    static void checkCoordinates(const sofa::Coordinates::Type &coordinates)
+    {
+        if( coordinates != sofa::Coordinates::kCartesian && coordinates != sofa::Coordinates::kSpherical )
+        {
+            SOFA_THROW( "invalid coordinates (should be cartesian or spherical)" );
+        }
+    }
+    
+    /// the units of a position in a coordinates system
+    static sofa::Units::Type getUnits(const sofa::Coordinates::Type &coordinates)
+    {
+        return ( coordinates == sofa::Coordinates::kSpherical ) ? sofa::Units::kSphericalUnits : sofa::Units::kMeter;
+    }
+}
+
 /************************************************************************************/
 /*!
  *  @brief          Class constructor
@@ -140,36 +494,173 @@ double Point3::operator[](const unsigned int index) const
     } 
 }
 
-/*
+/************************************************************************************/
+/*!
+ *  @brief          Converts the point to the coordinates system matching a unit
+ *  @param[in]      newUnit : kMeter (cartesian) or kSphericalUnits (spherical)
+ *
+ *  @details        Throws an exception for any other unit
+ */
+/************************************************************************************/
 void Point3::ConvertTo(const sofa::Units::Type &newUnit)
 {
-    if( newUnit != units )
+    if( newUnit == sofa::Units::kMeter )
     {
-        ///@todo A COMPLETER
-        
-        
-        units = newUnit;
+        ConvertTo( sofa::Coordinates::kCartesian );
+    }
+    else if( newUnit == sofa::Units::kSphericalUnits )
+    {
+        ConvertTo( sofa::Coordinates::kSpherical );
+    }
+    else
+    {
+        SOFA_THROW( "invalid units for a position : " + sofa::Units::GetName( newUnit ) );
     }
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Converts the point to another coordinates system
+ *  @param[in]      newCoordinate : kCartesian or kSpherical
+ *
+ *  @details        The units are set accordingly (kMeter or kSphericalUnits).
+ *                  Throws an exception if a coordinates system is neither cartesian nor spherical
+ */
+/************************************************************************************/
 void Point3::ConvertTo(const sofa::Coordinates::Type &newCoordinate)
 {
+    sofaLocal::checkCoordinates( coordinates );
+    sofaLocal::checkCoordinates( newCoordinate );
+    
     if( newCoordinate != coordinates )
     {
-        ///@todo A COMPLETER
-        
-        
+        sofaLocal::convert( &data[0], &data[1], &data[2], 1, newCoordinate == sofa::Coordinates::kCartesian );
         
         coordinates = newCoordinate;
     }
+    
+    units = sofaLocal::getUnits( coordinates );
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Converts the point to another coordinates system
+ *  @param[in]      newCoordinate : kCartesian or kSpherical
+ *  @param[in]      newUnit : kMeter for kCartesian, kSphericalUnits for kSpherical
+ *
+ *  @details        Throws an exception if the units do not match the coordinates
+ */
+/************************************************************************************/
 void Point3::ConvertTo(const sofa::Coordinates::Type &newCoordinate, const sofa::Units::Type &newUnit)
 {
+    sofaLocal::checkCoordinates( newCoordinate );
+    
+    if( newUnit != sofaLocal::getUnits( newCoordinate ) )
+    {
+        SOFA_THROW( "invalid units for " + sofa::Coordinates::GetName( newCoordinate ) + " coordinates : " + sofa::Units::GetName( newUnit ) );
+    }
+    
     ConvertTo( newCoordinate );
-    ConvertTo( newUnit );
 }
+
+/************************************************************************************/
+/*!
+ *  @brief          Converts an array of points to another coordinates system (in place)
+ *  @param[in,out]  c1 : x or azimuth (degree) of the points
+ *  @param[in,out]  c2 : y or elevation (degree) of the points
+ *  @param[in,out]  c3 : z or radius (meter) of the points
+ *  @param[in]      numPoints : number of points
+ *  @param[in]      coordinates : current coordinates system
+ *  @param[in]      newCoordinate : new coordinates system
+ *
+ *  @details        The spherical coordinates are output with azimuth in [0 360[
+ *                  and elevation in [-90 90].
+ *                  Throws an exception if a coordinates system is neither cartesian nor spherical
  */
+/************************************************************************************/
+void Point3::ConvertTo(double *c1,
+                       double *c2,
+                       double *c3,
+                       const std::size_t numPoints,
+                       const sofa::Coordinates::Type &coordinates,
+                       const sofa::Coordinates::Type &newCoordinate)
+{
+    sofaLocal::checkCoordinates( coordinates );
+    sofaLocal::checkCoordinates( newCoordinate );
+    
+    if( newCoordinate != coordinates && numPoints > 0 )
+    {
+        SOFA_ASSERT( c1 != NULL && c2 != NULL && c3 != NULL );
+        
+        sofaLocal::convert( c1, c2, c3, numPoints, newCoordinate == sofa::Coordinates::kCartesian );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Converts an array of interleaved points [ P C ] to another coordinates system (in place)
+ *  @param[in,out]  points : e.g. [ az el r az el r ... ]
+ *  @param[in]      numPoints : number of points (the array holds 3 x numPoints values)
+ *  @param[in]      coordinates : current coordinates system
+ *  @param[in]      newCoordinate : new coordinates system
+ *
+ */
+/************************************************************************************/
+void Point3::ConvertTo(double *points,
+                       const std::size_t numPoints,
+                       const sofa::Coordinates::Type &coordinates,
+                       const sofa::Coordinates::Type &newCoordinate)
+{
+    sofaLocal::checkCoordinates( coordinates );
+    sofaLocal::checkCoordinates( newCoordinate );
+    
+    if( newCoordinate == coordinates || numPoints == 0 )
+    {
+        return;
+    }
+    
+    SOFA_ASSERT( points != NULL );
+    
+    /// the points are converted by blocks, through separate arrays on the stack
+    const std::size_t blockSize = 256;
+    double c1[ blockSize ];
+    double c2[ blockSize ];
+    double c3[ blockSize ];
+    
+    for( std::size_t start = 0; start < numPoints; start += blockSize )
+    {
+        const std::size_t size = sofa::smin( blockSize, numPoints - start );
+        double *block = points + 3 * start;
+        
+        for( std::size_t i = 0; i < size; i++ )
+        {
+            c1[i] = block[ 3 * i + 0 ];
+            c2[i] = block[ 3 * i + 1 ];
+            c3[i] = block[ 3 * i + 2 ];
+        }
+        
+        sofaLocal::convert( c1, c2, c3, size, newCoordinate == sofa::Coordinates::kCartesian );
+        
+        for( std::size_t i = 0; i < size; i++ )
+        {
+            block[ 3 * i + 0 ] = c1[i];
+            block[ 3 * i + 1 ] = c2[i];
+            block[ 3 * i + 2 ] = c3[i];
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the instruction set used by the array conversions :
+ *                  "AVX", "SSE2", "NEON" or "none"
+ *
+ */
+/************************************************************************************/
+const char * Point3::GetSIMDInstructionSet() SOFA_NOEXCEPT
+{
+    return sofaLocal::simdInstructionSet;
+}
 
 bool sofa::GetPoint3(sofa::Point3 &point3, const netCDF::NcVar & variable)
 {
@@ -51,6 +51,7 @@ http://www.sofaconventions.org
 
 #include "../src/SOFACoordinates.h"
 #include "../src/SOFAUnits.h"
+#include <cstddef>
 
 namespace sofa
 {
@@ -61,6 +62,14 @@ namespace sofa
      *  @brief          Represents one point in 3D with a unit and a coordinate system,
      *                  and allows for conversion between coordinate systems
      *
+     *  @details        As in the SOFA specifications, the units follow the coordinates :
+     *                  kCartesian is in kMeter, kSpherical in kSphericalUnits
+     *                  (azimuth in degree, elevation in degree, radius in meter).
+     *
+     *                  The static ConvertTo() methods convert arrays of points, with SIMD instructions
+     *                  (see GetSIMDInstructionSet()). All the code paths (SIMD or not, array or single
+     *                  point) perform the same floating-point operations : a point converts to the same
+     *                  bits whatever the path.
      */
     /************************************************************************************/
     class SOFA_API Point3
@@ -81,11 +90,23 @@ namespace sofa
         void Set(const sofa::Coordinates::Type &type_);                
         void Set(const double data_[3]);
         
-        /*
         void ConvertTo(const sofa::Units::Type &newUnit);
         void ConvertTo(const sofa::Coordinates::Type &newCoordinate);
         void ConvertTo(const sofa::Coordinates::Type &newCoordinate, const sofa::Units::Type &newUnit);
-         */
+        
+        static void ConvertTo(double *c1,
+                              double *c2,
+                              double *c3,
+                              const std::size_t numPoints,
+                              const sofa::Coordinates::Type &coordinates,
+                              const sofa::Coordinates::Type &newCoordinate);
+        
+        static void ConvertTo(double *points,
+                              const std::size_t numPoints,
+                              const sofa::Coordinates::Type &coordinates,
+                              const sofa::Coordinates::Type &newCoordinate);
+        
+        static const char * GetSIMDInstructionSet() SOFA_NOEXCEPT;
         
     public:
         //==============================================================================
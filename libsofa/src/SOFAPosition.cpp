@@ -129,7 +129,7 @@ bool PositionVariable::HasDimensions(const std::size_t dim1, const std::size_t d
 bool PositionVariable::HasUnits() const
 {
     SOFA_ASSERT( sofa::NcUtils::IsValid( var ) == true );
-    SOFA_ASSERT( sofa::NcUtils::IsDouble( var ) == true );
+    SOFA_ASSERT( sofa::NcUtils::IsFloatingPoint( var ) == true );
     
     const netCDF::NcVarAtt attrType = sofa::NcUtils::GetAttribute( var, "Type" );
     
@@ -139,7 +139,7 @@ bool PositionVariable::HasUnits() const
 bool PositionVariable::HasCoordinates() const
 {
     SOFA_ASSERT( sofa::NcUtils::IsValid( var ) == true );
-    SOFA_ASSERT( sofa::NcUtils::IsDouble( var ) == true );
+    SOFA_ASSERT( sofa::NcUtils::IsFloatingPoint( var ) == true );
 
     const netCDF::NcVarAtt attrUnits = sofa::NcUtils::GetAttribute( var, "Units" );
     
@@ -148,7 +148,7 @@ bool PositionVariable::HasCoordinates() const
 
 /************************************************************************************/
 /*!
- *  @brief          Checks if the NcVar corresponds to a valid NcVar, of type double, of dimensionality 2 or 3
+ *  @brief          Checks if the NcVar corresponds to a valid NcVar, of type float or double, of dimensionality 2 or 3
  *                  with valid "Type" and "Units" attributes
  *                    
  *                  Returns true if everything is conform to the specifications
@@ -169,7 +169,7 @@ bool PositionVariable::IsValid(const bool shouldHaveTypeAndUnits) const
         return false;
     }
     
-    if( sofa::NcUtils::IsDouble( var ) == false )
+    if( sofa::NcUtils::IsFloatingPoint( var ) == false )
     {
         return false;
     }
@@ -0,0 +1,282 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAPositionArrays.cpp
+ *   @brief      Positions stored as separate (structure of arrays) coordinates
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAPositionArrays.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAUtils.h"
+#include "../src/SOFAPoint3.h"
+#include <cstdint>
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    static const std::size_t positionsAlignment = 64;       ///< in bytes
+
+    /// number of doubles of an array of size positions, padded to the alignment
+    inline std::size_t paddedSize(const std::size_t size) SOFA_NOEXCEPT
+    {
+        const std::size_t numPerLine = positionsAlignment / sizeof( double );
+
+        return ( ( size + numPerLine - 1 ) / numPerLine ) * numPerLine;
+    }
+
+    /// [ P C ] -> three arrays of P values
+    static void deinterleave(double *c1,
+                             double *c2,
+                             double *c3,
+                             const double *positions,
+                             const std::size_t numPositions) SOFA_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < numPositions; i++ )
+        {
+            c1[i] = positions[ 3 * i + 0 ];
+            c2[i] = positions[ 3 * i + 1 ];
+            c3[i] = positions[ 3 * i + 2 ];
+        }
+    }
+
+    static void scale(double *values,
+                      const std::size_t numValues,
+                      const double factor) SOFA_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < numValues; i++ )
+        {
+            values[i] *= factor;
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : empty set of positions
+ *
+ */
+/************************************************************************************/
+PositionArrays::PositionArrays()
+: numPositions( 0 )
+, coordinates( sofa::Coordinates::kCartesian )
+, angleUnits( sofa::PositionArrays::kDegree )
+, storage()
+{
+    components[0] = NULL;
+    components[1] = NULL;
+    components[2] = NULL;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+PositionArrays::~PositionArrays()
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Sets the positions from an interleaved array
+ *  @param[in]      positions : interleaved positions, e.g. [ az el r az el r ... ]
+ *  @param[in]      numPositions : number of positions (the array holds 3 x numPositions values)
+ *  @param[in]      positionsCoordinates : coordinates of the input positions, as in a SOFA file
+ *                  (kCartesian in meter, or kSpherical in degree, degree, meter)
+ *  @param[in]      coordinates : coordinates of the arrays
+ *  @param[in]      angleUnits : unit of azimuth and elevation, if coordinates is kSpherical
+ *
+ *  @details        Throws an exception if a coordinates system is neither cartesian nor spherical
+ */
+/************************************************************************************/
+void PositionArrays::Set(const double *positions,
+                         const std::size_t numPositions_,
+                         const sofa::Coordinates::Type positionsCoordinates,
+                         const sofa::Coordinates::Type coordinates_,
+                         const sofa::PositionArrays::AngleUnits angleUnits_)
+{
+    if( ( positionsCoordinates != sofa::Coordinates::kCartesian && positionsCoordinates != sofa::Coordinates::kSpherical )
+       || ( coordinates_ != sofa::Coordinates::kCartesian && coordinates_ != sofa::Coordinates::kSpherical ) )
+    {
+        SOFA_THROW( "invalid coordinates (should be cartesian or spherical)" );
+    }
+
+    allocate( numPositions_ );
+
+    coordinates = coordinates_;
+    angleUnits  = angleUnits_;
+
+    if( numPositions == 0 )
+    {
+        return;
+    }
+
+    SOFA_ASSERT( positions != NULL );
+
+    double *c1 = components[0];
+    double *c2 = components[1];
+    double *c3 = components[2];
+
+    sofaLocal::deinterleave( c1, c2, c3, positions, numPositions );
+
+    Point3::ConvertTo( c1, c2, c3, numPositions, positionsCoordinates, coordinates );
+    
+    if( coordinates == sofa::Coordinates::kSpherical && angleUnits == sofa::PositionArrays::kRadian )
+    {
+        sofaLocal::scale( c1, numPositions, sofa::DegreesToRadians( 1.0 ) );
+        sofaLocal::scale( c2, numPositions, sofa::DegreesToRadians( 1.0 ) );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Removes all the positions (the memory is kept)
+ *
+ */
+/************************************************************************************/
+void PositionArrays::Clear()
+{
+    numPositions = 0;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Allocates the storage if needed, and aligns the arrays
+ *
+ */
+/************************************************************************************/
+void PositionArrays::allocate(const std::size_t numPositions_)
+{
+    const std::size_t stride  = sofaLocal::paddedSize( numPositions_ );
+    const std::size_t padding = sofaLocal::positionsAlignment / sizeof( double );
+
+    if( storage.size() < 3 * stride + padding )
+    {
+        storage.resize( 3 * stride + padding );
+    }
+
+    const std::uintptr_t address    = reinterpret_cast< std::uintptr_t >( &storage[0] );
+    const std::uintptr_t misalign   = address % sofaLocal::positionsAlignment;
+
+    /// the storage is at least 8-bytes aligned : the offset is a whole number of doubles
+    const std::size_t offset = ( misalign == 0 ) ? 0 : ( sofaLocal::positionsAlignment - misalign ) / sizeof( double );
+
+    components[0] = &storage[ offset ];
+    components[1] = components[0] + stride;
+    components[2] = components[1] + stride;
+
+    numPositions = numPositions_;
+}
+
+std::size_t PositionArrays::GetNumPositions() const SOFA_NOEXCEPT
+{
+    return numPositions;
+}
+
+sofa::Coordinates::Type PositionArrays::GetCoordinates() const SOFA_NOEXCEPT
+{
+    return coordinates;
+}
+
+sofa::PositionArrays::AngleUnits PositionArrays::GetAngleUnits() const SOFA_NOEXCEPT
+{
+    return angleUnits;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns one coordinate of all the positions (P values)
+ *  @param[in]      index : 0, 1 or 2 (x, y, z or azimuth, elevation, radius)
+ *
+ */
+/************************************************************************************/
+const double * PositionArrays::GetComponent(const unsigned int index) const
+{
+    SOFA_ASSERT( index < 3 );
+
+    return components[ index ];
+}
+
+const double * PositionArrays::GetX() const
+{
+    SOFA_ASSERT( coordinates == sofa::Coordinates::kCartesian );
+
+    return components[0];
+}
+
+const double * PositionArrays::GetY() const
+{
+    SOFA_ASSERT( coordinates == sofa::Coordinates::kCartesian );
+
+    return components[1];
+}
+
+const double * PositionArrays::GetZ() const
+{
+    SOFA_ASSERT( coordinates == sofa::Coordinates::kCartesian );
+
+    return components[2];
+}
+
+const double * PositionArrays::GetAzimuth() const
+{
+    SOFA_ASSERT( coordinates == sofa::Coordinates::kSpherical );
+
+    return components[0];
+}
+
+const double * PositionArrays::GetElevation() const
+{
+    SOFA_ASSERT( coordinates == sofa::Coordinates::kSpherical );
+
+    return components[1];
+}
+
+const double * PositionArrays::GetRadius() const
+{
+    SOFA_ASSERT( coordinates == sofa::Coordinates::kSpherical );
+
+    return components[2];
+}
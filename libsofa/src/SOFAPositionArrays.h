@@ -0,0 +1,133 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAPositionArrays.h
+ *   @brief      Positions stored as separate (structure of arrays) coordinates
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_POSITION_ARRAYS_H__
+#define _SOFA_POSITION_ARRAYS_H__
+
+#include "../src/SOFACoordinates.h"
+#include <vector>
+#include <cstddef>
+
+namespace sofa
+{
+
+    /************************************************************************************/
+    /*!
+     *  @class          PositionArrays
+     *  @brief          A set of P positions, stored as three arrays of P coordinates
+     *                  (azimuth, elevation, radius or x, y, z)
+     *
+     *  @details        The SOFA variables store the positions interleaved, e.g. SourcePosition [ M C ].
+     *                  Set() converts such an array, in a single pass, to the requested
+     *                  coordinates system (with the SIMD kernels of Point3::ConvertTo()) :
+     *                  - kCartesian : x, y, z in meter
+     *                  - kSpherical : azimuth, elevation, radius in meter; the angles are in degree,
+     *                    or in radian. Positions converted from cartesian coordinates have their
+     *                    azimuth in [0 360[ and their elevation in [-90 90]
+     *
+     *                  Each array starts on a 64-bytes boundary.
+     *                  The memory is reused when Set() is called again with the same (or a smaller)
+     *                  number of positions.
+     */
+    /************************************************************************************/
+    class SOFA_API PositionArrays
+    {
+    public:
+        enum AngleUnits
+        {
+            kDegree = 0,
+            kRadian = 1
+        };
+
+    public:
+        PositionArrays();
+        ~PositionArrays();
+
+        void Set(const double *positions,
+                 const std::size_t numPositions,
+                 const sofa::Coordinates::Type positionsCoordinates,
+                 const sofa::Coordinates::Type coordinates,
+                 const sofa::PositionArrays::AngleUnits angleUnits = sofa::PositionArrays::kDegree);
+
+        void Clear();
+
+        std::size_t GetNumPositions() const SOFA_NOEXCEPT;
+        sofa::Coordinates::Type GetCoordinates() const SOFA_NOEXCEPT;
+        sofa::PositionArrays::AngleUnits GetAngleUnits() const SOFA_NOEXCEPT;
+
+        const double * GetComponent(const unsigned int index) const;
+
+        const double * GetX() const;
+        const double * GetY() const;
+        const double * GetZ() const;
+
+        const double * GetAzimuth() const;
+        const double * GetElevation() const;
+        const double * GetRadius() const;
+
+    private:
+        //==============================================================================
+        void allocate(const std::size_t numPositions);
+
+    private:
+        //==============================================================================
+        std::size_t numPositions;                   ///< P
+        sofa::Coordinates::Type coordinates;
+        sofa::PositionArrays::AngleUnits angleUnits;
+
+        std::vector< double > storage;
+        double *components[3];                      ///< aligned, within storage
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( PositionArrays );
+    };
+
+}
+
+#endif /* _SOFA_POSITION_ARRAYS_H__ */
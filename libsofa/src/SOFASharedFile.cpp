@@ -0,0 +1,413 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFASharedFile.cpp
+ *   @brief      SOFA file shared by several threads
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFASharedFile.h"
+#include "../src/SOFAFile.h"
+#include "../src/SOFADataset.h"
+#include "../src/SOFAExceptions.h"
+
+using namespace sofa;
+
+/// gives access to the partial reads of Data.IR
+class SharedFile::Reader : public sofa::File
+{
+public:
+    Reader(const std::string &path)
+    : sofa::File( path )
+    {
+    }
+
+    Reader(const std::string &path, const sofa::NetCDFFile::OpenOptions &options)
+    : sofa::File( path, options )
+    {
+    }
+
+    Reader(const void *buffer, const std::size_t size, const std::string &name)
+    : sofa::File( buffer, size, name )
+    {
+    }
+
+    using sofa::File::getDataIR;
+};
+
+namespace sofaLocal
+{
+    typedef std::lock_guard< std::recursive_mutex > LibraryLock;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor
+ *  @param[in]      path : the file path
+ *
+ *  @details        Throws an exception if the file can not be opened
+ */
+/************************************************************************************/
+SharedFile::SharedFile(const std::string &path)
+: file()
+, filename( path )
+, isValid( false )
+, conventions( 0 )
+, numDataIRDimensions( 0 )
+, numMeasurements( 0 )
+, numReceivers( 0 )
+, numEmitters( 0 )
+, numDataSamples( 0 )
+, datasetMutex()
+, dataset()
+{
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    file.reset( new Reader( path ) );
+
+    initialize();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file with tuned storage access
+ *  @param[in]      path : the file path
+ *  @param[in]      options : chunk cache, diskless and read-ahead options
+ *
+ *  @details        Throws an exception if the file can not be opened
+ */
+/************************************************************************************/
+SharedFile::SharedFile(const std::string &path,
+                       const sofa::NetCDFFile::OpenOptions &options)
+: file()
+, filename( path )
+, isValid( false )
+, conventions( 0 )
+, numDataIRDimensions( 0 )
+, numMeasurements( 0 )
+, numReceivers( 0 )
+, numEmitters( 0 )
+, numDataSamples( 0 )
+, datasetMutex()
+, dataset()
+{
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    file.reset( new Reader( path, options ) );
+
+    initialize();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file stored in memory (read-only, without copy)
+ *  @param[in]      buffer : the content of the file. It shall outlive this object
+ *  @param[in]      size : size of the buffer, in bytes
+ *  @param[in]      name : name returned by GetFilename()
+ *
+ *  @details        Throws an exception if the file can not be opened
+ */
+/************************************************************************************/
+SharedFile::SharedFile(const void *buffer,
+                       const std::size_t size,
+                       const std::string &name)
+: file()
+, filename( name )
+, isValid( false )
+, conventions( 0 )
+, numDataIRDimensions( 0 )
+, numMeasurements( 0 )
+, numReceivers( 0 )
+, numEmitters( 0 )
+, numDataSamples( 0 )
+, datasetMutex()
+, dataset()
+{
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    file.reset( new Reader( buffer, size, name ) );
+
+    initialize();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor : closes the file
+ *
+ */
+/************************************************************************************/
+SharedFile::~SharedFile()
+{
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    file.reset();
+}
+
+/// reads the metadata (the library mutex is held by the caller)
+void SharedFile::initialize()
+{
+    conventions = file->DetectConventions();
+    isValid     = ( ( conventions & sofa::File::kSOFA ) != 0 );
+
+    if( isValid == false )
+    {
+        return;
+    }
+
+    numMeasurements = (std::size_t) file->GetNumMeasurements();
+    numReceivers    = (std::size_t) file->GetNumReceivers();
+    numEmitters     = (std::size_t) file->GetNumEmitters();
+    numDataSamples  = (std::size_t) file->GetNumDataSamples();
+
+    const int dimensionality = file->GetVariableDimensionality( "Data.IR" );
+    numDataIRDimensions = ( dimensionality > 0 ) ? (std::size_t) dimensionality : 0;
+}
+
+const std::string & SharedFile::GetFilename() const SOFA_NOEXCEPT
+{
+    return filename;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if this is a valid SOFA file
+ *
+ */
+/************************************************************************************/
+bool SharedFile::IsValid() const SOFA_NOEXCEPT
+{
+    return isValid;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns all the conventions the file complies with, as a combination of
+ *                  sofa::File::ConventionFlag
+ *
+ */
+/************************************************************************************/
+unsigned int SharedFile::GetConventions() const SOFA_NOEXCEPT
+{
+    return conventions;
+}
+
+std::size_t SharedFile::GetNumMeasurements() const SOFA_NOEXCEPT
+{
+    return numMeasurements;
+}
+
+std::size_t SharedFile::GetNumReceivers() const SOFA_NOEXCEPT
+{
+    return numReceivers;
+}
+
+std::size_t SharedFile::GetNumEmitters() const SOFA_NOEXCEPT
+{
+    return numEmitters;
+}
+
+std::size_t SharedFile::GetNumDataSamples() const SOFA_NOEXCEPT
+{
+    return numDataSamples;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the decoded content of the file, which can then be read by any
+ *                  thread without locking. The file is decoded on the first call only
+ *
+ *  @details        Throws an exception if the file is not valid, or the data can not be read
+ */
+/************************************************************************************/
+std::shared_ptr< const sofa::Dataset > SharedFile::GetDataset() const
+{
+    const std::lock_guard< std::mutex > lock( datasetMutex );
+
+    if( dataset == nullptr )
+    {
+        const sofaLocal::LibraryLock libraryLock( sofa::NetCDFFile::GetLibraryMutex() );
+
+        dataset = std::make_shared< const sofa::Dataset >( *file );
+    }
+
+    return dataset;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads one impulse response of a Data.IR variable of size [ M R N ]
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *  @param[out]     values : the impulse response
+ *  @param[in]      numValues : size of the values array (shall be N)
+ *
+ *  @details        Returns false if an error occured
+ */
+/************************************************************************************/
+bool SharedFile::GetDataIR(const std::size_t measurementIndex,
+                           const std::size_t receiverIndex,
+                           double *values,
+                           const std::size_t numValues) const
+{
+    if( isValid == false || numDataIRDimensions != 3 )
+    {
+        return false;
+    }
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    return file->getDataIR( measurementIndex, receiverIndex, values, numValues );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads one impulse response of a Data.IR variable of size [ M R N ]
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *  @param[out]     values : the impulse response
+ *  @param[in]      numValues : size of the values array (shall be N)
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool SharedFile::GetDataIR(const std::size_t measurementIndex,
+                           const std::size_t receiverIndex,
+                           float *values,
+                           const std::size_t numValues) const
+{
+    if( isValid == false || numDataIRDimensions != 3 )
+    {
+        return false;
+    }
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    return file->getDataIR( measurementIndex, receiverIndex, values, numValues );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads one impulse response of a Data.IR variable of size [ M R E N ]
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *  @param[in]      emitterIndex : index of the emitter (between 0 and E-1)
+ *  @param[out]     values : the impulse response
+ *  @param[in]      numValues : size of the values array (shall be N)
+ *
+ *  @details        Returns false if an error occured
+ */
+/************************************************************************************/
+bool SharedFile::GetDataIR(const std::size_t measurementIndex,
+                           const std::size_t receiverIndex,
+                           const std::size_t emitterIndex,
+                           double *values,
+                           const std::size_t numValues) const
+{
+    if( isValid == false || numDataIRDimensions != 4 )
+    {
+        return false;
+    }
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    return file->getDataIR( measurementIndex, receiverIndex, emitterIndex, values, numValues );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads one impulse response of a Data.IR variable of size [ M R E N ]
+ *  @param[in]      measurementIndex : index of the measurement (between 0 and M-1)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *  @param[in]      emitterIndex : index of the emitter (between 0 and E-1)
+ *  @param[out]     values : the impulse response
+ *  @param[in]      numValues : size of the values array (shall be N)
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool SharedFile::GetDataIR(const std::size_t measurementIndex,
+                           const std::size_t receiverIndex,
+                           const std::size_t emitterIndex,
+                           float *values,
+                           const std::size_t numValues) const
+{
+    if( isValid == false || numDataIRDimensions != 4 )
+    {
+        return false;
+    }
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    return file->getDataIR( measurementIndex, receiverIndex, emitterIndex, values, numValues );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads all the values of a variable
+ *  @param[out]     values : the values
+ *  @param[in]      variableName : name of the variable
+ *
+ *  @details        Returns false if an error occured
+ */
+/************************************************************************************/
+bool SharedFile::GetValues(std::vector< double > &values, const std::string &variableName) const
+{
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    return file->GetValues( values, variableName );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Reads all the values of a variable
+ *  @param[out]     values : the values
+ *  @param[in]      variableName : name of the variable
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool SharedFile::GetValues(std::vector< float > &values, const std::string &variableName) const
+{
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    return file->GetValues( values, variableName );
+}
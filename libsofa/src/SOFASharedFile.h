@@ -0,0 +1,170 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFASharedFile.h
+ *   @brief      SOFA file shared by several threads
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_SHARED_FILE_H__
+#define _SOFA_SHARED_FILE_H__
+
+#include "../src/SOFAPlatform.h"
+#include "../src/SOFANcFile.h"
+#include <vector>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+
+namespace sofa
+{
+    class Dataset;
+
+    /************************************************************************************/
+    /*!
+     *  @class          SharedFile
+     *  @brief          A SOFA file which can be read by several threads simultaneously
+     *
+     *  @details        The netCDF and HDF5 libraries are not thread-safe, hence sofa::File is not :
+     *                  a File shall only be used by one thread at a time, while holding
+     *                  NetCDFFile::GetLibraryMutex().
+     *
+     *                  A SharedFile provides two ways of reading a file from several threads :
+     *
+     *                  - GetDataset() decodes the whole file once (on the first call), into an
+     *                    immutable sofa::Dataset which is then read without any lock : this is
+     *                    the way to go when the workers pull many measurements.
+     *
+     *                  - GetDataIR() and GetValues() read a part of the file. The reads are
+     *                    serialized with the netCDF library mutex, so they do not scale
+     *                    with the number of threads.
+     *
+     *                  The metadata (validity, conventions, dimensions) are read when the file is
+     *                  opened. All the methods are thread-safe.
+     */
+    /************************************************************************************/
+    class SOFA_API SharedFile
+    {
+    public:
+        explicit SharedFile(const std::string &path);
+
+        SharedFile(const std::string &path,
+                   const sofa::NetCDFFile::OpenOptions &options);
+
+        SharedFile(const void *buffer,
+                   const std::size_t size,
+                   const std::string &name = "");
+
+        ~SharedFile();
+
+        const std::string & GetFilename() const SOFA_NOEXCEPT;
+
+        bool IsValid() const SOFA_NOEXCEPT;
+        unsigned int GetConventions() const SOFA_NOEXCEPT;
+
+        std::size_t GetNumMeasurements() const SOFA_NOEXCEPT;
+        std::size_t GetNumReceivers() const SOFA_NOEXCEPT;
+        std::size_t GetNumEmitters() const SOFA_NOEXCEPT;
+        std::size_t GetNumDataSamples() const SOFA_NOEXCEPT;
+
+        //==============================================================================
+        std::shared_ptr< const sofa::Dataset > GetDataset() const;
+
+        //==============================================================================
+        bool GetDataIR(const std::size_t measurementIndex,
+                       const std::size_t receiverIndex,
+                       double *values,
+                       const std::size_t numValues) const;
+
+        bool GetDataIR(const std::size_t measurementIndex,
+                       const std::size_t receiverIndex,
+                       float *values,
+                       const std::size_t numValues) const;
+
+        bool GetDataIR(const std::size_t measurementIndex,
+                       const std::size_t receiverIndex,
+                       const std::size_t emitterIndex,
+                       double *values,
+                       const std::size_t numValues) const;
+
+        bool GetDataIR(const std::size_t measurementIndex,
+                       const std::size_t receiverIndex,
+                       const std::size_t emitterIndex,
+                       float *values,
+                       const std::size_t numValues) const;
+
+        bool GetValues(std::vector< double > &values, const std::string &variableName) const;
+        bool GetValues(std::vector< float > &values, const std::string &variableName) const;
+
+    private:
+        //==============================================================================
+        class Reader;
+
+        void initialize();
+
+    private:
+        //==============================================================================
+        std::unique_ptr< Reader > file;             ///< only accessed while holding the library mutex
+        std::string filename;
+
+        bool isValid;
+        unsigned int conventions;                   ///< combination of sofa::File::ConventionFlag
+        std::size_t numDataIRDimensions;            ///< 3 for [ M R N ], 4 for [ M R E N ]
+
+        std::size_t numMeasurements;                ///< M
+        std::size_t numReceivers;                   ///< R
+        std::size_t numEmitters;                    ///< E
+        std::size_t numDataSamples;                 ///< N
+
+        mutable std::mutex datasetMutex;
+        mutable std::shared_ptr< const sofa::Dataset > dataset;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( SharedFile );
+    };
+
+}
+
+#endif /* _SOFA_SHARED_FILE_H__ */
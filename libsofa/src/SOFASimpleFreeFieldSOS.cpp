@@ -78,6 +78,49 @@ SimpleFreeFieldSOS::SimpleFreeFieldSOS(const std::string &path,
 {
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file for reading, with tuned storage access
+ *  @param[in]      path : the file path
+ *  @param[in]      options : chunk cache, diskless and read-ahead options
+ *
+ */
+/************************************************************************************/
+SimpleFreeFieldSOS::SimpleFreeFieldSOS(const std::string &path,
+                                       const sofa::NetCDFFile::OpenOptions &options)
+: sofa::File( path, options )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file stored in memory (read-only, without copy)
+ *  @param[in]      buffer : the content of the file. It shall outlive this object
+ *  @param[in]      size : size of the buffer, in bytes
+ *  @param[in]      name : name returned by GetFilename()
+ *
+ */
+/************************************************************************************/
+SimpleFreeFieldSOS::SimpleFreeFieldSOS(const void *buffer,
+                                       const std::size_t size,
+                                       const std::string &name)
+: sofa::File( buffer, size, name )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a view on a file already opened,
+ *                  sharing its netCDF handle (the file is not opened again)
+ *  @param[in]      file : the opened file
+ *
+ */
+/************************************************************************************/
+SimpleFreeFieldSOS::SimpleFreeFieldSOS(const sofa::File &file)
+: sofa::File( &file )
+{
+}
+
 bool SimpleFreeFieldSOS::checkGlobalAttributes() const
 {
     sofa::Attributes attributes;
@@ -190,6 +233,18 @@ bool SimpleFreeFieldSOS::IsValid() const
         return false;
     }
     
+    return checkConvention();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Checks the requirements specific to the SimpleFreeFieldSOS convention
+ *                  (the generic SOFA requirements are checked by File::IsValid)
+ *
+ */
+/************************************************************************************/
+bool SimpleFreeFieldSOS::checkConvention() const
+{
     sofa::File::ensureGlobalAttribute( "DatabaseName" );
     
     if( IsSOSDataType() == false )
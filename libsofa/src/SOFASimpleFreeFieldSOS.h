@@ -73,6 +73,15 @@ namespace sofa
         SimpleFreeFieldSOS(const std::string &path,
                             const netCDF::NcFile::FileMode &mode = netCDF::NcFile::read);
         
+        SimpleFreeFieldSOS(const std::string &path,
+                           const sofa::NetCDFFile::OpenOptions &options);
+        
+        SimpleFreeFieldSOS(const void *buffer,
+                           const std::size_t size,
+                           const std::string &name = "");
+        
+        explicit SimpleFreeFieldSOS(const sofa::File &file);
+        
         virtual ~SimpleFreeFieldSOS() {};
         
         virtual bool IsValid() const SOFA_OVERRIDE;
@@ -90,6 +99,7 @@ namespace sofa
         
     private:
         //==============================================================================
+        virtual bool checkConvention() const SOFA_OVERRIDE;
         bool checkGlobalAttributes() const;
         bool checkListenerVariables() const;
         
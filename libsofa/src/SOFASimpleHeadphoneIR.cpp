@@ -77,6 +77,49 @@ SimpleHeadphoneIR::SimpleHeadphoneIR(const std::string &path,
 {
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file for reading, with tuned storage access
+ *  @param[in]      path : the file path
+ *  @param[in]      options : chunk cache, diskless and read-ahead options
+ *
+ */
+/************************************************************************************/
+SimpleHeadphoneIR::SimpleHeadphoneIR(const std::string &path,
+                                     const sofa::NetCDFFile::OpenOptions &options)
+: sofa::File( path, options )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a file stored in memory (read-only, without copy)
+ *  @param[in]      buffer : the content of the file. It shall outlive this object
+ *  @param[in]      size : size of the buffer, in bytes
+ *  @param[in]      name : name returned by GetFilename()
+ *
+ */
+/************************************************************************************/
+SimpleHeadphoneIR::SimpleHeadphoneIR(const void *buffer,
+                                     const std::size_t size,
+                                     const std::string &name)
+: sofa::File( buffer, size, name )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : opens a view on a file already opened,
+ *                  sharing its netCDF handle (the file is not opened again)
+ *  @param[in]      file : the opened file
+ *
+ */
+/************************************************************************************/
+SimpleHeadphoneIR::SimpleHeadphoneIR(const sofa::File &file)
+: sofa::File( &file )
+{
+}
+
 bool SimpleHeadphoneIR::checkGlobalAttributes() const
 {
     sofa::Attributes attributes;
@@ -187,7 +230,19 @@ bool SimpleHeadphoneIR::IsValid() const
     {
         return false;
     }
-        
+    
+    return checkConvention();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Checks the requirements specific to the SimpleHeadphoneIR convention
+ *                  (the generic SOFA requirements are checked by File::IsValid)
+ *
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::checkConvention() const
+{
     sofa::File::ensureGlobalAttribute( "DatabaseName" );
     sofa::File::ensureGlobalAttribute( "SourceModel" );
     sofa::File::ensureGlobalAttribute( "SourceManufacturer" );
@@ -306,6 +361,90 @@ bool SimpleHeadphoneIR::GetDataIR(std::vector< double > &values) const
     return sofa::File::getDataIR( values );
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for all receivers.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : the array is resized if needed (R x N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::GetDataIR(const unsigned long measurementIndex, std::vector< double > &values) const
+{
+    /// Data.IR is [ M R N ]
+    
+    const unsigned long R = (unsigned long) GetNumReceivers();
+    const unsigned long N = (unsigned long) GetNumDataSamples();
+    
+    values.resize( R * N );
+    
+    return sofa::File::getDataIR( measurementIndex, &values[0], R, N );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for all receivers.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim2 x dim3)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim3 : third dimension (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::GetDataIR(const unsigned long measurementIndex, double *values, const unsigned long dim2, const unsigned long dim3) const
+{
+    /// Data.IR is [ M R N ]
+    
+    return sofa::File::getDataIR( measurementIndex, values, dim2, dim3 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse response of one measurement, for one receiver.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      values : the array is resized if needed (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, std::vector< double > &values) const
+{
+    /// Data.IR is [ M R N ]
+    
+    const unsigned long N = (unsigned long) GetNumDataSamples();
+    
+    values.resize( N );
+    
+    return sofa::File::getDataIR( measurementIndex, receiverIndex, &values[0], N );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse response of one measurement, for one receiver.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim3)
+ *  @param[in]      dim3 : third dimension (N)
+ *  @return         true on success
+ *
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, double *values, const unsigned long dim3) const
+{
+    /// Data.IR is [ M R N ]
+    
+    return sofa::File::getDataIR( measurementIndex, receiverIndex, values, dim3 );
+}
+
 /************************************************************************************/
 /*!
  *  @brief          Retrieves the Data.Delay values
@@ -328,3 +467,150 @@ bool SimpleHeadphoneIR::GetDataDelay(double *values, const unsigned long dim1, c
     return sofa::File::getDataDelay( values, dim1, dim2 );
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough
+ *  @param[in]      dim1 : first dimension (M)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim3 : third dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::GetDataIR(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const
+{
+    /// Data.IR is [ M R N ]
+    
+    return sofa::File::getDataIR( values, dim1, dim2, dim3 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values
+ *  @param[in]      values : the array is resized if needed
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::GetDataIR(std::vector< float > &values) const
+{
+    /// Data.IR is [ M R N ]
+    
+    return sofa::File::getDataIR( values );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for all receivers.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : the array is resized if needed (R x N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::GetDataIR(const unsigned long measurementIndex, std::vector< float > &values) const
+{
+    /// Data.IR is [ M R N ]
+    
+    const unsigned long R = (unsigned long) GetNumReceivers();
+    const unsigned long N = (unsigned long) GetNumDataSamples();
+    
+    values.resize( R * N );
+    
+    return sofa::File::getDataIR( measurementIndex, &values[0], R, N );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.IR values of one measurement, for all receivers.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim2 x dim3)
+ *  @param[in]      dim2 : second dimension (R)
+ *  @param[in]      dim3 : third dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::GetDataIR(const unsigned long measurementIndex, float *values, const unsigned long dim2, const unsigned long dim3) const
+{
+    /// Data.IR is [ M R N ]
+    
+    return sofa::File::getDataIR( measurementIndex, values, dim2, dim3 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse response of one measurement, for one receiver.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      values : the array is resized if needed (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, std::vector< float > &values) const
+{
+    /// Data.IR is [ M R N ]
+    
+    const unsigned long N = (unsigned long) GetNumDataSamples();
+    
+    values.resize( N );
+    
+    return sofa::File::getDataIR( measurementIndex, receiverIndex, &values[0], N );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the impulse response of one measurement, for one receiver.
+ *                  Only the requested slice is read from the file
+ *  @param[in]      measurementIndex : index of the measurement, in [0 M-1]
+ *  @param[in]      receiverIndex : index of the receiver, in [0 R-1]
+ *  @param[in]      values : array containing the values.
+ *                  The array must be allocated large enough (dim3)
+ *  @param[in]      dim3 : third dimension (N)
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, float *values, const unsigned long dim3) const
+{
+    /// Data.IR is [ M R N ]
+    
+    return sofa::File::getDataIR( measurementIndex, receiverIndex, values, dim3 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the Data.Delay values
+ *  @param[in]      values : the array is resized if needed
+ *  @return         true on success
+ *
+ *  @details        Single precision version : the values are converted while reading
+ */
+/************************************************************************************/
+bool SimpleHeadphoneIR::GetDataDelay(std::vector< float > &values) const
+{
+    /// Data.Delay is [ I R ] or [ M R ]
+    
+    return sofa::File::getDataDelay( values );
+}
+
+bool SimpleHeadphoneIR::GetDataDelay(float *values, const unsigned long dim1, const unsigned long dim2) const
+{
+    /// Data.Delay is [ I R ] or [ M R ]
+    
+    return sofa::File::getDataDelay( values, dim1, dim2 );
+}
+
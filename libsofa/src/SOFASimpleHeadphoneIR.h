@@ -73,6 +73,15 @@ namespace sofa
         SimpleHeadphoneIR(const std::string &path,
                           const netCDF::NcFile::FileMode &mode = netCDF::NcFile::read);
         
+        SimpleHeadphoneIR(const std::string &path,
+                          const sofa::NetCDFFile::OpenOptions &options);
+        
+        SimpleHeadphoneIR(const void *buffer,
+                          const std::size_t size,
+                          const std::string &name = "");
+        
+        explicit SimpleHeadphoneIR(const sofa::File &file);
+        
         virtual ~SimpleHeadphoneIR() {};
         
         virtual bool IsValid() const SOFA_OVERRIDE;
@@ -84,12 +93,28 @@ namespace sofa
         bool GetDataIR(std::vector< double > &values) const;
         bool GetDataIR(double *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
         
+        bool GetDataIR(const unsigned long measurementIndex, std::vector< double > &values) const;
+        bool GetDataIR(const unsigned long measurementIndex, double *values, const unsigned long dim2, const unsigned long dim3) const;
+        bool GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, std::vector< double > &values) const;
+        bool GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, double *values, const unsigned long dim3) const;
+        
         //==============================================================================
         bool GetDataDelay(double *values, const unsigned long dim1, const unsigned long dim2) const;
         bool GetDataDelay(std::vector< double > &values) const;
         
+        /// single precision : the values are converted while reading
+        bool GetDataIR(std::vector< float > &values) const;
+        bool GetDataIR(float *values, const unsigned long dim1, const unsigned long dim2, const unsigned long dim3) const;
+        bool GetDataIR(const unsigned long measurementIndex, std::vector< float > &values) const;
+        bool GetDataIR(const unsigned long measurementIndex, float *values, const unsigned long dim2, const unsigned long dim3) const;
+        bool GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, std::vector< float > &values) const;
+        bool GetDataIR(const unsigned long measurementIndex, const unsigned long receiverIndex, float *values, const unsigned long dim3) const;
+        bool GetDataDelay(float *values, const unsigned long dim1, const unsigned long dim2) const;
+        bool GetDataDelay(std::vector< float > &values) const;
+        
     private:
         //==============================================================================
+        virtual bool checkConvention() const SOFA_OVERRIDE;
         bool checkGlobalAttributes() const;
         bool checkListenerVariables() const;
         
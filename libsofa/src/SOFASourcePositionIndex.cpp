@@ -0,0 +1,555 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFASourcePositionIndex.cpp
+ *   @brief      Spatial index over the SourcePosition variable, for nearest neighbour queries
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFASourcePositionIndex.h"
+#include "../src/SOFAFile.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAUtils.h"
+#include "../src/SOFAListenerRotation.h"
+#include "../src/SOFAPositionArrays.h"
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    inline void normalize(double point[3]) SOFA_NOEXCEPT
+    {
+        const double norm = std::sqrt( point[0] * point[0] + point[1] * point[1] + point[2] * point[2] );
+
+        /// a position at the origin has no direction : it is left untouched
+        if( norm > 0.0 )
+        {
+            point[0] /= norm;
+            point[1] /= norm;
+            point[2] /= norm;
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the index from the SourcePosition variable of a file
+ *  @param[in]      file : a valid SOFA file (e.g. SimpleFreeFieldHRIR)
+ *  @param[in]      metric : the distance used for the queries
+ *
+ *  @details        If the file has ListenerView and ListenerUp variables, the positions are
+ *                  rotated into the listener's frame (with the orientation of the first listener).
+ *                  Throws an exception if the SourcePosition variable cannot be read,
+ *                  or if it is neither expressed in cartesian nor spherical coordinates
+ */
+/************************************************************************************/
+SourcePositionIndex::SourcePositionIndex(const sofa::File &file,
+                                         const sofa::SourcePositionIndex::Metric metric_)
+: metric( metric_ )
+, tree()
+{
+    sofa::Coordinates::Type coordinates;
+    sofa::Units::Type units;
+
+    if( file.GetSourcePosition( coordinates, units ) == false )
+    {
+        SOFA_THROW( "invalid 'SourcePosition' variable" );
+    }
+
+    std::vector< double > positions;
+
+    if( file.GetSourcePosition( positions ) == false || positions.size() % 3 != 0 )
+    {
+        SOFA_THROW( "invalid 'SourcePosition' dimensions" );
+    }
+
+    const std::size_t numPositions = positions.size() / 3;
+
+    if( file.HasVariable( "ListenerView" ) == true && file.HasVariable( "ListenerUp" ) == true )
+    {
+        const sofa::ListenerRotation listenerOrientation( file );
+
+        build( ( numPositions > 0 ) ? &positions[0] : NULL, numPositions, coordinates, &listenerOrientation );
+    }
+    else
+    {
+        build( ( numPositions > 0 ) ? &positions[0] : NULL, numPositions, coordinates, NULL );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the index from an array of positions
+ *  @param[in]      positions : interleaved positions, e.g. [ az el r az el r ... ]
+ *  @param[in]      numPositions : number of positions (the array holds 3 x numPositions values)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @param[in]      metric : the distance used for the queries
+ *
+ */
+/************************************************************************************/
+SourcePositionIndex::SourcePositionIndex(const double *positions,
+                                         const std::size_t numPositions,
+                                         const sofa::Coordinates::Type coordinates,
+                                         const sofa::SourcePositionIndex::Metric metric_)
+: metric( metric_ )
+, tree()
+{
+    build( positions, numPositions, coordinates, NULL );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Builds the index from an array of positions, expressed in the global
+ *                  coordinate system
+ *  @param[in]      positions : interleaved positions, e.g. [ az el r az el r ... ]
+ *  @param[in]      numPositions : number of positions (the array holds 3 x numPositions values)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @param[in]      listenerOrientation : orientation of the listener in the global coordinate system
+ *                  (e.g. built from ListenerView and ListenerUp); the positions are rotated
+ *                  into the listener's frame
+ *  @param[in]      metric : the distance used for the queries
+ *
+ */
+/************************************************************************************/
+SourcePositionIndex::SourcePositionIndex(const double *positions,
+                                         const std::size_t numPositions,
+                                         const sofa::Coordinates::Type coordinates,
+                                         const sofa::ListenerRotation &listenerOrientation,
+                                         const sofa::SourcePositionIndex::Metric metric_)
+: metric( metric_ )
+, tree()
+{
+    build( positions, numPositions, coordinates, &listenerOrientation );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+SourcePositionIndex::~SourcePositionIndex()
+{
+}
+
+void SourcePositionIndex::build(const double *positions,
+                                const std::size_t numPositions,
+                                const sofa::Coordinates::Type coordinates,
+                                const sofa::ListenerRotation *listenerOrientation)
+{
+    if( coordinates != sofa::Coordinates::kCartesian && coordinates != sofa::Coordinates::kSpherical )
+    {
+        SOFA_THROW( "invalid coordinates (should be cartesian or spherical)" );
+    }
+
+    std::vector< double > points( 3 * numPositions );
+
+    if( listenerOrientation != NULL && numPositions > 0 )
+    {
+        /// all the positions are rotated into the listener's frame in one pass
+        sofa::PositionArrays cartesian;
+        cartesian.Set( positions, numPositions, coordinates, sofa::Coordinates::kCartesian );
+
+        std::vector< double > rotated( 3 * numPositions );
+        double *x = &rotated[0];
+        double *y = x + numPositions;
+        double *z = y + numPositions;
+
+        listenerOrientation->ToListenerFrame( cartesian.GetX(), cartesian.GetY(), cartesian.GetZ(),
+                                              x, y, z,
+                                              numPositions );
+
+        for( std::size_t i = 0; i < numPositions; i++ )
+        {
+            toQueryPoint( &points[ 3 * i ], x[i], y[i], z[i], sofa::Coordinates::kCartesian );
+        }
+    }
+    else
+    {
+        for( std::size_t i = 0; i < numPositions; i++ )
+        {
+            toQueryPoint( &points[ 3 * i ],
+                         positions[ 3 * i + 0 ],
+                         positions[ 3 * i + 1 ],
+                         positions[ 3 * i + 2 ],
+                         coordinates );
+        }
+    }
+
+    tree.Build( ( numPositions > 0 ) ? &points[0] : NULL, numPositions );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Converts a position to the space where the tree lives
+ *                  (cartesian coordinates, projected on the unit sphere for the kAngular metric)
+ *
+ */
+/************************************************************************************/
+void SourcePositionIndex::toQueryPoint(double point[3],
+                                       const double c1,
+                                       const double c2,
+                                       const double c3,
+                                       const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT
+{
+    if( coordinates == sofa::Coordinates::kSpherical )
+    {
+        /// the radius is irrelevant for angular queries
+        const double radius = ( metric == kAngular ) ? 1.0 : c3;
+
+        sofa::SphericalToCartesian( point, c1, c2, radius );
+    }
+    else
+    {
+        point[0] = c1;
+        point[1] = c2;
+        point[2] = c3;
+
+        if( metric == kAngular )
+        {
+            sofaLocal::normalize( point );
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Converts a squared distance in the tree space to a distance
+ *                  in the metric of the index (degree or meter)
+ *
+ */
+/************************************************************************************/
+double SourcePositionIndex::toDistance(const double squaredDistance) const SOFA_NOEXCEPT
+{
+    const double chord = std::sqrt( squaredDistance );
+
+    if( metric == kEuclidean )
+    {
+        return chord;
+    }
+    else
+    {
+        /// the chord between two points of the unit sphere is 2 sin( angle / 2 )
+        const double halfChord = sofa::smin( 0.5 * chord, 1.0 );
+
+        return sofa::RadiansToDegrees( 2.0 * std::asin( halfChord ) );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of positions in the index (i.e. M)
+ *
+ */
+/************************************************************************************/
+std::size_t SourcePositionIndex::GetNumPositions() const SOFA_NOEXCEPT
+{
+    return tree.GetNumPoints();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the metric used by the index
+ *
+ */
+/************************************************************************************/
+sofa::SourcePositionIndex::Metric SourcePositionIndex::GetMetric() const SOFA_NOEXCEPT
+{
+    return metric;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the measurement whose source position is closest to a given position
+ *  @param[out]     index : index of the closest measurement, in [0 M-1]
+ *  @param[in]      c1 : x (meter) or azimuth (degree)
+ *  @param[in]      c2 : y (meter) or elevation (degree)
+ *  @param[in]      c3 : z (meter) or radius (meter)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @return         false if the index is empty
+ *
+ */
+/************************************************************************************/
+bool SourcePositionIndex::FindNearest(std::size_t &index,
+                                      const double c1,
+                                      const double c2,
+                                      const double c3,
+                                      const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT
+{
+    double distance = 0.0;
+
+    return FindNearest( index, distance, c1, c2, c3, coordinates );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the measurement whose source position is closest to a given position
+ *  @param[out]     index : index of the closest measurement, in [0 M-1]
+ *  @param[out]     distance : distance to the closest measurement (degree or meter, depending on the metric)
+ *  @param[in]      c1 : x (meter) or azimuth (degree)
+ *  @param[in]      c2 : y (meter) or elevation (degree)
+ *  @param[in]      c3 : z (meter) or radius (meter)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @return         false if the index is empty
+ *
+ */
+/************************************************************************************/
+bool SourcePositionIndex::FindNearest(std::size_t &index,
+                                      double &distance,
+                                      const double c1,
+                                      const double c2,
+                                      const double c3,
+                                      const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT
+{
+    double query[3];
+    toQueryPoint( query, c1, c2, c3, coordinates );
+
+    return findNearest( index, distance, query );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the k measurements whose source positions are closest to a given position
+ *  @param[out]     indices : indices of the closest measurements, sorted by increasing distance.
+ *                  The array must be allocated large enough (k)
+ *  @param[out]     distances : the corresponding distances (degree or meter, depending on the metric).
+ *                  The array must be allocated large enough (k)
+ *  @param[in]      k : number of requested measurements
+ *  @param[in]      c1 : x (meter) or azimuth (degree)
+ *  @param[in]      c2 : y (meter) or elevation (degree)
+ *  @param[in]      c3 : z (meter) or radius (meter)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @return         the number of measurements actually found, i.e. min( k, M )
+ *
+ */
+/************************************************************************************/
+std::size_t SourcePositionIndex::FindKNearest(std::size_t *indices,
+                                              double *distances,
+                                              const std::size_t k,
+                                              const double c1,
+                                              const double c2,
+                                              const double c3,
+                                              const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT
+{
+    double query[3];
+    toQueryPoint( query, c1, c2, c3, coordinates );
+
+    return findKNearest( indices, distances, k, query );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the measurements whose source positions lie within a given distance
+ *  @param[out]     indices : indices of the measurements, sorted by increasing distance.
+ *                  The array must be allocated large enough (maxCount)
+ *  @param[out]     distances : the corresponding distances (degree or meter, depending on the metric).
+ *                  The array must be allocated large enough (maxCount)
+ *  @param[in]      maxCount : maximum number of measurements returned
+ *  @param[in]      c1 : x (meter) or azimuth (degree)
+ *  @param[in]      c2 : y (meter) or elevation (degree)
+ *  @param[in]      c3 : z (meter) or radius (meter)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @param[in]      radius : maximum distance (degree or meter, depending on the metric)
+ *  @return         the number of measurements found, at most maxCount
+ *
+ *  @details        If more than maxCount measurements lie within the radius, the maxCount
+ *                  closest ones are returned
+ */
+/************************************************************************************/
+std::size_t SourcePositionIndex::FindInRadius(std::size_t *indices,
+                                              double *distances,
+                                              const std::size_t maxCount,
+                                              const double c1,
+                                              const double c2,
+                                              const double c3,
+                                              const sofa::Coordinates::Type coordinates,
+                                              const double radius) const SOFA_NOEXCEPT
+{
+    double query[3];
+    toQueryPoint( query, c1, c2, c3, coordinates );
+
+    double treeRadius = radius;
+
+    if( metric == kAngular && radius >= 0.0 )
+    {
+        /// the chord between two points of the unit sphere is 2 sin( angle / 2 )
+        treeRadius = 2.0 * std::sin( 0.5 * sofa::DegreesToRadians( sofa::smin( radius, 180.0 ) ) );
+    }
+
+    const std::size_t numFound = tree.FindInRadius( indices, distances, maxCount, query[0], query[1], query[2], treeRadius );
+
+    for( std::size_t i = 0; i < numFound; i++ )
+    {
+        distances[i] = toDistance( distances[i] );
+    }
+
+    return numFound;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the measurement whose source position is closest to a given position,
+ *                  for a rotated listener
+ *  @param[out]     index : index of the closest measurement, in [0 M-1]
+ *  @param[in]      c1 : x (meter) or azimuth (degree), in the coordinate system of the head tracker
+ *  @param[in]      c2 : y (meter) or elevation (degree), in the coordinate system of the head tracker
+ *  @param[in]      c3 : z (meter) or radius (meter)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @param[in]      rotation : orientation of the listener's head, in the coordinate system of the
+ *                  head tracker (the orientation of the listener in the file must not be composed
+ *                  with it : it is already taken into account by the index)
+ *  @return         false if the index is empty
+ *
+ */
+/************************************************************************************/
+bool SourcePositionIndex::FindNearest(std::size_t &index,
+                                      const double c1,
+                                      const double c2,
+                                      const double c3,
+                                      const sofa::Coordinates::Type coordinates,
+                                      const sofa::ListenerRotation &rotation) const SOFA_NOEXCEPT
+{
+    double distance = 0.0;
+
+    return FindNearest( index, distance, c1, c2, c3, coordinates, rotation );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the measurement whose source position is closest to a given position,
+ *                  for a rotated listener
+ *  @param[out]     index : index of the closest measurement, in [0 M-1]
+ *  @param[out]     distance : distance to the closest measurement (degree or meter, depending on the metric)
+ *  @param[in]      c1 : x (meter) or azimuth (degree), in the coordinate system of the head tracker
+ *  @param[in]      c2 : y (meter) or elevation (degree), in the coordinate system of the head tracker
+ *  @param[in]      c3 : z (meter) or radius (meter)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @param[in]      rotation : orientation of the listener's head, in the coordinate system of the
+ *                  head tracker (the orientation of the listener in the file must not be composed
+ *                  with it : it is already taken into account by the index)
+ *  @return         false if the index is empty
+ *
+ */
+/************************************************************************************/
+bool SourcePositionIndex::FindNearest(std::size_t &index,
+                                      double &distance,
+                                      const double c1,
+                                      const double c2,
+                                      const double c3,
+                                      const sofa::Coordinates::Type coordinates,
+                                      const sofa::ListenerRotation &rotation) const SOFA_NOEXCEPT
+{
+    double query[3];
+    toQueryPoint( query, c1, c2, c3, coordinates );
+
+    rotation.ToListenerFrame( query );
+
+    return findNearest( index, distance, query );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds the k measurements whose source positions are closest to a given position,
+ *                  for a rotated listener
+ *  @param[out]     indices : indices of the closest measurements, sorted by increasing distance.
+ *                  The array must be allocated large enough (k)
+ *  @param[out]     distances : the corresponding distances (degree or meter, depending on the metric).
+ *                  The array must be allocated large enough (k)
+ *  @param[in]      k : number of requested measurements
+ *  @param[in]      c1 : x (meter) or azimuth (degree), in the coordinate system of the head tracker
+ *  @param[in]      c2 : y (meter) or elevation (degree), in the coordinate system of the head tracker
+ *  @param[in]      c3 : z (meter) or radius (meter)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @param[in]      rotation : orientation of the listener's head, in the coordinate system of the
+ *                  head tracker (the orientation of the listener in the file must not be composed
+ *                  with it : it is already taken into account by the index)
+ *  @return         the number of measurements actually found, i.e. min( k, M )
+ *
+ */
+/************************************************************************************/
+std::size_t SourcePositionIndex::FindKNearest(std::size_t *indices,
+                                              double *distances,
+                                              const std::size_t k,
+                                              const double c1,
+                                              const double c2,
+                                              const double c3,
+                                              const sofa::Coordinates::Type coordinates,
+                                              const sofa::ListenerRotation &rotation) const SOFA_NOEXCEPT
+{
+    double query[3];
+    toQueryPoint( query, c1, c2, c3, coordinates );
+
+    rotation.ToListenerFrame( query );
+
+    return findKNearest( indices, distances, k, query );
+}
+
+bool SourcePositionIndex::findNearest(std::size_t &index,
+                                      double &distance,
+                                      const double query[3]) const SOFA_NOEXCEPT
+{
+    double squaredDistance = 0.0;
+
+    if( tree.FindNearest( index, squaredDistance, query[0], query[1], query[2] ) == false )
+    {
+        return false;
+    }
+
+    distance = toDistance( squaredDistance );
+
+    return true;
+}
+
+std::size_t SourcePositionIndex::findKNearest(std::size_t *indices,
+                                              double *distances,
+                                              const std::size_t k,
+                                              const double query[3]) const SOFA_NOEXCEPT
+{
+    const std::size_t numFound = tree.FindKNearest( indices, distances, k, query[0], query[1], query[2] );
+
+    for( std::size_t i = 0; i < numFound; i++ )
+    {
+        distances[i] = toDistance( distances[i] );
+    }
+
+    return numFound;
+}
@@ -0,0 +1,209 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFASourcePositionIndex.h
+ *   @brief      Spatial index over the SourcePosition variable, for nearest neighbour queries
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_SOURCE_POSITION_INDEX_H__
+#define _SOFA_SOURCE_POSITION_INDEX_H__
+
+#include "../src/SOFAKdTree.h"
+#include "../src/SOFACoordinates.h"
+
+namespace sofa
+{
+    class File;
+    class ListenerRotation;
+
+    /************************************************************************************/
+    /*!
+     *  @class          SourcePositionIndex
+     *  @brief          Finds the measurement(s) closest to a given source position
+     *
+     *  @details        The index is built once from the SourcePosition variable (e.g. of a
+     *                  SimpleFreeFieldHRIR file), and replaces the linear scan of all the M
+     *                  positions by a k-d tree query in O(log M), which does not allocate memory.
+     *
+     *                  Positions and queries may be expressed in cartesian coordinates (meter)
+     *                  or in spherical coordinates (azimuth in degree, elevation in degree,
+     *                  radius in meter), as defined by the SOFA specifications.
+     *
+     *                  With the kAngular metric, only the direction matters : positions are projected
+     *                  onto the unit sphere, and distances are great-circle angles in degree.
+     *                  With the kEuclidean metric, distances are euclidean distances in meter.
+     *
+     *                  The positions are stored in the listener's frame (x towards the view
+     *                  direction, z towards the top of the head). When the index is built from a file
+     *                  with ListenerView and ListenerUp variables, the SourcePosition set is rotated
+     *                  into this frame once, in a single batched pass; the queries are then relative
+     *                  to the head, whatever the orientation of the listener in the file.
+     *
+     *                  The queries taking a ListenerRotation expect a position in the coordinate
+     *                  system of the head tracker (e.g. a virtual source in the scene), and the
+     *                  orientation of the head in that system : only the query is rotated, the index
+     *                  is never rebuilt when the head moves.
+     */
+    /************************************************************************************/
+    class SOFA_API SourcePositionIndex
+    {
+    public:
+        enum Metric
+        {
+            kAngular    = 0,    ///< compare directions only; distances in degree
+            kEuclidean  = 1     ///< compare 3D positions; distances in meter
+        };
+
+    public:
+        SourcePositionIndex(const sofa::File &file,
+                            const sofa::SourcePositionIndex::Metric metric = sofa::SourcePositionIndex::kAngular);
+
+        SourcePositionIndex(const double *positions,
+                            const std::size_t numPositions,
+                            const sofa::Coordinates::Type coordinates,
+                            const sofa::SourcePositionIndex::Metric metric = sofa::SourcePositionIndex::kAngular);
+
+        SourcePositionIndex(const double *positions,
+                            const std::size_t numPositions,
+                            const sofa::Coordinates::Type coordinates,
+                            const sofa::ListenerRotation &listenerOrientation,
+                            const sofa::SourcePositionIndex::Metric metric = sofa::SourcePositionIndex::kAngular);
+
+        ~SourcePositionIndex();
+
+        std::size_t GetNumPositions() const SOFA_NOEXCEPT;
+        sofa::SourcePositionIndex::Metric GetMetric() const SOFA_NOEXCEPT;
+
+        bool FindNearest(std::size_t &index,
+                         const double c1,
+                         const double c2,
+                         const double c3,
+                         const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT;
+
+        bool FindNearest(std::size_t &index,
+                         double &distance,
+                         const double c1,
+                         const double c2,
+                         const double c3,
+                         const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT;
+
+        std::size_t FindKNearest(std::size_t *indices,
+                                 double *distances,
+                                 const std::size_t k,
+                                 const double c1,
+                                 const double c2,
+                                 const double c3,
+                                 const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT;
+
+        std::size_t FindInRadius(std::size_t *indices,
+                                 double *distances,
+                                 const std::size_t maxCount,
+                                 const double c1,
+                                 const double c2,
+                                 const double c3,
+                                 const sofa::Coordinates::Type coordinates,
+                                 const double radius) const SOFA_NOEXCEPT;
+
+        //==============================================================================
+        bool FindNearest(std::size_t &index,
+                         const double c1,
+                         const double c2,
+                         const double c3,
+                         const sofa::Coordinates::Type coordinates,
+                         const sofa::ListenerRotation &rotation) const SOFA_NOEXCEPT;
+
+        bool FindNearest(std::size_t &index,
+                         double &distance,
+                         const double c1,
+                         const double c2,
+                         const double c3,
+                         const sofa::Coordinates::Type coordinates,
+                         const sofa::ListenerRotation &rotation) const SOFA_NOEXCEPT;
+
+        std::size_t FindKNearest(std::size_t *indices,
+                                 double *distances,
+                                 const std::size_t k,
+                                 const double c1,
+                                 const double c2,
+                                 const double c3,
+                                 const sofa::Coordinates::Type coordinates,
+                                 const sofa::ListenerRotation &rotation) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        void build(const double *positions,
+                   const std::size_t numPositions,
+                   const sofa::Coordinates::Type coordinates,
+                   const sofa::ListenerRotation *listenerOrientation);
+
+        void toQueryPoint(double point[3],
+                          const double c1,
+                          const double c2,
+                          const double c3,
+                          const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT;
+
+        double toDistance(const double squaredDistance) const SOFA_NOEXCEPT;
+
+        bool findNearest(std::size_t &index,
+                         double &distance,
+                         const double query[3]) const SOFA_NOEXCEPT;
+
+        std::size_t findKNearest(std::size_t *indices,
+                                 double *distances,
+                                 const std::size_t k,
+                                 const double query[3]) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        const sofa::SourcePositionIndex::Metric metric;
+        sofa::KdTree tree;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( SourcePositionIndex );
+    };
+
+}
+
+#endif /* _SOFA_SOURCE_POSITION_INDEX_H__ */
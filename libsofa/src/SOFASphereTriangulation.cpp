@@ -0,0 +1,757 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFASphereTriangulation.cpp
+ *   @brief      Triangulation of a set of directions on the unit sphere
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFASphereTriangulation.h"
+#include "../src/SOFAUtils.h"
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <utility>
+
+using namespace sofa;
+
+const std::size_t SphereTriangulation::kInvalidIndex = std::numeric_limits< std::size_t >::max();
+
+namespace sofaLocal
+{
+    /// tolerance for the geometric predicates, for points on the unit sphere
+    static const double kEpsilon = 1e-12;
+
+    inline void cross(double result[3], const double a[3], const double b[3]) SOFA_NOEXCEPT
+    {
+        result[0] = a[1] * b[2] - a[2] * b[1];
+        result[1] = a[2] * b[0] - a[0] * b[2];
+        result[2] = a[0] * b[1] - a[1] * b[0];
+    }
+
+    inline double dot(const double a[3], const double b[3]) SOFA_NOEXCEPT
+    {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    }
+
+    inline void subtract(double result[3], const double a[3], const double b[3]) SOFA_NOEXCEPT
+    {
+        result[0] = a[0] - b[0];
+        result[1] = a[1] - b[1];
+        result[2] = a[2] - b[2];
+    }
+
+    inline double norm(const double a[3]) SOFA_NOEXCEPT
+    {
+        return std::sqrt( dot( a, a ) );
+    }
+
+    /// a face of the convex hull, during its construction
+    struct HullFace
+    {
+        std::size_t vertices[3];
+        double normal[3];           ///< unit outward normal
+        double offset;              ///< signed distance of the plane to the origin
+        std::size_t stamp;          ///< last point for which the face was found visible
+        bool alive;
+    };
+
+    typedef std::map< std::pair< std::size_t, std::size_t >, std::size_t > EdgeMap;
+
+    bool makeFace(HullFace &face,
+                  const std::vector< double > &points,
+                  const std::size_t a,
+                  const std::size_t b,
+                  const std::size_t c)
+    {
+        face.vertices[0] = a;
+        face.vertices[1] = b;
+        face.vertices[2] = c;
+        face.stamp       = SphereTriangulation::kInvalidIndex;
+        face.alive       = true;
+
+        double ab[3], ac[3];
+        subtract( ab, &points[ 3 * b ], &points[ 3 * a ] );
+        subtract( ac, &points[ 3 * c ], &points[ 3 * a ] );
+        cross( face.normal, ab, ac );
+
+        const double length = norm( face.normal );
+
+        if( length <= 0.0 )
+        {
+            return false;
+        }
+
+        face.normal[0] /= length;
+        face.normal[1] /= length;
+        face.normal[2] /= length;
+
+        face.offset = dot( face.normal, &points[ 3 * a ] );
+
+        return true;
+    }
+
+    inline double signedDistance(const HullFace &face, const double point[3]) SOFA_NOEXCEPT
+    {
+        return dot( face.normal, point ) - face.offset;
+    }
+
+    void addFace(std::vector< HullFace > &faces, EdgeMap &edges, const HullFace &face)
+    {
+        const std::size_t index = faces.size();
+        faces.push_back( face );
+
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            edges[ std::make_pair( face.vertices[i], face.vertices[ (i + 1) % 3 ] ) ] = index;
+        }
+    }
+
+    /// lexicographic comparison of directions, used to discard duplicates
+    struct DirectionComparator
+    {
+        DirectionComparator(const std::vector< double > &points_) : points( points_ ) {}
+
+        bool operator()(const std::size_t a, const std::size_t b) const
+        {
+            return std::lexicographical_compare( &points[ 3 * a ], &points[ 3 * a + 3 ],
+                                                 &points[ 3 * b ], &points[ 3 * b + 3 ] );
+        }
+
+        const std::vector< double > &points;
+    };
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor
+ *
+ */
+/************************************************************************************/
+SphereTriangulation::SphereTriangulation()
+: points()
+, triangles()
+, vertexTriangle()
+, valid( false )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+SphereTriangulation::~SphereTriangulation()
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Removes all the directions and triangles
+ *
+ */
+/************************************************************************************/
+void SphereTriangulation::Clear()
+{
+    points.clear();
+    triangles.clear();
+    vertexTriangle.clear();
+    valid = false;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes the triangulation
+ *  @param[in]      directions : interleaved cartesian coordinates [ x y z x y z ... ]
+ *                  (the vectors do not need to be normalized)
+ *  @param[in]      numDirections : number of directions
+ *  @return         true if the triangulation is valid, i.e. if it encloses the origin
+ *
+ *  @details        The vertex indices used by the triangulation refer to the position
+ *                  of the directions in this array
+ */
+/************************************************************************************/
+bool SphereTriangulation::Build(const double *directions, const std::size_t numDirections)
+{
+    Clear();
+
+    points.resize( 3 * numDirections );
+    vertexTriangle.resize( numDirections, kInvalidIndex );
+
+    std::vector< std::size_t > candidates;
+    candidates.reserve( numDirections );
+
+    for( std::size_t i = 0; i < numDirections; i++ )
+    {
+        double *point = &points[ 3 * i ];
+
+        point[0] = directions[ 3 * i + 0 ];
+        point[1] = directions[ 3 * i + 1 ];
+        point[2] = directions[ 3 * i + 2 ];
+
+        const double length = sofaLocal::norm( point );
+
+        /// a null vector has no direction
+        if( length > 0.0 )
+        {
+            point[0] /= length;
+            point[1] /= length;
+            point[2] /= length;
+
+            candidates.push_back( i );
+        }
+    }
+
+    /// discard duplicated directions (keeping the first occurrence)
+    std::stable_sort( candidates.begin(), candidates.end(), sofaLocal::DirectionComparator( points ) );
+
+    std::vector< std::size_t > unique;
+    unique.reserve( candidates.size() );
+
+    for( std::size_t i = 0; i < candidates.size(); i++ )
+    {
+        if( unique.empty() == false )
+        {
+            double difference[3];
+            sofaLocal::subtract( difference, &points[ 3 * candidates[i] ], &points[ 3 * unique.back() ] );
+
+            if( sofaLocal::dot( difference, difference ) <= sofaLocal::kEpsilon )
+            {
+                continue;
+            }
+        }
+
+        unique.push_back( candidates[i] );
+    }
+
+    /// restore the original order, so that the construction does not depend on the sorting
+    std::sort( unique.begin(), unique.end() );
+
+    if( buildHull( unique ) == false || buildAdjacency() == false )
+    {
+        triangles.clear();
+        return false;
+    }
+
+    /// the hull must enclose the origin, otherwise the directions can not be located
+    for( std::size_t i = 0; i < triangles.size(); i++ )
+    {
+        const Triangle &triangle = triangles[i];
+
+        double normal[3];
+        double ab[3], ac[3];
+        sofaLocal::subtract( ab, &points[ 3 * triangle.vertices[1] ], &points[ 3 * triangle.vertices[0] ] );
+        sofaLocal::subtract( ac, &points[ 3 * triangle.vertices[2] ], &points[ 3 * triangle.vertices[0] ] );
+        sofaLocal::cross( normal, ab, ac );
+
+        const double length = sofaLocal::norm( normal );
+
+        if( length <= 0.0
+           || sofaLocal::dot( normal, &points[ 3 * triangle.vertices[0] ] ) / length <= sofaLocal::kEpsilon )
+        {
+            triangles.clear();
+            return false;
+        }
+    }
+
+    for( std::size_t i = 0; i < triangles.size(); i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            vertexTriangle[ triangles[i].vertices[j] ] = i;
+        }
+    }
+
+    valid = true;
+
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Incremental convex hull of the candidate directions
+ *
+ */
+/************************************************************************************/
+bool SphereTriangulation::buildHull(const std::vector< std::size_t > &candidates)
+{
+    if( candidates.size() < 4 )
+    {
+        return false;
+    }
+
+    //==============================================================================
+    /// initial tetrahedron
+    //==============================================================================
+    const double *p0 = &points[ 3 * candidates[0] ];
+
+    std::size_t i1 = kInvalidIndex;
+    double best = 0.0;
+    for( std::size_t i = 1; i < candidates.size(); i++ )
+    {
+        double difference[3];
+        sofaLocal::subtract( difference, &points[ 3 * candidates[i] ], p0 );
+
+        const double distance = sofaLocal::norm( difference );
+        if( distance > best )
+        {
+            best = distance;
+            i1   = i;
+        }
+    }
+
+    if( i1 == kInvalidIndex || best <= sofaLocal::kEpsilon )
+    {
+        return false;
+    }
+
+    const double *p1 = &points[ 3 * candidates[i1] ];
+    double axis[3];
+    sofaLocal::subtract( axis, p1, p0 );
+
+    std::size_t i2 = kInvalidIndex;
+    best = 0.0;
+    for( std::size_t i = 1; i < candidates.size(); i++ )
+    {
+        double difference[3], normal[3];
+        sofaLocal::subtract( difference, &points[ 3 * candidates[i] ], p0 );
+        sofaLocal::cross( normal, axis, difference );
+
+        const double distance = sofaLocal::norm( normal );
+        if( distance > best )
+        {
+            best = distance;
+            i2   = i;
+        }
+    }
+
+    if( i2 == kInvalidIndex || best <= sofaLocal::kEpsilon )
+    {
+        return false;
+    }
+
+    sofaLocal::HullFace base;
+    sofaLocal::makeFace( base, points, candidates[0], candidates[i1], candidates[i2] );
+
+    std::size_t i3 = kInvalidIndex;
+    best = 0.0;
+    for( std::size_t i = 1; i < candidates.size(); i++ )
+    {
+        const double distance = sofa::FAbs( sofaLocal::signedDistance( base, &points[ 3 * candidates[i] ] ) );
+        if( distance > best )
+        {
+            best = distance;
+            i3   = i;
+        }
+    }
+
+    if( i3 == kInvalidIndex || best <= sofaLocal::kEpsilon )
+    {
+        /// all the directions are coplanar
+        return false;
+    }
+
+    const std::size_t tetrahedron[4] = { candidates[0], candidates[i1], candidates[i2], candidates[i3] };
+
+    std::vector< sofaLocal::HullFace > faces;
+    faces.reserve( 8 * candidates.size() );
+
+    sofaLocal::EdgeMap edges;
+
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        const std::size_t a     = tetrahedron[ i ];
+        std::size_t b           = tetrahedron[ (i + 1) % 4 ];
+        std::size_t c           = tetrahedron[ (i + 2) % 4 ];
+        const std::size_t other = tetrahedron[ (i + 3) % 4 ];
+
+        sofaLocal::HullFace face;
+        sofaLocal::makeFace( face, points, a, b, c );
+
+        /// the outward normal points away from the remaining vertex
+        if( sofaLocal::signedDistance( face, &points[ 3 * other ] ) > 0.0 )
+        {
+            std::swap( b, c );
+            sofaLocal::makeFace( face, points, a, b, c );
+        }
+
+        sofaLocal::addFace( faces, edges, face );
+    }
+
+    //==============================================================================
+    /// add the remaining directions one by one
+    //==============================================================================
+    std::vector< std::size_t > visible;
+    std::vector< std::pair< std::size_t, std::size_t > > horizon;
+
+    for( std::size_t n = 1; n < candidates.size(); n++ )
+    {
+        const std::size_t vertex = candidates[n];
+
+        if( vertex == tetrahedron[1] || vertex == tetrahedron[2] || vertex == tetrahedron[3] )
+        {
+            continue;
+        }
+
+        const double *point = &points[ 3 * vertex ];
+
+        visible.clear();
+        for( std::size_t i = 0; i < faces.size(); i++ )
+        {
+            if( faces[i].alive == true && sofaLocal::signedDistance( faces[i], point ) > sofaLocal::kEpsilon )
+            {
+                faces[i].stamp = vertex;
+                visible.push_back( i );
+            }
+        }
+
+        if( visible.empty() == true )
+        {
+            /// the point is inside the current hull
+            continue;
+        }
+
+        /// the horizon is made of the edges of visible faces whose twin face is not visible
+        horizon.clear();
+        for( std::size_t i = 0; i < visible.size(); i++ )
+        {
+            const sofaLocal::HullFace &face = faces[ visible[i] ];
+
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                const std::size_t a = face.vertices[ j ];
+                const std::size_t b = face.vertices[ (j + 1) % 3 ];
+
+                const sofaLocal::EdgeMap::const_iterator twin = edges.find( std::make_pair( b, a ) );
+
+                if( twin == edges.end() )
+                {
+                    return false;
+                }
+
+                if( faces[ twin->second ].stamp != vertex )
+                {
+                    horizon.push_back( std::make_pair( a, b ) );
+                }
+            }
+        }
+
+        for( std::size_t i = 0; i < visible.size(); i++ )
+        {
+            sofaLocal::HullFace &face = faces[ visible[i] ];
+            face.alive = false;
+
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                edges.erase( std::make_pair( face.vertices[j], face.vertices[ (j + 1) % 3 ] ) );
+            }
+        }
+
+        for( std::size_t i = 0; i < horizon.size(); i++ )
+        {
+            sofaLocal::HullFace face;
+
+            if( sofaLocal::makeFace( face, points, horizon[i].first, horizon[i].second, vertex ) == false )
+            {
+                return false;
+            }
+
+            sofaLocal::addFace( faces, edges, face );
+        }
+    }
+
+    //==============================================================================
+    /// keep the faces of the final hull
+    //==============================================================================
+    for( std::size_t i = 0; i < faces.size(); i++ )
+    {
+        if( faces[i].alive == true )
+        {
+            Triangle triangle;
+
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                triangle.vertices[j]   = faces[i].vertices[j];
+                triangle.neighbours[j] = kInvalidIndex;
+            }
+
+            triangles.push_back( triangle );
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Finds, for each edge of each triangle, the triangle on the other side
+ *
+ */
+/************************************************************************************/
+bool SphereTriangulation::buildAdjacency()
+{
+    sofaLocal::EdgeMap edges;
+
+    for( std::size_t i = 0; i < triangles.size(); i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            edges[ std::make_pair( triangles[i].vertices[j], triangles[i].vertices[ (j + 1) % 3 ] ) ] = i;
+        }
+    }
+
+    for( std::size_t i = 0; i < triangles.size(); i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            const sofaLocal::EdgeMap::const_iterator twin =
+            edges.find( std::make_pair( triangles[i].vertices[ (j + 1) % 3 ], triangles[i].vertices[j] ) );
+
+            if( twin == edges.end() )
+            {
+                return false;
+            }
+
+            triangles[i].neighbours[j] = twin->second;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns true if the triangulation has been successfully computed
+ *
+ */
+/************************************************************************************/
+bool SphereTriangulation::IsValid() const SOFA_NOEXCEPT
+{
+    return valid;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of directions given to Build()
+ *
+ */
+/************************************************************************************/
+std::size_t SphereTriangulation::GetNumDirections() const SOFA_NOEXCEPT
+{
+    return vertexTriangle.size();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of triangles
+ *
+ */
+/************************************************************************************/
+std::size_t SphereTriangulation::GetNumTriangles() const SOFA_NOEXCEPT
+{
+    return triangles.size();
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Retrieves the vertices of one triangle (counterclockwise, seen from outside)
+ *  @param[out]     vertices : indices of the three directions
+ *  @param[in]      triangleIndex : index of the triangle
+ *  @return         false if the index is out of range
+ *
+ */
+/************************************************************************************/
+bool SphereTriangulation::GetTriangle(std::size_t vertices[3], const std::size_t triangleIndex) const SOFA_NOEXCEPT
+{
+    if( triangleIndex >= triangles.size() )
+    {
+        return false;
+    }
+
+    vertices[0] = triangles[triangleIndex].vertices[0];
+    vertices[1] = triangles[triangleIndex].vertices[1];
+    vertices[2] = triangles[triangleIndex].vertices[2];
+
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns which side of the great circle ( v1, v2 ) a direction lies on
+ *                  (positive on the left, i.e. towards the inside of a counterclockwise triangle)
+ *
+ */
+/************************************************************************************/
+double SphereTriangulation::edgeSide(const std::size_t v1, const std::size_t v2, const double direction[3]) const SOFA_NOEXCEPT
+{
+    double normal[3];
+    sofaLocal::cross( normal, &points[ 3 * v1 ], &points[ 3 * v2 ] );
+
+    return sofaLocal::dot( normal, direction );
+}
+
+bool SphereTriangulation::isInside(const Triangle &triangle, const double direction[3], std::size_t &worstEdge) const SOFA_NOEXCEPT
+{
+    double worst = 0.0;
+    worstEdge    = kInvalidIndex;
+
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        const double side = edgeSide( triangle.vertices[i], triangle.vertices[ (i + 1) % 3 ], direction );
+
+        if( side < worst )
+        {
+            worst     = side;
+            worstEdge = i;
+        }
+    }
+
+    return ( worstEdge == kInvalidIndex || worst >= -sofaLocal::kEpsilon );
+}
+
+void SphereTriangulation::computeWeights(const Triangle &triangle,
+                                         std::size_t vertices[3],
+                                         double weights[3],
+                                         const double direction[3]) const SOFA_NOEXCEPT
+{
+    double sum = 0.0;
+
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        vertices[i] = triangle.vertices[i];
+
+        /// the weight of a vertex is proportional to the volume spanned by the direction and the opposite edge
+        const double weight = edgeSide( triangle.vertices[ (i + 1) % 3 ], triangle.vertices[ (i + 2) % 3 ], direction );
+
+        weights[i] = sofa::smax( weight, 0.0 );
+        sum       += weights[i];
+    }
+
+    if( sum > 0.0 )
+    {
+        weights[0] /= sum;
+        weights[1] /= sum;
+        weights[2] /= sum;
+    }
+    else
+    {
+        weights[0] = 1.0;
+        weights[1] = 0.0;
+        weights[2] = 0.0;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Locates the triangle which contains a direction, and computes
+ *                  the barycentric weights of its vertices
+ *  @param[out]     vertices : indices of the three directions of the triangle
+ *  @param[out]     weights : barycentric weights (positive, summing to 1)
+ *  @param[in]      direction : query direction, cartesian coordinates (not necessarily normalized)
+ *  @param[in]      startVertex : the walk starts from a triangle incident to this vertex.
+ *                  Giving a vertex close to the direction (e.g. the nearest neighbour, or the
+ *                  result of the previous query) makes the search faster
+ *  @return         false if the triangulation is not valid, or if the direction is null
+ *
+ *  @details        This method does not allocate memory
+ */
+/************************************************************************************/
+bool SphereTriangulation::FindTriangle(std::size_t vertices[3],
+                                       double weights[3],
+                                       const double direction[3],
+                                       const std::size_t startVertex) const SOFA_NOEXCEPT
+{
+    if( valid == false || sofaLocal::dot( direction, direction ) <= 0.0 )
+    {
+        return false;
+    }
+
+    std::size_t current = 0;
+
+    if( startVertex < vertexTriangle.size() && vertexTriangle[startVertex] != kInvalidIndex )
+    {
+        current = vertexTriangle[startVertex];
+    }
+
+    //==============================================================================
+    /// walk towards the direction, crossing the edge which is the most violated
+    //==============================================================================
+    for( std::size_t step = 0; step < triangles.size(); step++ )
+    {
+        std::size_t edge;
+
+        if( isInside( triangles[current], direction, edge ) == true )
+        {
+            computeWeights( triangles[current], vertices, weights, direction );
+            return true;
+        }
+
+        current = triangles[current].neighbours[edge];
+    }
+
+    //==============================================================================
+    /// should not happen, except in case of numerical troubles : exhaustive search
+    //==============================================================================
+    std::size_t bestTriangle = 0;
+    double bestSide          = -std::numeric_limits< double >::max();
+
+    for( std::size_t i = 0; i < triangles.size(); i++ )
+    {
+        double side = std::numeric_limits< double >::max();
+
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            side = sofa::smin( side, edgeSide( triangles[i].vertices[j], triangles[i].vertices[ (j + 1) % 3 ], direction ) );
+        }
+
+        if( side > bestSide )
+        {
+            bestSide     = side;
+            bestTriangle = i;
+        }
+    }
+
+    computeWeights( triangles[bestTriangle], vertices, weights, direction );
+
+    return true;
+}
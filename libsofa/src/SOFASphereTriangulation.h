@@ -0,0 +1,138 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFASphereTriangulation.h
+ *   @brief      Triangulation of a set of directions on the unit sphere
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_SPHERE_TRIANGULATION_H__
+#define _SOFA_SPHERE_TRIANGULATION_H__
+
+#include "../src/SOFAPlatform.h"
+#include <vector>
+#include <cstddef>
+
+namespace sofa
+{
+
+    /************************************************************************************/
+    /*!
+     *  @class          SphereTriangulation
+     *  @brief          Delaunay triangulation of directions on the unit sphere
+     *
+     *  @details        The triangulation is the convex hull of the (normalized) directions,
+     *                  which, for points lying on a sphere, is equivalent to the spherical
+     *                  Delaunay triangulation. It is computed once (incremental convex hull),
+     *                  together with the adjacency between triangles.
+     *
+     *                  Locating the triangle which contains a direction is then done by walking
+     *                  across the triangles, starting from a given vertex (typically the nearest
+     *                  measurement), and does not allocate any memory.
+     *
+     *                  The triangulation is only valid if the hull encloses the origin, i.e. if the
+     *                  directions are not all located in the same hemisphere.
+     *                  Duplicated directions (e.g. several distances along the same direction)
+     *                  are only used once.
+     */
+    /************************************************************************************/
+    class SOFA_API SphereTriangulation
+    {
+    public:
+        static const std::size_t kInvalidIndex;
+
+    public:
+        SphereTriangulation();
+        ~SphereTriangulation();
+
+        bool Build(const double *directions, const std::size_t numDirections);
+        void Clear();
+
+        bool IsValid() const SOFA_NOEXCEPT;
+
+        std::size_t GetNumDirections() const SOFA_NOEXCEPT;
+        std::size_t GetNumTriangles() const SOFA_NOEXCEPT;
+
+        bool GetTriangle(std::size_t vertices[3], const std::size_t triangleIndex) const SOFA_NOEXCEPT;
+
+        bool FindTriangle(std::size_t vertices[3],
+                          double weights[3],
+                          const double direction[3],
+                          const std::size_t startVertex = 0) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        struct Triangle
+        {
+            std::size_t vertices[3];    ///< counterclockwise, seen from outside
+            std::size_t neighbours[3];  ///< neighbours[i] shares the edge ( vertices[i], vertices[i+1] )
+        };
+
+        //==============================================================================
+        bool buildHull(const std::vector< std::size_t > &candidates);
+        bool buildAdjacency();
+
+        double edgeSide(const std::size_t v1, const std::size_t v2, const double direction[3]) const SOFA_NOEXCEPT;
+
+        bool isInside(const Triangle &triangle, const double direction[3], std::size_t &worstEdge) const SOFA_NOEXCEPT;
+
+        void computeWeights(const Triangle &triangle,
+                            std::size_t vertices[3],
+                            double weights[3],
+                            const double direction[3]) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        std::vector< double > points;                       ///< unit vectors [ x y z x y z ... ]
+        std::vector< Triangle > triangles;                  ///< triangles of the hull
+        std::vector< std::size_t > vertexTriangle;          ///< one triangle incident to each vertex (or kInvalidIndex)
+        bool valid;
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( SphereTriangulation );
+    };
+
+}
+
+#endif /* _SOFA_SPHERE_TRIANGULATION_H__ */
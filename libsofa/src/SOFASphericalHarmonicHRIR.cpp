@@ -0,0 +1,771 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFASphericalHarmonicHRIR.cpp
+ *   @brief      Spherical harmonic representation of HRIRs, evaluated for any direction
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFASphericalHarmonicHRIR.h"
+#include "../src/SOFASimpleFreeFieldHRIR.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAHostArchitecture.h"
+#include "../src/SOFAUtils.h"
+#include <cmath>
+
+#if ( SOFA_SIMD_AVX == 1 )
+    #include <immintrin.h>
+#elif ( SOFA_SIMD_SSE2 == 1 )
+    #include <emmintrin.h>
+#elif ( SOFA_SIMD_NEON == 1 )
+    #include <arm_neon.h>
+#endif
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    static const std::size_t maxNumCoefficients = ( sofa::SphericalHarmonicHRIR::kMaxOrder + 1 ) * ( sofa::SphericalHarmonicHRIR::kMaxOrder + 1 );
+
+    /// output = gain * input
+    static void multiply(float *output,
+                         const float *input,
+                         const float gain,
+                         const std::size_t size) SOFA_NOEXCEPT
+    {
+        std::size_t i = 0;
+
+#if ( SOFA_SIMD_AVX == 1 )
+        const __m256 g = _mm256_set1_ps( gain );
+        for( ; i + 8 <= size; i += 8 )
+        {
+            _mm256_storeu_ps( output + i, _mm256_mul_ps( g, _mm256_loadu_ps( input + i ) ) );
+        }
+#elif ( SOFA_SIMD_SSE2 == 1 )
+        const __m128 g = _mm_set1_ps( gain );
+        for( ; i + 4 <= size; i += 4 )
+        {
+            _mm_storeu_ps( output + i, _mm_mul_ps( g, _mm_loadu_ps( input + i ) ) );
+        }
+#elif ( SOFA_SIMD_NEON == 1 )
+        for( ; i + 4 <= size; i += 4 )
+        {
+            vst1q_f32( output + i, vmulq_n_f32( vld1q_f32( input + i ), gain ) );
+        }
+#endif
+
+        for( ; i < size; i++ )
+        {
+            output[i] = gain * input[i];
+        }
+    }
+
+    /// output += gain * input
+    static void multiplyAdd(float *output,
+                            const float *input,
+                            const float gain,
+                            const std::size_t size) SOFA_NOEXCEPT
+    {
+        std::size_t i = 0;
+
+#if ( SOFA_SIMD_AVX == 1 )
+        const __m256 g = _mm256_set1_ps( gain );
+        for( ; i + 8 <= size; i += 8 )
+        {
+            const __m256 product = _mm256_mul_ps( g, _mm256_loadu_ps( input + i ) );
+            _mm256_storeu_ps( output + i, _mm256_add_ps( _mm256_loadu_ps( output + i ), product ) );
+        }
+#elif ( SOFA_SIMD_SSE2 == 1 )
+        const __m128 g = _mm_set1_ps( gain );
+        for( ; i + 4 <= size; i += 4 )
+        {
+            const __m128 product = _mm_mul_ps( g, _mm_loadu_ps( input + i ) );
+            _mm_storeu_ps( output + i, _mm_add_ps( _mm_loadu_ps( output + i ), product ) );
+        }
+#elif ( SOFA_SIMD_NEON == 1 )
+        for( ; i + 4 <= size; i += 4 )
+        {
+            const float32x4_t product = vmulq_n_f32( vld1q_f32( input + i ), gain );
+            vst1q_f32( output + i, vaddq_f32( vld1q_f32( output + i ), product ) );
+        }
+#endif
+
+        for( ; i < size; i++ )
+        {
+            output[i] += gain * input[i];
+        }
+    }
+
+    /// in place Cholesky factorization of a symmetric positive definite matrix [ size size ] (lower part)
+    static bool cholesky(std::vector< double > &matrix, const std::size_t size)
+    {
+        for( std::size_t j = 0; j < size; j++ )
+        {
+            double pivot = matrix[ j * size + j ];
+
+            for( std::size_t k = 0; k < j; k++ )
+            {
+                pivot -= matrix[ j * size + k ] * matrix[ j * size + k ];
+            }
+
+            if( pivot <= 0.0 )
+            {
+                return false;
+            }
+
+            pivot = std::sqrt( pivot );
+            matrix[ j * size + j ] = pivot;
+
+            for( std::size_t i = j + 1; i < size; i++ )
+            {
+                double value = matrix[ i * size + j ];
+
+                for( std::size_t k = 0; k < j; k++ )
+                {
+                    value -= matrix[ i * size + k ] * matrix[ j * size + k ];
+                }
+
+                matrix[ i * size + j ] = value / pivot;
+            }
+        }
+
+        return true;
+    }
+
+    /// solves L L^T X = B in place, for the numColumns columns of B [ size numColumns ]
+    static void choleskySolve(double *rhs,
+                              const std::vector< double > &factor,
+                              const std::size_t size,
+                              const std::size_t numColumns)
+    {
+        /// forward substitution : L Z = B
+        for( std::size_t i = 0; i < size; i++ )
+        {
+            double *row = rhs + i * numColumns;
+
+            for( std::size_t k = 0; k < i; k++ )
+            {
+                const double l = factor[ i * size + k ];
+                const double *other = rhs + k * numColumns;
+
+                for( std::size_t c = 0; c < numColumns; c++ )
+                {
+                    row[c] -= l * other[c];
+                }
+            }
+
+            const double inverse = 1.0 / factor[ i * size + i ];
+
+            for( std::size_t c = 0; c < numColumns; c++ )
+            {
+                row[c] *= inverse;
+            }
+        }
+
+        /// backward substitution : L^T X = Z
+        for( std::size_t i = size; i-- > 0; )
+        {
+            double *row = rhs + i * numColumns;
+
+            for( std::size_t k = i + 1; k < size; k++ )
+            {
+                const double l = factor[ k * size + i ];
+                const double *other = rhs + k * numColumns;
+
+                for( std::size_t c = 0; c < numColumns; c++ )
+                {
+                    row[c] -= l * other[c];
+                }
+            }
+
+            const double inverse = 1.0 / factor[ i * size + i ];
+
+            for( std::size_t c = 0; c < numColumns; c++ )
+            {
+                row[c] *= inverse;
+            }
+        }
+    }
+
+    /// least squares fit : returns the coefficients [ K numColumns ] of the data [ M numColumns ]
+    static void fit(std::vector< double > &coefficients,
+                    const std::vector< double > &basis,
+                    const std::vector< double > &factor,
+                    const double *data,
+                    const std::size_t numMeasurements,
+                    const std::size_t numCoefficients,
+                    const std::size_t numColumns)
+    {
+        /// right hand side : Y^T H
+        coefficients.assign( numCoefficients * numColumns, 0.0 );
+
+        for( std::size_t m = 0; m < numMeasurements; m++ )
+        {
+            const double *values = data + m * numColumns;
+
+            for( std::size_t k = 0; k < numCoefficients; k++ )
+            {
+                const double y = basis[ m * numCoefficients + k ];
+                double *row = &coefficients[ k * numColumns ];
+
+                for( std::size_t c = 0; c < numColumns; c++ )
+                {
+                    row[c] += y * values[c];
+                }
+            }
+        }
+
+        choleskySolve( &coefficients[0], factor, numCoefficients, numColumns );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Default options : order 8, light regularization
+ *
+ */
+/************************************************************************************/
+SphericalHarmonicHRIR::Options::Options()
+: order( 8 )
+, regularization( 1e-6 )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of spherical harmonics up to a given order, i.e. (order+1)^2
+ *
+ */
+/************************************************************************************/
+std::size_t SphericalHarmonicHRIR::GetNumCoefficients(const unsigned int order) SOFA_NOEXCEPT
+{
+    return (std::size_t) ( order + 1 ) * (std::size_t) ( order + 1 );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes the real spherical harmonics of a direction
+ *  @param[out]     values : the (order+1)^2 functions, in ACN order (index n^2 + n + m).
+ *                  The array must be allocated large enough
+ *  @param[in]      order : maximum order
+ *  @param[in]      azimuth : in degree
+ *  @param[in]      elevation : in degree
+ *
+ *  @details        The functions are orthonormal on the sphere (N3D normalization divided by
+ *                  sqrt(4 pi)), without the Condon-Shortley phase. The associated Legendre
+ *                  functions are computed with normalized recurrences, which are stable
+ *                  at high orders. This method does not allocate memory
+ */
+/************************************************************************************/
+void SphericalHarmonicHRIR::EvaluateBasis(double *values,
+                                          const unsigned int order,
+                                          const double azimuth,
+                                          const double elevation) SOFA_NOEXCEPT
+{
+    const double pi = 3.14159265358979323846;
+
+    /// cosine and sine of the colatitude
+    const double cosTheta   = std::sin( sofa::DegreesToRadians( elevation ) );
+    const double sinTheta   = std::cos( sofa::DegreesToRadians( elevation ) );
+
+    const double cosPhi     = std::cos( sofa::DegreesToRadians( azimuth ) );
+    const double sinPhi     = std::sin( sofa::DegreesToRadians( azimuth ) );
+
+    const double sqrt2      = std::sqrt( 2.0 );
+
+    double pmm      = std::sqrt( 1.0 / ( 4.0 * pi ) );
+    double cosMPhi  = 1.0;
+    double sinMPhi  = 0.0;
+
+    for( unsigned int m = 0; m <= order; m++ )
+    {
+        if( m > 0 )
+        {
+            pmm *= std::sqrt( ( 2.0 * m + 1.0 ) / ( 2.0 * m ) ) * sinTheta;
+
+            const double c = cosMPhi * cosPhi - sinMPhi * sinPhi;
+            sinMPhi = sinMPhi * cosPhi + cosMPhi * sinPhi;
+            cosMPhi = c;
+        }
+
+        /// P(n-2, m), P(n-1, m) and P(n, m)
+        double p2 = 0.0;
+        double p1 = 0.0;
+        double p  = pmm;
+
+        for( unsigned int n = m; n <= order; n++ )
+        {
+            if( n == m + 1 )
+            {
+                p = std::sqrt( 2.0 * m + 3.0 ) * cosTheta * p1;
+            }
+            else if( n > m + 1 )
+            {
+                const double n2 = (double) n * n;
+                const double m2 = (double) m * m;
+                const double a  = std::sqrt( ( 4.0 * n2 - 1.0 ) / ( n2 - m2 ) );
+                const double b  = std::sqrt( ( ( n - 1.0 ) * ( n - 1.0 ) - m2 ) / ( 4.0 * ( n - 1.0 ) * ( n - 1.0 ) - 1.0 ) );
+
+                p = a * ( cosTheta * p1 - b * p2 );
+            }
+
+            const std::size_t acn = (std::size_t) n * n + n;
+
+            if( m == 0 )
+            {
+                values[ acn ] = p;
+            }
+            else
+            {
+                values[ acn + m ] = sqrt2 * p * cosMPhi;
+                values[ acn - m ] = sqrt2 * p * sinMPhi;
+            }
+
+            p2 = p1;
+            p1 = p;
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes the spherical harmonic transform of a SimpleFreeFieldHRIR file
+ *  @param[in]      file : a valid SimpleFreeFieldHRIR file
+ *  @param[in]      options : order and regularization
+ *
+ *  @details        Throws an exception if the data can not be read, or if the least squares
+ *                  problem is singular (too few measurements for the order, without regularization)
+ */
+/************************************************************************************/
+SphericalHarmonicHRIR::SphericalHarmonicHRIR(const sofa::SimpleFreeFieldHRIR &file,
+                                             const Options &options)
+: order( 0 )
+, numCoefficients( 0 )
+, numReceivers( 0 )
+, numDataSamples( 0 )
+, coefficients()
+, delayCoefficients()
+, fitError( 0.0 )
+{
+    const std::size_t numMeasurements = (std::size_t) file.GetNumMeasurements();
+    numReceivers    = (std::size_t) file.GetNumReceivers();
+    numDataSamples  = (std::size_t) file.GetNumDataSamples();
+
+    sofa::Coordinates::Type coordinates;
+    sofa::Units::Type units;
+
+    if( file.GetSourcePosition( coordinates, units ) == false )
+    {
+        SOFA_THROW( "invalid 'SourcePosition' variable" );
+    }
+
+    std::vector< double > positions;
+
+    if( file.GetSourcePosition( positions ) == false || positions.size() != 3 * numMeasurements )
+    {
+        SOFA_THROW( "invalid 'SourcePosition' dimensions" );
+    }
+
+    std::vector< double > impulseResponses;
+
+    if( file.GetDataIR( impulseResponses ) == false
+       || impulseResponses.size() != numMeasurements * numReceivers * numDataSamples )
+    {
+        SOFA_THROW( "invalid 'Data.IR' variable" );
+    }
+
+    std::vector< double > fileDelays;
+
+    if( file.GetDataDelay( fileDelays ) == false )
+    {
+        SOFA_THROW( "invalid 'Data.Delay' variable" );
+    }
+
+    /// Data.Delay is [ I R ] or [ M R ]
+    std::vector< double > delays( numMeasurements * numReceivers );
+
+    if( fileDelays.size() == numMeasurements * numReceivers )
+    {
+        delays = fileDelays;
+    }
+    else if( fileDelays.size() == numReceivers )
+    {
+        for( std::size_t i = 0; i < delays.size(); i++ )
+        {
+            delays[i] = fileDelays[ i % numReceivers ];
+        }
+    }
+    else
+    {
+        SOFA_THROW( "invalid 'Data.Delay' dimensions" );
+    }
+
+    initialize( positions.empty() == false ? &positions[0] : NULL,
+                coordinates,
+                impulseResponses.empty() == false ? &impulseResponses[0] : NULL,
+                delays.empty() == false ? &delays[0] : NULL,
+                numMeasurements,
+                options );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Computes the spherical harmonic transform of an array of impulse responses
+ *  @param[in]      positions : interleaved source positions [ M C ]
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @param[in]      impulseResponses : [ M R N ]
+ *  @param[in]      delays : onset delays, in samples [ M R ], or NULL
+ *  @param[in]      numMeasurements : M
+ *  @param[in]      numReceivers : R
+ *  @param[in]      numDataSamples : N
+ *  @param[in]      options : order and regularization
+ *
+ */
+/************************************************************************************/
+SphericalHarmonicHRIR::SphericalHarmonicHRIR(const double *positions,
+                                             const sofa::Coordinates::Type coordinates,
+                                             const double *impulseResponses,
+                                             const double *delays,
+                                             const std::size_t numMeasurements,
+                                             const std::size_t numReceivers_,
+                                             const std::size_t numDataSamples_,
+                                             const Options &options)
+: order( 0 )
+, numCoefficients( 0 )
+, numReceivers( numReceivers_ )
+, numDataSamples( numDataSamples_ )
+, coefficients()
+, delayCoefficients()
+, fitError( 0.0 )
+{
+    initialize( positions, coordinates, impulseResponses, delays, numMeasurements, options );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor
+ *
+ */
+/************************************************************************************/
+SphericalHarmonicHRIR::~SphericalHarmonicHRIR()
+{
+}
+
+void SphericalHarmonicHRIR::initialize(const double *positions,
+                                       const sofa::Coordinates::Type coordinates,
+                                       const double *impulseResponses,
+                                       const double *delays,
+                                       const std::size_t numMeasurements,
+                                       const Options &options)
+{
+    if( options.order > kMaxOrder )
+    {
+        SOFA_THROW( "invalid order (too high)" );
+    }
+
+    if( ( options.regularization >= 0.0 ) == false )
+    {
+        SOFA_THROW( "invalid regularization (should be positive)" );
+    }
+
+    if( coordinates != sofa::Coordinates::kCartesian && coordinates != sofa::Coordinates::kSpherical )
+    {
+        SOFA_THROW( "invalid coordinates (should be cartesian or spherical)" );
+    }
+
+    if( numMeasurements == 0 )
+    {
+        SOFA_THROW( "no measurement" );
+    }
+
+    order           = options.order;
+    numCoefficients = GetNumCoefficients( order );
+
+    const std::size_t K         = numCoefficients;
+    const std::size_t numValues = numReceivers * numDataSamples;
+
+    /// the functions at the measured directions [ M K ]
+    std::vector< double > basis( numMeasurements * K );
+
+    for( std::size_t m = 0; m < numMeasurements; m++ )
+    {
+        double azimuth   = positions[ 3 * m + 0 ];
+        double elevation = positions[ 3 * m + 1 ];
+
+        if( coordinates == sofa::Coordinates::kCartesian )
+        {
+            const double x = positions[ 3 * m + 0 ];
+            const double y = positions[ 3 * m + 1 ];
+            const double z = positions[ 3 * m + 2 ];
+
+            azimuth     = sofa::RadiansToDegrees( std::atan2( y, x ) );
+            elevation   = sofa::RadiansToDegrees( std::atan2( z, std::sqrt( x * x + y * y ) ) );
+        }
+
+        EvaluateBasis( &basis[ m * K ], order, azimuth, elevation );
+    }
+
+    /// normal equations : Y^T Y + lambda I
+    std::vector< double > normal( K * K, 0.0 );
+
+    for( std::size_t m = 0; m < numMeasurements; m++ )
+    {
+        const double *y = &basis[ m * K ];
+
+        for( std::size_t i = 0; i < K; i++ )
+        {
+            for( std::size_t j = 0; j <= i; j++ )
+            {
+                normal[ i * K + j ] += y[i] * y[j];
+            }
+        }
+    }
+
+    double trace = 0.0;
+    for( std::size_t i = 0; i < K; i++ )
+    {
+        trace += normal[ i * K + i ];
+    }
+
+    const double lambda = options.regularization * trace / (double) K;
+
+    for( std::size_t i = 0; i < K; i++ )
+    {
+        normal[ i * K + i ] += lambda;
+    }
+
+    if( sofaLocal::cholesky( normal, K ) == false )
+    {
+        SOFA_THROW( "too few measurements for the order (use a lower order or a regularization)" );
+    }
+
+    std::vector< double > solution;
+
+    if( numValues > 0 )
+    {
+        sofaLocal::fit( solution, basis, normal, impulseResponses, numMeasurements, K, numValues );
+    }
+
+    coefficients.resize( solution.size() );
+
+    for( std::size_t i = 0; i < solution.size(); i++ )
+    {
+        coefficients[i] = (float) solution[i];
+    }
+
+    if( delays != NULL && numReceivers > 0 )
+    {
+        sofaLocal::fit( delayCoefficients, basis, normal, delays, numMeasurements, K, numReceivers );
+    }
+    else
+    {
+        delayCoefficients.assign( K * numReceivers, 0.0 );
+    }
+
+    /// error of the (single precision) expansion at the measured directions
+    double error    = 0.0;
+    double energy   = 0.0;
+
+    std::vector< double > synthesis( numValues );
+
+    for( std::size_t m = 0; m < numMeasurements && numValues > 0; m++ )
+    {
+        std::fill( synthesis.begin(), synthesis.end(), 0.0 );
+
+        for( std::size_t k = 0; k < K; k++ )
+        {
+            const double y = basis[ m * K + k ];
+            const float *row = &coefficients[ k * numValues ];
+
+            for( std::size_t i = 0; i < numValues; i++ )
+            {
+                synthesis[i] += y * (double) row[i];
+            }
+        }
+
+        const double *measured = impulseResponses + m * numValues;
+
+        for( std::size_t i = 0; i < numValues; i++ )
+        {
+            error   += ( synthesis[i] - measured[i] ) * ( synthesis[i] - measured[i] );
+            energy  += measured[i] * measured[i];
+        }
+    }
+
+    fitError = ( energy > 0.0 ) ? std::sqrt( error / energy ) : 0.0;
+}
+
+unsigned int SphericalHarmonicHRIR::GetOrder() const SOFA_NOEXCEPT
+{
+    return order;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the number of spherical harmonics, i.e. (order+1)^2
+ *
+ */
+/************************************************************************************/
+std::size_t SphericalHarmonicHRIR::GetNumCoefficients() const SOFA_NOEXCEPT
+{
+    return numCoefficients;
+}
+
+std::size_t SphericalHarmonicHRIR::GetNumReceivers() const SOFA_NOEXCEPT
+{
+    return numReceivers;
+}
+
+std::size_t SphericalHarmonicHRIR::GetNumDataSamples() const SOFA_NOEXCEPT
+{
+    return numDataSamples;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the size of the coefficients, in bytes
+ *
+ */
+/************************************************************************************/
+std::size_t SphericalHarmonicHRIR::GetMemorySize() const SOFA_NOEXCEPT
+{
+    return coefficients.size() * sizeof( float ) + delayCoefficients.size() * sizeof( double );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the relative RMS error of the expansion at the measured directions
+ *                  (0 for an exact fit)
+ *
+ */
+/************************************************************************************/
+double SphericalHarmonicHRIR::GetFitError() const SOFA_NOEXCEPT
+{
+    return fitError;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Returns the coefficients of the impulse responses [ K R N ]
+ *
+ */
+/************************************************************************************/
+const float * SphericalHarmonicHRIR::GetCoefficients() const SOFA_NOEXCEPT
+{
+    return coefficients.empty() == false ? &coefficients[0] : NULL;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Synthesises the HRIR of one direction
+ *  @param[out]     values : impulse responses [ R N ].
+ *                  The array must be allocated large enough (R x N)
+ *  @param[out]     delays : onset delays, in samples [ R ].
+ *                  The array must be allocated large enough (R), or NULL
+ *  @param[in]      c1 : x or azimuth (degree)
+ *  @param[in]      c2 : y or elevation (degree)
+ *  @param[in]      c3 : z or radius (ignored in spherical coordinates)
+ *  @param[in]      coordinates : kCartesian or kSpherical
+ *  @return         false if the direction is undefined
+ *
+ *  @details        This method does not allocate memory
+ */
+/************************************************************************************/
+bool SphericalHarmonicHRIR::GetHRIR(float *values,
+                                    float *delays,
+                                    const double c1,
+                                    const double c2,
+                                    const double c3,
+                                    const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT
+{
+    double azimuth   = c1;
+    double elevation = c2;
+
+    if( coordinates == sofa::Coordinates::kCartesian )
+    {
+        const double rho = std::sqrt( c1 * c1 + c2 * c2 );
+
+        if( rho <= 0.0 && c3 == 0.0 )
+        {
+            return false;
+        }
+
+        azimuth     = sofa::RadiansToDegrees( std::atan2( c2, c1 ) );
+        elevation   = sofa::RadiansToDegrees( std::atan2( c3, rho ) );
+    }
+    else if( coordinates != sofa::Coordinates::kSpherical )
+    {
+        return false;
+    }
+
+    double basis[ sofaLocal::maxNumCoefficients ];
+    EvaluateBasis( basis, order, azimuth, elevation );
+
+    const std::size_t numValues = numReceivers * numDataSamples;
+
+    if( values != NULL && numValues > 0 )
+    {
+        sofaLocal::multiply( values, &coefficients[0], (float) basis[0], numValues );
+
+        for( std::size_t k = 1; k < numCoefficients; k++ )
+        {
+            sofaLocal::multiplyAdd( values, &coefficients[ k * numValues ], (float) basis[k], numValues );
+        }
+    }
+
+    if( delays != NULL )
+    {
+        for( std::size_t r = 0; r < numReceivers; r++ )
+        {
+            double delay = 0.0;
+
+            for( std::size_t k = 0; k < numCoefficients; k++ )
+            {
+                delay += basis[k] * delayCoefficients[ k * numReceivers + r ];
+            }
+
+            delays[r] = (float) delay;
+        }
+    }
+
+    return true;
+}
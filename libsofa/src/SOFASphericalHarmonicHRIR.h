@@ -0,0 +1,169 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFASphericalHarmonicHRIR.h
+ *   @brief      Spherical harmonic representation of HRIRs, evaluated for any direction
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_SPHERICAL_HARMONIC_HRIR_H__
+#define _SOFA_SPHERICAL_HARMONIC_HRIR_H__
+
+#include "../src/SOFACoordinates.h"
+#include <vector>
+#include <cstddef>
+
+namespace sofa
+{
+    class SimpleFreeFieldHRIR;
+
+    /************************************************************************************/
+    /*!
+     *  @class          SphericalHarmonicHRIR
+     *  @brief          Spherical harmonic transform of the Data.IR impulse responses [ M R N ]
+     *
+     *  @details        Each time sample of each receiver is expanded on the real spherical
+     *                  harmonics up to a given order L, i.e. K = (L+1)^2 functions (orthonormal,
+     *                  ACN ordering, without the Condon-Shortley phase). The coefficients are the
+     *                  (Tikhonov-regularized) least squares fit of the M measured directions
+     *                  (SourcePosition); the onset delays (Data.Delay) are fitted in the same way.
+     *
+     *                  The coefficients [ K R N ] are stored in single precision : the memory does
+     *                  not depend on M any more, and the impulse responses can be synthesised for
+     *                  any direction, with smooth variations between the measured ones.
+     *                  The transform being linear, the HRTF of a direction is the Fourier transform
+     *                  of its synthesised HRIR.
+     *
+     *                  As for any interpolation of impulse responses, a low order represents
+     *                  time-aligned (e.g. MinimumPhaseHRIR) responses much better than raw ones.
+     *                  GetFitError() measures the error at the measured directions.
+     *
+     *                  The synthesis is const, does not allocate memory and does not access the
+     *                  file, so it can be called from an audio callback (and from several threads).
+     *                  It uses the SIMD instructions of the host (AVX, SSE2 or NEON).
+     *                  Only the direction of the source is taken into account, not its distance.
+     */
+    /************************************************************************************/
+    class SOFA_API SphericalHarmonicHRIR
+    {
+    public:
+        static const unsigned int kMaxOrder = 32;
+
+        /// parameters of the transform
+        struct Options
+        {
+            Options();
+
+            unsigned int order;                 ///< order L of the expansion, at most kMaxOrder (default 8)
+            double regularization;              ///< Tikhonov factor, relative to the mean energy of the functions (default 1e-6)
+        };
+
+    public:
+        static std::size_t GetNumCoefficients(const unsigned int order) SOFA_NOEXCEPT;
+
+        static void EvaluateBasis(double *values,
+                                  const unsigned int order,
+                                  const double azimuth,
+                                  const double elevation) SOFA_NOEXCEPT;
+
+    public:
+        SphericalHarmonicHRIR(const sofa::SimpleFreeFieldHRIR &file,
+                              const Options &options = Options());
+
+        SphericalHarmonicHRIR(const double *positions,
+                              const sofa::Coordinates::Type coordinates,
+                              const double *impulseResponses,
+                              const double *delays,
+                              const std::size_t numMeasurements,
+                              const std::size_t numReceivers,
+                              const std::size_t numDataSamples,
+                              const Options &options = Options());
+
+        ~SphericalHarmonicHRIR();
+
+        unsigned int GetOrder() const SOFA_NOEXCEPT;
+        std::size_t GetNumCoefficients() const SOFA_NOEXCEPT;
+        std::size_t GetNumReceivers() const SOFA_NOEXCEPT;
+        std::size_t GetNumDataSamples() const SOFA_NOEXCEPT;
+
+        std::size_t GetMemorySize() const SOFA_NOEXCEPT;
+
+        double GetFitError() const SOFA_NOEXCEPT;
+
+        const float * GetCoefficients() const SOFA_NOEXCEPT;
+
+        bool GetHRIR(float *values,
+                     float *delays,
+                     const double c1,
+                     const double c2,
+                     const double c3,
+                     const sofa::Coordinates::Type coordinates) const SOFA_NOEXCEPT;
+
+    private:
+        //==============================================================================
+        void initialize(const double *positions,
+                        const sofa::Coordinates::Type coordinates,
+                        const double *impulseResponses,
+                        const double *delays,
+                        const std::size_t numMeasurements,
+                        const Options &options);
+
+    private:
+        //==============================================================================
+        unsigned int order;                         ///< L
+        std::size_t numCoefficients;                ///< K = (L+1)^2
+        std::size_t numReceivers;                   ///< R
+        std::size_t numDataSamples;                 ///< N
+
+        std::vector< float > coefficients;          ///< impulse responses [ K R N ]
+        std::vector< double > delayCoefficients;    ///< onset delays [ K R ]
+        double fitError;                            ///< relative RMS error at the measured directions
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( SphericalHarmonicHRIR );
+    };
+
+}
+
+#endif /* _SOFA_SPHERICAL_HARMONIC_HRIR_H__ */
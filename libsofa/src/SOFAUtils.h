@@ -110,6 +110,57 @@ namespace sofa
         return ( a > b ) ? a : b;
     }
     
+    /************************************************************************************/
+    /*!
+     *  @brief          Converts an angle from degrees to radians
+     *  @param[in]      x : angle in degrees
+     *  @return         angle in radians
+     *
+     */
+    /************************************************************************************/
+    inline double DegreesToRadians(const double x) SOFA_NOEXCEPT
+    {
+        return x * 0.017453292519943295769;
+    }
+    
+    /************************************************************************************/
+    /*!
+     *  @brief          Converts an angle from radians to degrees
+     *  @param[in]      x : angle in radians
+     *  @return         angle in degrees
+     *
+     */
+    /************************************************************************************/
+    inline double RadiansToDegrees(const double x) SOFA_NOEXCEPT
+    {
+        return x * 57.295779513082320877;
+    }
+    
+    /************************************************************************************/
+    /*!
+     *  @brief          Converts spherical coordinates to cartesian coordinates
+     *  @param[out]     cartesian : [ x y z ]
+     *  @param[in]      azimuth : azimuth in degrees
+     *  @param[in]      elevation : elevation in degrees
+     *  @param[in]      radius : radius
+     *
+     *  @details        Follows the SOFA conventions : azimuth is measured counterclockwise
+     *                  from the x axis, elevation upwards from the horizontal plane
+     */
+    /************************************************************************************/
+    inline void SphericalToCartesian(double cartesian[3],
+                                     const double azimuth,
+                                     const double elevation,
+                                     const double radius) SOFA_NOEXCEPT
+    {
+        const double az = sofa::DegreesToRadians( azimuth );
+        const double el = sofa::DegreesToRadians( elevation );
+        
+        cartesian[0] = radius * std::cos( el ) * std::cos( az );
+        cartesian[1] = radius * std::cos( el ) * std::sin( az );
+        cartesian[2] = radius * std::sin( el );
+    }
+    
 }
 
 #endif /* _SOFA_UTILS_H__ */ 
@@ -0,0 +1,631 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAWriter.cpp
+ *   @brief      Writes a SOFA file, one measurement at a time
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFAWriter.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFADate.h"
+#include "../src/SOFAGeneralFIR.h"
+#include "../src/SOFASimpleFreeFieldHRIR.h"
+#include "../src/SOFASimpleHeadphoneIR.h"
+#include <netcdf.h>
+#include <vector>
+#include <mutex>
+
+using namespace sofa;
+
+namespace sofaLocal
+{
+    typedef std::lock_guard< std::recursive_mutex > LibraryLock;
+
+    static void checkStatus(const int status, const std::string &what)
+    {
+        if( status != NC_NOERR )
+        {
+            SOFA_THROW( what + " : " + std::string( nc_strerror( status ) ) );
+        }
+    }
+
+    static void putText(const int ncid, const int varid, const std::string &name, const std::string &value)
+    {
+        const int status = nc_put_att_text( ncid, varid, name.c_str(), value.size(), value.c_str() );
+
+        checkStatus( status, "cannot write attribute '" + name + "'" );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Default options : one measurement per chunk, no compression
+ *
+ */
+/************************************************************************************/
+Writer::Options::Options()
+: chunkMeasurements( 1 )
+, deflateLevel( 0 )
+, shuffle( false )
+{
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class constructor : creates the file
+ *  @param[in]      path : path of the file. It shall not exist beforehand
+ *  @param[in]      convention : kSimpleFreeFieldHRIR, kSimpleHeadphoneIR or kGeneralFIR
+ *  @param[in]      numReceivers : number of receivers (R)
+ *  @param[in]      numDataSamples : length of the impulse responses (N)
+ *  @param[in]      samplingRate : sampling rate, in hertz
+ *  @param[in]      options : storage of the measurements
+ *
+ *  @details        Throws an exception if the file can not be created
+ */
+/************************************************************************************/
+Writer::Writer(const std::string &path,
+               const sofa::File::ConventionFlag convention,
+               const std::size_t numReceivers_,
+               const std::size_t numDataSamples_,
+               const double samplingRate,
+               const Options &options_)
+: options( options_ )
+, ncid( -1 )
+, varDataIR( -1 )
+, varDataDelay( -1 )
+, varSourcePosition( -1 )
+, numMeasurements( 0 )
+, numReceivers( numReceivers_ )
+, numEmitters( 1 )
+, numDataSamples( numDataSamples_ )
+{
+    if( convention != sofa::File::kSimpleFreeFieldHRIR
+       && convention != sofa::File::kSimpleHeadphoneIR
+       && convention != sofa::File::kGeneralFIR )
+    {
+        SOFA_THROW( "unsupported convention" );
+    }
+
+    if( numReceivers == 0 || numDataSamples == 0 )
+    {
+        SOFA_THROW( "invalid SOFA dimension(s)" );
+    }
+
+    if( options.chunkMeasurements == 0 )
+    {
+        SOFA_THROW( "invalid chunk size" );
+    }
+
+    if( options.deflateLevel < 0 || options.deflateLevel > 9 )
+    {
+        SOFA_THROW( "invalid deflate level (should be between 0 and 9)" );
+    }
+
+    if( convention == sofa::File::kSimpleHeadphoneIR )
+    {
+        /// one-to-one correspondence between emitters and receivers
+        numEmitters = numReceivers;
+    }
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    const int status = nc_create( path.c_str(), NC_NETCDF4 | NC_NOCLOBBER, &ncid );
+
+    if( status != NC_NOERR )
+    {
+        ncid = -1;
+        SOFA_THROW( "cannot create file : " + path + " (" + std::string( nc_strerror( status ) ) + ")" );
+    }
+
+    try
+    {
+        createFile( path, convention, samplingRate );
+    }
+    catch( ... )
+    {
+        nc_close( ncid );
+        ncid = -1;
+        throw;
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Class destructor : closes the file (the errors are ignored, call Close() to get them)
+ *
+ */
+/************************************************************************************/
+Writer::~Writer()
+{
+    if( ncid >= 0 )
+    {
+        const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+        nc_close( ncid );
+    }
+}
+
+/// defines the dimensions, attributes and variables (the library mutex is held by the caller)
+void Writer::createFile(const std::string &path,
+                        const sofa::File::ConventionFlag convention,
+                        const double samplingRate)
+{
+    //==============================================================================
+    /// global attributes
+    sofa::Attributes attributes;
+    attributes.ResetToDefault();
+
+    attributes.Set( sofa::Attributes::kDateCreated, sofa::Date::GetCurrentDate().ToISO8601() );
+    attributes.Set( sofa::Attributes::kDateModified, sofa::Date::GetCurrentDate().ToISO8601() );
+
+    std::vector< std::string > conventionAttributes;
+
+    if( convention == sofa::File::kSimpleFreeFieldHRIR )
+    {
+        attributes.Set( sofa::Attributes::kSOFAConventions, "SimpleFreeFieldHRIR" );
+        attributes.Set( sofa::Attributes::kSOFAConventionsVersion, sofa::SimpleFreeFieldHRIR::GetConventionVersion() );
+
+        conventionAttributes.push_back( "DatabaseName" );
+    }
+    else if( convention == sofa::File::kSimpleHeadphoneIR )
+    {
+        attributes.Set( sofa::Attributes::kSOFAConventions, "SimpleHeadphoneIR" );
+        attributes.Set( sofa::Attributes::kSOFAConventionsVersion, sofa::SimpleHeadphoneIR::GetConventionVersion() );
+
+        conventionAttributes.push_back( "DatabaseName" );
+        conventionAttributes.push_back( "SourceModel" );
+        conventionAttributes.push_back( "SourceManufacturer" );
+        conventionAttributes.push_back( "SourceURI" );
+    }
+    else
+    {
+        attributes.Set( sofa::Attributes::kSOFAConventions, "GeneralFIR" );
+        attributes.Set( sofa::Attributes::kSOFAConventionsVersion, sofa::GeneralFIR::GetConventionVersion() );
+    }
+
+    for( unsigned int k = 0; k < sofa::Attributes::kNumAttributes; k++ )
+    {
+        const sofa::Attributes::Type attType = static_cast< sofa::Attributes::Type >( k );
+
+        sofaLocal::putText( ncid, NC_GLOBAL, sofa::Attributes::GetName( attType ), attributes.Get( attType ) );
+    }
+
+    for( std::size_t i = 0; i < conventionAttributes.size(); i++ )
+    {
+        sofaLocal::putText( ncid, NC_GLOBAL, conventionAttributes[ i ], "" );
+    }
+
+    //==============================================================================
+    /// dimensions
+    int dimI = -1, dimC = -1, dimM = -1, dimR = -1, dimE = -1, dimN = -1;
+
+    sofaLocal::checkStatus( nc_def_dim( ncid, "I", 1, &dimI ), "cannot define dimension 'I'" );
+    sofaLocal::checkStatus( nc_def_dim( ncid, "C", 3, &dimC ), "cannot define dimension 'C'" );
+    sofaLocal::checkStatus( nc_def_dim( ncid, "M", NC_UNLIMITED, &dimM ), "cannot define dimension 'M'" );
+    sofaLocal::checkStatus( nc_def_dim( ncid, "R", numReceivers, &dimR ), "cannot define dimension 'R'" );
+    sofaLocal::checkStatus( nc_def_dim( ncid, "E", numEmitters, &dimE ), "cannot define dimension 'E'" );
+    sofaLocal::checkStatus( nc_def_dim( ncid, "N", numDataSamples, &dimN ), "cannot define dimension 'N'" );
+
+    //==============================================================================
+    /// variables
+    const int varListenerPosition = defineVariable( "ListenerPosition", dimI, dimC );
+    sofaLocal::putText( ncid, varListenerPosition, "Type", "cartesian" );
+    sofaLocal::putText( ncid, varListenerPosition, "Units", "meter" );
+
+    defineVariable( "ListenerUp", dimI, dimC );
+
+    const int varListenerView = defineVariable( "ListenerView", dimI, dimC );
+    sofaLocal::putText( ncid, varListenerView, "Type", "cartesian" );
+    sofaLocal::putText( ncid, varListenerView, "Units", "meter" );
+
+    const int varReceiverPosition = defineVariable( "ReceiverPosition", dimR, dimC, dimI );
+    sofaLocal::putText( ncid, varReceiverPosition, "Type", "cartesian" );
+    sofaLocal::putText( ncid, varReceiverPosition, "Units", "meter" );
+
+    const int varEmitterPosition = defineVariable( "EmitterPosition", dimE, dimC, dimI );
+    sofaLocal::putText( ncid, varEmitterPosition, "Type", "cartesian" );
+    sofaLocal::putText( ncid, varEmitterPosition, "Units", "meter" );
+
+    varSourcePosition = defineVariable( "SourcePosition", dimM, dimC );
+    if( convention == sofa::File::kSimpleFreeFieldHRIR )
+    {
+        sofaLocal::putText( ncid, varSourcePosition, "Type", "spherical" );
+        sofaLocal::putText( ncid, varSourcePosition, "Units", "degree, degree, meter" );
+    }
+    else
+    {
+        sofaLocal::putText( ncid, varSourcePosition, "Type", "cartesian" );
+        sofaLocal::putText( ncid, varSourcePosition, "Units", "meter" );
+    }
+
+    const int varSamplingRate = defineVariable( "Data.SamplingRate", dimI, -1 );
+    sofaLocal::putText( ncid, varSamplingRate, "Units", "hertz" );
+
+    varDataDelay    = defineVariable( "Data.Delay", dimM, dimR );
+    varDataIR       = defineVariable( "Data.IR", dimM, dimR, dimN );
+
+    sofaLocal::checkStatus( nc_enddef( ncid ), "cannot create file : " + path );
+
+    //==============================================================================
+    /// values which do not depend on the measurements
+    sofaLocal::checkStatus( nc_put_var_double( ncid, varSamplingRate, &samplingRate ), "cannot write 'Data.SamplingRate'" );
+
+    const double zero[3]    = { 0.0, 0.0, 0.0 };
+    const double up[3]      = { 0.0, 0.0, 1.0 };
+    const double view[3]    = { 1.0, 0.0, 0.0 };
+
+    putPosition( "ListenerPosition", 0, zero );
+    putPosition( "ListenerUp", 0, up );
+    putPosition( "ListenerView", 0, view );
+
+    for( std::size_t r = 0; r < numReceivers; r++ )
+    {
+        putPosition( "ReceiverPosition", r, zero );
+    }
+
+    for( std::size_t e = 0; e < numEmitters; e++ )
+    {
+        putPosition( "EmitterPosition", e, zero );
+    }
+}
+
+/// defines a double variable, with 1, 2 or 3 dimensions (-1 for the unused ones).
+/// The variables along M are chunked and compressed according to the options
+int Writer::defineVariable(const std::string &name, const int dim1, const int dim2, const int dim3)
+{
+    int dimIds[3] = { dim1, dim2, dim3 };
+    const int numDims = ( dim2 < 0 ) ? 1 : ( ( dim3 < 0 ) ? 2 : 3 );
+
+    int varid = -1;
+    sofaLocal::checkStatus( nc_def_var( ncid, name.c_str(), NC_DOUBLE, numDims, dimIds, &varid ), "cannot define variable '" + name + "'" );
+
+    int unlimitedDim = -1;
+    sofaLocal::checkStatus( nc_inq_unlimdim( ncid, &unlimitedDim ), "cannot define variable '" + name + "'" );
+
+    if( dim1 == unlimitedDim )
+    {
+        std::size_t chunks[3] = { options.chunkMeasurements, 0, 0 };
+
+        for( int i = 1; i < numDims; i++ )
+        {
+            sofaLocal::checkStatus( nc_inq_dimlen( ncid, dimIds[ i ], &chunks[ i ] ), "cannot define variable '" + name + "'" );
+        }
+
+        sofaLocal::checkStatus( nc_def_var_chunking( ncid, varid, NC_CHUNKED, chunks ), "cannot set the chunking of '" + name + "'" );
+
+        if( options.deflateLevel > 0 || options.shuffle == true )
+        {
+            const int status = nc_def_var_deflate( ncid, varid,
+                                                   options.shuffle == true ? 1 : 0,
+                                                   options.deflateLevel > 0 ? 1 : 0,
+                                                   options.deflateLevel );
+
+            sofaLocal::checkStatus( status, "cannot set the compression of '" + name + "'" );
+        }
+    }
+
+    return varid;
+}
+
+/// writes the coordinates of an element of a [ I C ], [ R C I ] or [ E C I ] variable
+void Writer::putPosition(const std::string &name, const std::size_t index, const double position[3])
+{
+    int varid = -1;
+    sofaLocal::checkStatus( nc_inq_varid( ncid, name.c_str(), &varid ), "missing '" + name + "' variable" );
+
+    /// the third count is only used by the [ R C I ] and [ E C I ] variables
+    const std::size_t start[3] = { index, 0, 0 };
+    const std::size_t count[3] = { 1, 3, 1 };
+
+    sofaLocal::checkStatus( nc_put_vara_double( ncid, varid, start, count, position ), "cannot write '" + name + "'" );
+}
+
+void Writer::ensureOpen() const
+{
+    if( ncid < 0 )
+    {
+        SOFA_THROW( "the file is closed" );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Writes a global attribute
+ *  @param[in]      type_ : the attribute
+ *  @param[in]      value : its value
+ *
+ *  @details        Throws an exception if the attribute is read-only
+ */
+/************************************************************************************/
+void Writer::SetAttribute(const sofa::Attributes::Type &type_, const std::string &value)
+{
+    SetAttribute( sofa::Attributes::GetName( type_ ), value );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Writes a global attribute (e.g. 'DatabaseName', or any attribute specific to the convention)
+ *  @param[in]      name : name of the attribute
+ *  @param[in]      value : its value
+ *
+ *  @details        Throws an exception if the attribute is read-only
+ */
+/************************************************************************************/
+void Writer::SetAttribute(const std::string &name, const std::string &value)
+{
+    const sofa::Attributes::Type type_ = sofa::Attributes::GetType( name );
+
+    if( type_ != sofa::Attributes::kNumAttributes && sofa::Attributes::IsReadOnly( type_ ) == true )
+    {
+        SOFA_THROW( "read-only attribute : " + name );
+    }
+
+    ensureOpen();
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    sofaLocal::putText( ncid, NC_GLOBAL, name, value );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Writes all the non-empty attributes which are not read-only
+ *  @param[in]      attributes : the attributes
+ *
+ */
+/************************************************************************************/
+void Writer::SetAttributes(const sofa::Attributes &attributes)
+{
+    for( unsigned int k = 0; k < sofa::Attributes::kNumAttributes; k++ )
+    {
+        const sofa::Attributes::Type attType = static_cast< sofa::Attributes::Type >( k );
+        const std::string attValue = attributes.Get( attType );
+
+        if( sofa::Attributes::IsReadOnly( attType ) == false && attValue.empty() == false )
+        {
+            SetAttribute( attType, attValue );
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Sets the position of the listener, in cartesian coordinates (meter)
+ *
+ */
+/************************************************************************************/
+void Writer::SetListenerPosition(const double position[3])
+{
+    ensureOpen();
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    putPosition( "ListenerPosition", 0, position );
+}
+
+void Writer::SetListenerUp(const double up[3])
+{
+    ensureOpen();
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    putPosition( "ListenerUp", 0, up );
+}
+
+void Writer::SetListenerView(const double view[3])
+{
+    ensureOpen();
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    putPosition( "ListenerView", 0, view );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Sets the position of a receiver, in cartesian coordinates (meter)
+ *  @param[in]      receiverIndex : index of the receiver (between 0 and R-1)
+ *
+ */
+/************************************************************************************/
+void Writer::SetReceiverPosition(const std::size_t receiverIndex, const double position[3])
+{
+    if( receiverIndex >= numReceivers )
+    {
+        SOFA_THROW( "invalid receiver index" );
+    }
+
+    ensureOpen();
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    putPosition( "ReceiverPosition", receiverIndex, position );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Sets the position of an emitter, in cartesian coordinates (meter)
+ *  @param[in]      emitterIndex : index of the emitter (between 0 and E-1)
+ *
+ */
+/************************************************************************************/
+void Writer::SetEmitterPosition(const std::size_t emitterIndex, const double position[3])
+{
+    if( emitterIndex >= numEmitters )
+    {
+        SOFA_THROW( "invalid emitter index" );
+    }
+
+    ensureOpen();
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    putPosition( "EmitterPosition", emitterIndex, position );
+}
+
+/// writes SourcePosition and Data.Delay of the new measurement (the library mutex is held by the caller)
+void Writer::appendPositionAndDelays(const double sourcePosition[3], const double *delays)
+{
+    const std::size_t start[2] = { numMeasurements, 0 };
+
+    const std::size_t countPosition[2] = { 1, 3 };
+    sofaLocal::checkStatus( nc_put_vara_double( ncid, varSourcePosition, start, countPosition, sourcePosition ), "cannot write 'SourcePosition'" );
+
+    const std::size_t countDelay[2] = { 1, numReceivers };
+
+    if( delays != nullptr )
+    {
+        sofaLocal::checkStatus( nc_put_vara_double( ncid, varDataDelay, start, countDelay, delays ), "cannot write 'Data.Delay'" );
+    }
+    else
+    {
+        const std::vector< double > zeros( numReceivers, 0.0 );
+        sofaLocal::checkStatus( nc_put_vara_double( ncid, varDataDelay, start, countDelay, zeros.data() ), "cannot write 'Data.Delay'" );
+    }
+
+    numMeasurements++;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Appends one measurement to the file
+ *  @param[in]      dataIR : the impulse responses of all the receivers [ R N ]
+ *  @param[in]      numValues : size of the dataIR array (shall be R x N)
+ *  @param[in]      sourcePosition : position of the source, in the coordinates of 'SourcePosition'
+ *  @param[in]      delays : the broadband delays of all the receivers [ R ], in samples
+ *                  (nullptr for no delay)
+ *
+ */
+/************************************************************************************/
+void Writer::AppendMeasurement(const double *dataIR,
+                               const std::size_t numValues,
+                               const double sourcePosition[3],
+                               const double *delays)
+{
+    if( numValues != numReceivers * numDataSamples )
+    {
+        SOFA_THROW( "invalid number of values" );
+    }
+
+    ensureOpen();
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    const std::size_t start[3] = { numMeasurements, 0, 0 };
+    const std::size_t count[3] = { 1, numReceivers, numDataSamples };
+
+    sofaLocal::checkStatus( nc_put_vara_double( ncid, varDataIR, start, count, dataIR ), "cannot write 'Data.IR'" );
+
+    appendPositionAndDelays( sourcePosition, delays );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Appends one measurement to the file
+ *
+ *  @details        Single precision version : the values are converted while writing
+ */
+/************************************************************************************/
+void Writer::AppendMeasurement(const float *dataIR,
+                               const std::size_t numValues,
+                               const double sourcePosition[3],
+                               const double *delays)
+{
+    if( numValues != numReceivers * numDataSamples )
+    {
+        SOFA_THROW( "invalid number of values" );
+    }
+
+    ensureOpen();
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    const std::size_t start[3] = { numMeasurements, 0, 0 };
+    const std::size_t count[3] = { 1, numReceivers, numDataSamples };
+
+    sofaLocal::checkStatus( nc_put_vara_float( ncid, varDataIR, start, count, dataIR ), "cannot write 'Data.IR'" );
+
+    appendPositionAndDelays( sourcePosition, delays );
+}
+
+std::size_t Writer::GetNumMeasurements() const SOFA_NOEXCEPT
+{
+    return numMeasurements;
+}
+
+std::size_t Writer::GetNumReceivers() const SOFA_NOEXCEPT
+{
+    return numReceivers;
+}
+
+std::size_t Writer::GetNumEmitters() const SOFA_NOEXCEPT
+{
+    return numEmitters;
+}
+
+std::size_t Writer::GetNumDataSamples() const SOFA_NOEXCEPT
+{
+    return numDataSamples;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Flushes and closes the file. Nothing can be written afterwards
+ *
+ *  @details        Throws an exception if an error occured
+ */
+/************************************************************************************/
+void Writer::Close()
+{
+    if( ncid < 0 )
+    {
+        return;
+    }
+
+    const sofaLocal::LibraryLock lock( sofa::NetCDFFile::GetLibraryMutex() );
+
+    const int status = nc_close( ncid );
+    ncid = -1;
+
+    sofaLocal::checkStatus( status, "cannot close file" );
+}
@@ -0,0 +1,166 @@
+/*
+Copyright (c) 2013--2017, UMR STMS 9912 - Ircam-Centre Pompidou / CNRS / UPMC
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the <organization> nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/**
+
+Spatial acoustic data file format - AES69-2015 - Standard for File Exchange - Spatial Acoustic Data File Format
+http://www.aes.org
+
+SOFA (Spatially Oriented Format for Acoustics)
+http://www.sofaconventions.org
+
+*/
+
+
+/************************************************************************************/
+/*!
+ *   @file       SOFAWriter.h
+ *   @brief      Writes a SOFA file, one measurement at a time
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#ifndef _SOFA_WRITER_H__
+#define _SOFA_WRITER_H__
+
+#include "../src/SOFAFile.h"
+#include "../src/SOFAAttributes.h"
+#include <string>
+#include <cstddef>
+
+namespace sofa
+{
+
+    /************************************************************************************/
+    /*!
+     *  @class          Writer
+     *  @brief          Creates a SOFA file with DataType 'FIR', and appends the measurements
+     *                  one at a time
+     *
+     *  @details        Supported conventions : SimpleFreeFieldHRIR, SimpleHeadphoneIR and GeneralFIR.
+     *
+     *                  The file is created by the constructor, with all the required attributes
+     *                  (default values, and empty strings for the attributes without default value)
+     *                  and variables :
+     *                  - M is an unlimited dimension : each call to AppendMeasurement() writes
+     *                    Data.IR [ M R N ], Data.Delay [ M R ] and SourcePosition [ M C ],
+     *                    so that the measurements never need to be held in memory
+     *                  - ListenerPosition, ListenerUp, ListenerView [ I C ], ReceiverPosition [ R C I ]
+     *                    and EmitterPosition [ E C I ] are cartesian, and initialized with zeros
+     *                    (ListenerUp = (0 0 1), ListenerView = (1 0 0))
+     *                  - SourcePosition is spherical ("degree, degree, meter") in SimpleFreeFieldHRIR,
+     *                    and cartesian ("meter") otherwise
+     *                  - E is 1, except in SimpleHeadphoneIR where E = R
+     *
+     *                  Data.IR is stored in double precision, in chunks of Options::chunkMeasurements
+     *                  measurements, optionally compressed.
+     *
+     *                  Throws an exception if the netCDF library reports an error.
+     *                  The netCDF calls are serialized with NetCDFFile::GetLibraryMutex().
+     */
+    /************************************************************************************/
+    class SOFA_API Writer
+    {
+    public:
+        /// storage of the variables along M
+        struct Options
+        {
+            Options();
+
+            std::size_t chunkMeasurements;      ///< number of measurements per chunk (default 1)
+            int deflateLevel;                   ///< 0 (no compression, default) to 9
+            bool shuffle;                       ///< byte shuffling before the compression (default false)
+        };
+
+    public:
+        Writer(const std::string &path,
+               const sofa::File::ConventionFlag convention,
+               const std::size_t numReceivers,
+               const std::size_t numDataSamples,
+               const double samplingRate,
+               const Options &options = Options());
+
+        ~Writer();
+
+        void SetAttribute(const sofa::Attributes::Type &type_, const std::string &value);
+        void SetAttribute(const std::string &name, const std::string &value);
+        void SetAttributes(const sofa::Attributes &attributes);
+
+        void SetListenerPosition(const double position[3]);
+        void SetListenerUp(const double up[3]);
+        void SetListenerView(const double view[3]);
+        void SetReceiverPosition(const std::size_t receiverIndex, const double position[3]);
+        void SetEmitterPosition(const std::size_t emitterIndex, const double position[3]);
+
+        void AppendMeasurement(const double *dataIR,
+                               const std::size_t numValues,
+                               const double sourcePosition[3],
+                               const double *delays = nullptr);
+
+        void AppendMeasurement(const float *dataIR,
+                               const std::size_t numValues,
+                               const double sourcePosition[3],
+                               const double *delays = nullptr);
+
+        std::size_t GetNumMeasurements() const SOFA_NOEXCEPT;
+        std::size_t GetNumReceivers() const SOFA_NOEXCEPT;
+        std::size_t GetNumEmitters() const SOFA_NOEXCEPT;
+        std::size_t GetNumDataSamples() const SOFA_NOEXCEPT;
+
+        void Close();
+
+    private:
+        //==============================================================================
+        void createFile(const std::string &path, const sofa::File::ConventionFlag convention, const double samplingRate);
+        int defineVariable(const std::string &name, const int dim1, const int dim2, const int dim3 = -1);
+        void putPosition(const std::string &name, const std::size_t index, const double position[3]);
+        void appendPositionAndDelays(const double sourcePosition[3], const double *delays);
+        void ensureOpen() const;
+
+    private:
+        //==============================================================================
+        const Options options;
+        int ncid;                               ///< -1 once closed
+        int varDataIR;
+        int varDataDelay;
+        int varSourcePosition;
+
+        std::size_t numMeasurements;            ///< M
+        const std::size_t numReceivers;         ///< R
+        std::size_t numEmitters;                ///< E
+        const std::size_t numDataSamples;       ///< N
+
+    private:
+        //==============================================================================
+        /// avoid shallow and copy constructor
+        SOFA_AVOID_COPY_CONSTRUCTOR( Writer );
+    };
+
+}
+
+#endif /* _SOFA_WRITER_H__ */
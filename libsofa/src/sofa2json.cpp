@@ -25,14 +25,17 @@
 /************************************************************************************/
 static bool TestFileConvention(json_object *jobj, const std::string & filename)
 {
-	bool valid = sofa::IsValidSimpleFreeFieldHRIRFile( filename );
-	json_object_object_add(jobj, "isNetCDF", json_object_new_boolean(sofa::IsValidNetCDFFile( filename )));
-	json_object_object_add(jobj, "isSOFA", json_object_new_boolean(sofa::IsValidSOFAFile( filename )));
+	/// the file is opened and validated only once
+	const unsigned int flags = sofa::DetectConventions( filename );
+
+	bool valid = ( flags & sofa::File::kSimpleFreeFieldHRIR ) != 0;
+	json_object_object_add(jobj, "isNetCDF", json_object_new_boolean( ( flags & sofa::File::kNetCDF ) != 0 ));
+	json_object_object_add(jobj, "isSOFA", json_object_new_boolean( ( flags & sofa::File::kSOFA ) != 0 ));
 	json_object_object_add(jobj, "isSimpleFreeFieldHRIR", json_object_new_boolean(valid));
-	json_object_object_add(jobj, "isSimpleFreeFieldSOS", json_object_new_boolean(sofa::IsValidSimpleFreeFieldSOSFile( filename )));
-	json_object_object_add(jobj, "isSimpleHeadphoneIRF", json_object_new_boolean(sofa::IsValidSimpleHeadphoneIRFile( filename )));
-	json_object_object_add(jobj, "isGeneralFIR", json_object_new_boolean(sofa::IsValidGeneralFIRFile( filename )));
-	json_object_object_add(jobj, "isGeneralTF", json_object_new_boolean(sofa::IsValidGeneralTFFile( filename )));
+	json_object_object_add(jobj, "isSimpleFreeFieldSOS", json_object_new_boolean( ( flags & sofa::File::kSimpleFreeFieldSOS ) != 0 ));
+	json_object_object_add(jobj, "isSimpleHeadphoneIRF", json_object_new_boolean( ( flags & sofa::File::kSimpleHeadphoneIR ) != 0 ));
+	json_object_object_add(jobj, "isGeneralFIR", json_object_new_boolean( ( flags & sofa::File::kGeneralFIR ) != 0 ));
+	json_object_object_add(jobj, "isGeneralTF", json_object_new_boolean( ( flags & sofa::File::kGeneralTF ) != 0 ));
 
 	return valid;
 }
@@ -377,6 +377,52 @@ static void CreateSimpleFreeFieldHRIRFile()
     ///@todo add any other variables, as you need
 }
 
+/************************************************************************************/
+/*!
+ *  @brief          Example for writing a SimpleFreeFieldHRIR file with sofa::Writer,
+ *                  one measurement at a time
+ *
+ */
+/************************************************************************************/
+void WriteSimpleFreeFieldHRIRFile()
+{
+    /// the file shall not exist beforehand
+    const std::string filePath = "/Users/tcarpent/Desktop/testwriter.sofa";
+
+    const std::size_t numReceivers      = 2;
+    const std::size_t numDataSamples    = 941;
+    const double samplingRate           = 48000.;
+
+    /// compressed chunks of 64 measurements
+    sofa::Writer::Options options;
+    options.chunkMeasurements   = 64;
+    options.deflateLevel        = 4;
+    options.shuffle             = true;
+
+    sofa::Writer writer( filePath, sofa::File::kSimpleFreeFieldHRIR, numReceivers, numDataSamples, samplingRate, options );
+
+    writer.SetAttribute( "DatabaseName", "TestDatabase" );
+    writer.SetAttribute( sofa::Attributes::kRoomLocation, "IRCAM, Paris" );
+
+    const double leftEar[3]  = { 0.0,  0.09, 0.0 };
+    const double rightEar[3] = { 0.0, -0.09, 0.0 };
+    writer.SetReceiverPosition( 0, leftEar );
+    writer.SetReceiverPosition( 1, rightEar );
+
+    std::vector< double > dataIR( numReceivers * numDataSamples, 0.0 );
+
+    for( unsigned int azimuth = 0; azimuth < 360; azimuth += 15 )
+    {
+        ///@todo : measure the impulse responses of this direction into dataIR
+
+        const double sourcePosition[3] = { (double) azimuth, 0.0, 1.95 };
+
+        writer.AppendMeasurement( &dataIR[0], dataIR.size(), sourcePosition );
+    }
+
+    writer.Close();
+}
+
 /************************************************************************************/
 /*!
  *  @brief          Main entry point
@@ -402,5 +448,8 @@ int main(int argc, char *argv[])
     /// example for creating a SimpleFreeFieldHRIR file
     //CreateSimpleFreeFieldHRIRFile();
     
+    /// example for writing a SimpleFreeFieldHRIR file, one measurement at a time
+    //WriteSimpleFreeFieldHRIRFile();
+    
     return 0;
 }
@@ -0,0 +1,446 @@
+/************************************************************************************/
+/*!
+ *   @file       sofarepack.cpp
+ *   @brief      Rewrites a SOFA file with Data.IR chunked along the measurements
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFA.h"
+#include "../src/SOFAString.h"
+#include "../src/SOFAExceptions.h"
+#include <netcdf.h>
+#include <chrono>
+#include <random>
+#include <map>
+#include <cstdlib>
+#include <sys/stat.h>
+
+static void DisplayHelp(std::ostream & output = std::cout)
+{
+    output << "sofarepack rewrites a SOFA file with the variables chunked along the measurements," << std::endl;
+    output << "so that one measurement can be read without decompressing the whole Data.IR" << std::endl;
+    output << "    syntax : ./sofarepack [options] [input] [output]" << std::endl;
+    output << "    options :" << std::endl;
+    output << "        -chunk [numMeasurements] : number of measurements per chunk (default 1)" << std::endl;
+    output << "        -deflate [level]         : compression level, from 0 (none, default) to 9" << std::endl;
+    output << "        -shuffle                 : byte shuffling before the compression" << std::endl;
+    output << "    the output file shall not exist beforehand" << std::endl;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Storage of the variables along M in the output file
+ *
+ */
+/************************************************************************************/
+struct RepackOptions
+{
+    RepackOptions() : chunkMeasurements( 1 ), deflateLevel( 0 ), shuffle( false ) {}
+
+    std::size_t chunkMeasurements;
+    int deflateLevel;
+    bool shuffle;
+};
+
+/// closes a netCDF file when leaving the scope
+struct NcFileCloser
+{
+    explicit NcFileCloser(const int ncid_) : ncid( ncid_ ) {}
+    ~NcFileCloser() { nc_close( ncid ); }
+
+    const int ncid;
+};
+
+static void CheckStatus(const int status, const std::string &what)
+{
+    if( status != NC_NOERR )
+    {
+        SOFA_THROW( what + " : " + std::string( nc_strerror( status ) ) );
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Copies all the dimensions, attributes and variables of a file.
+ *                  The variables whose first dimension is M are chunked and compressed
+ *                  according to the options; the other variables are stored contiguously
+ *
+ */
+/************************************************************************************/
+static void Repack(const std::string &input,
+                   const std::string &output,
+                   const RepackOptions &options)
+{
+    int in = -1;
+    CheckStatus( nc_open( input.c_str(), NC_NOWRITE, &in ), "cannot open file " + input );
+    const NcFileCloser inCloser( in );
+
+    int out = -1;
+    CheckStatus( nc_create( output.c_str(), NC_NETCDF4 | NC_NOCLOBBER, &out ), "cannot create file " + output );
+    const NcFileCloser outCloser( out );
+
+    //==============================================================================
+    // dimensions
+    //==============================================================================
+    int numDims = 0;
+    CheckStatus( nc_inq_dimids( in, &numDims, NULL, 0 ), "cannot read dimensions" );
+
+    std::vector< int > dimIds( numDims );
+    CheckStatus( nc_inq_dimids( in, &numDims, dimIds.data(), 0 ), "cannot read dimensions" );
+
+    int unlimitedDim = -1;
+    CheckStatus( nc_inq_unlimdim( in, &unlimitedDim ), "cannot read dimensions" );
+
+    int dimM = -1;
+    CheckStatus( nc_inq_dimid( in, "M", &dimM ), "missing dimension M" );
+
+    std::map< int, int > outDimIds;
+    std::map< int, std::size_t > dimLengths;
+
+    for( int i = 0; i < numDims; i++ )
+    {
+        char name[ NC_MAX_NAME + 1 ];
+        std::size_t length = 0;
+        CheckStatus( nc_inq_dim( in, dimIds[i], name, &length ), "cannot read dimensions" );
+
+        int outId = -1;
+        CheckStatus( nc_def_dim( out, name, ( dimIds[i] == unlimitedDim ) ? NC_UNLIMITED : length, &outId ), "cannot define dimension " + std::string( name ) );
+
+        outDimIds[ dimIds[i] ]  = outId;
+        dimLengths[ dimIds[i] ] = length;
+    }
+
+    //==============================================================================
+    // global attributes
+    //==============================================================================
+    int numGlobalAttributes = 0;
+    CheckStatus( nc_inq_natts( in, &numGlobalAttributes ), "cannot read global attributes" );
+
+    for( int i = 0; i < numGlobalAttributes; i++ )
+    {
+        char name[ NC_MAX_NAME + 1 ];
+        CheckStatus( nc_inq_attname( in, NC_GLOBAL, i, name ), "cannot read global attributes" );
+        CheckStatus( nc_copy_att( in, NC_GLOBAL, name, out, NC_GLOBAL ), "cannot copy attribute " + std::string( name ) );
+    }
+
+    //==============================================================================
+    // variables
+    //==============================================================================
+    int numVars = 0;
+    CheckStatus( nc_inq_varids( in, &numVars, NULL ), "cannot read variables" );
+
+    std::vector< int > varIds( numVars );
+    CheckStatus( nc_inq_varids( in, &numVars, varIds.data() ), "cannot read variables" );
+
+    std::vector< int > outVarIds( numVars );
+
+    for( int v = 0; v < numVars; v++ )
+    {
+        char name[ NC_MAX_NAME + 1 ];
+        nc_type type = NC_NAT;
+        int numVarDims = 0;
+        int varDimIds[ NC_MAX_VAR_DIMS ];
+        int numAttributes = 0;
+        CheckStatus( nc_inq_var( in, varIds[v], name, &type, &numVarDims, varDimIds, &numAttributes ), "cannot read variables" );
+
+        if( type > NC_STRING )
+        {
+            SOFA_THROW( "unsupported type for variable " + std::string( name ) );
+        }
+
+        int outVarDimIds[ NC_MAX_VAR_DIMS ];
+        for( int d = 0; d < numVarDims; d++ )
+        {
+            outVarDimIds[d] = outDimIds[ varDimIds[d] ];
+        }
+
+        int outVar = -1;
+        CheckStatus( nc_def_var( out, name, type, numVarDims, outVarDimIds, &outVar ), "cannot define variable " + std::string( name ) );
+
+        outVarIds[v] = outVar;
+
+        if( numVarDims > 0 && varDimIds[0] == dimM )
+        {
+            std::size_t chunks[ NC_MAX_VAR_DIMS ];
+            for( int d = 0; d < numVarDims; d++ )
+            {
+                chunks[d] = std::max< std::size_t >( 1, dimLengths[ varDimIds[d] ] );
+            }
+            chunks[0] = std::min( chunks[0], options.chunkMeasurements );
+
+            CheckStatus( nc_def_var_chunking( out, outVar, NC_CHUNKED, chunks ), "cannot set the chunking of " + std::string( name ) );
+
+            if( ( options.deflateLevel > 0 || options.shuffle == true ) && type != NC_STRING )
+            {
+                const int status = nc_def_var_deflate( out, outVar,
+                                                       options.shuffle == true ? 1 : 0,
+                                                       options.deflateLevel > 0 ? 1 : 0,
+                                                       options.deflateLevel );
+
+                CheckStatus( status, "cannot set the compression of " + std::string( name ) );
+            }
+        }
+
+        for( int a = 0; a < numAttributes; a++ )
+        {
+            char attributeName[ NC_MAX_NAME + 1 ];
+            CheckStatus( nc_inq_attname( in, varIds[v], a, attributeName ), "cannot read attributes of " + std::string( name ) );
+            CheckStatus( nc_copy_att( in, varIds[v], attributeName, out, outVar ), "cannot copy attribute " + std::string( attributeName ) );
+        }
+    }
+
+    CheckStatus( nc_enddef( out ), "cannot create file " + output );
+
+    //==============================================================================
+    // values
+    //==============================================================================
+
+    /// the variables along M are copied by blocks of about 64 MB, aligned on the chunks,
+    /// so that a badly chunked input is not decompressed once per measurement
+    const std::size_t blockSize = 64 * 1024 * 1024;
+
+    for( int v = 0; v < numVars; v++ )
+    {
+        nc_type type = NC_NAT;
+        int numVarDims = 0;
+        int varDimIds[ NC_MAX_VAR_DIMS ];
+        CheckStatus( nc_inq_var( in, varIds[v], NULL, &type, &numVarDims, varDimIds, NULL ), "cannot read variables" );
+
+        std::size_t typeSize = 0;
+        CheckStatus( nc_inq_type( in, type, NULL, &typeSize ), "cannot read variables" );
+
+        std::size_t start[ NC_MAX_VAR_DIMS ];
+        std::size_t count[ NC_MAX_VAR_DIMS ];
+        std::size_t sliceSize = typeSize;     ///< size of one element along the first dimension
+
+        for( int d = 0; d < numVarDims; d++ )
+        {
+            start[d] = 0;
+            count[d] = dimLengths[ varDimIds[d] ];
+
+            if( d > 0 )
+            {
+                sliceSize *= count[d];
+            }
+        }
+
+        const std::size_t length = ( numVarDims > 0 ) ? count[0] : 1;
+
+        std::size_t step = length;
+        if( numVarDims > 0 && varDimIds[0] == dimM && sliceSize > 0 )
+        {
+            step = std::max< std::size_t >( 1, blockSize / ( sliceSize * options.chunkMeasurements ) ) * options.chunkMeasurements;
+        }
+
+        for( std::size_t first = 0; first < length && sliceSize > 0; first += step )
+        {
+            if( numVarDims > 0 )
+            {
+                start[0] = first;
+                count[0] = std::min( step, length - first );
+            }
+
+            const std::size_t numElements = ( numVarDims > 0 ? count[0] : 1 ) * ( sliceSize / typeSize );
+
+            std::vector< char > values( numElements * typeSize );
+
+            CheckStatus( nc_get_vara( in, varIds[v], start, count, values.data() ), "cannot read variable values" );
+
+            const int status = nc_put_vara( out, outVarIds[v], start, count, values.data() );
+
+            if( type == NC_STRING )
+            {
+                nc_free_string( numElements, reinterpret_cast< char ** >( values.data() ) );
+            }
+
+            CheckStatus( status, "cannot write variable values" );
+        }
+    }
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Read timings of a SOFA file
+ *
+ */
+/************************************************************************************/
+struct Timings
+{
+    Timings() : fileSize( 0 ), fullLoad( 0.0 ), singleMeasurement( 0.0 ) {}
+
+    long long fileSize;                 ///< in bytes
+    double fullLoad;                    ///< open and read the whole Data.IR, in ms
+    double singleMeasurement;           ///< read one random measurement of a file just opened, in ms
+};
+
+static double GetElapsedMilliseconds(const std::chrono::steady_clock::time_point &start)
+{
+    return std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+}
+
+static Timings MeasureTimings(const std::string &path)
+{
+    Timings timings;
+
+    struct stat status;
+    if( stat( path.c_str(), &status ) == 0 )
+    {
+        timings.fileSize = (long long) status.st_size;
+    }
+
+    const unsigned int numTrials = 20;
+
+    for( unsigned int i = 0; i < numTrials; i++ )
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        const sofa::File file( path );
+        std::vector< double > values;
+        file.GetValues( values, "Data.IR" );
+
+        timings.fullLoad += GetElapsedMilliseconds( start ) / (double) numTrials;
+    }
+
+    /// the same measurements are read before and after repacking
+    std::mt19937 generator( 1234 );
+
+    for( unsigned int i = 0; i < numTrials; i++ )
+    {
+        const sofa::SharedFile file( path );
+
+        const std::size_t R = file.GetNumReceivers();
+        const std::size_t E = file.GetNumEmitters();
+        const std::size_t N = file.GetNumDataSamples();
+        const std::size_t m = std::uniform_int_distribution< std::size_t >( 0, file.GetNumMeasurements() - 1 )( generator );
+
+        std::vector< double > values( N );
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        for( std::size_t r = 0; r < R; r++ )
+        {
+            /// Data.IR is either [ M R N ] or [ M R E N ]
+            if( file.GetDataIR( m, r, values.data(), N ) == false )
+            {
+                for( std::size_t e = 0; e < E; e++ )
+                {
+                    file.GetDataIR( m, r, e, values.data(), N );
+                }
+            }
+        }
+
+        timings.singleMeasurement += GetElapsedMilliseconds( start ) / (double) numTrials;
+    }
+
+    return timings;
+}
+
+static void PrintTimings(const Timings &before,
+                         const Timings &after,
+                         std::ostream & output)
+{
+    output << sofa::String::PadWith( "" ) << sofa::String::PadWith( "before", 16 ) << sofa::String::PadWith( "after", 16 ) << std::endl;
+    output << sofa::String::PadWith( "file size (bytes)" )
+           << sofa::String::PadWith( std::to_string( before.fileSize ), 16 )
+           << sofa::String::PadWith( std::to_string( after.fileSize ), 16 ) << std::endl;
+    output << sofa::String::PadWith( "full load (ms)" )
+           << sofa::String::PadWith( std::to_string( before.fullLoad ), 16 )
+           << sofa::String::PadWith( std::to_string( after.fullLoad ), 16 ) << std::endl;
+    output << sofa::String::PadWith( "one measurement (ms)" )
+           << sofa::String::PadWith( std::to_string( before.singleMeasurement ), 16 )
+           << sofa::String::PadWith( std::to_string( after.singleMeasurement ), 16 ) << std::endl;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Main entry point
+ *
+ */
+/************************************************************************************/
+int main(int argc, char *argv[])
+{
+    std::ostream & output = std::cout;
+
+    //==============================================================================
+    // Parsing arguments
+    //==============================================================================
+    RepackOptions options;
+    std::vector< std::string > filenames;
+
+    for( int i = 1; i < argc; i++ )
+    {
+        const std::string arg = argv[i];
+
+        if( arg == "h" || arg == "-h" || arg == "--h" || arg == "--help" || arg == "-help" )
+        {
+            DisplayHelp( output );
+            return 0;
+        }
+        else if( arg == "-chunk" && i + 1 < argc )
+        {
+            options.chunkMeasurements = (std::size_t) std::max( 1, sofa::String::String2Int( argv[ ++i ] ) );
+        }
+        else if( arg == "-deflate" && i + 1 < argc )
+        {
+            options.deflateLevel = std::min( 9, std::max( 0, sofa::String::String2Int( argv[ ++i ] ) ) );
+        }
+        else if( arg == "-shuffle" )
+        {
+            options.shuffle = true;
+        }
+        else
+        {
+            filenames.push_back( arg );
+        }
+    }
+
+    if( filenames.size() != 2 )
+    {
+        DisplayHelp( output );
+        return 0;
+    }
+
+    const std::string input  = filenames[0];
+    const std::string repacked = filenames[1];
+
+    try
+    {
+        if( sofa::IsValidSOFAFile( input ) == false )
+        {
+            output << input << " is not a valid SOFA file" << std::endl;
+            return 1;
+        }
+
+        Repack( input, repacked, options );
+
+        if( sofa::IsValidSOFAFile( repacked ) == false )
+        {
+            output << repacked << " is not a valid SOFA file" << std::endl;
+            return 1;
+        }
+
+        output << repacked << " written (" << options.chunkMeasurements << " measurement(s) per chunk, deflate level "
+               << options.deflateLevel << ( options.shuffle == true ? ", shuffle)" : ")" ) << std::endl;
+
+        sofa::String::PrintSeparationLine( output );
+
+        const Timings before = MeasureTimings( input );
+        const Timings after  = MeasureTimings( repacked );
+
+        PrintTimings( before, after, output );
+    }
+    catch( std::exception &e )
+    {
+        std::cerr << "exception occured : " << e.what() << std::endl;
+        exit(1);
+    }
+    catch( ... )
+    {
+        std::cerr << "unknown exception occured" << std::endl;
+        exit(1);
+    }
+
+    return 0;
+}
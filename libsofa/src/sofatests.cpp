@@ -0,0 +1,369 @@
+/************************************************************************************/
+/*!
+ *   @file       sofatests.cpp
+ *   @brief      Regression tests of the library, run by ctest
+ *
+ *   @date       16/10/2026
+ *
+ */
+/************************************************************************************/
+#include "../src/SOFA.h"
+#include "../src/SOFAString.h"
+#include "../src/SOFAExceptions.h"
+#include "../src/SOFAPoint3.h"
+#include "../src/SOFAHostArchitecture.h"
+#include "ncFile.h"
+#include "ncDim.h"
+#include "ncVar.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#if ( SOFA_WINDOWS == 1 )
+    #include <direct.h>
+#else
+    #include <sys/stat.h>
+#endif
+
+/************************************************************************************/
+/*!
+ *  @brief          Writes a small SimpleFreeFieldHRIR file whose variables are stored
+ *                  with the given netCDF type ("double" or "float")
+ *
+ */
+/************************************************************************************/
+static void WriteSimpleFreeFieldHRIRFile(const std::string &path,
+                                         const std::string &type,
+                                         const double samplingRate)
+{
+    std::remove( path.c_str() );
+
+    netCDF::NcFile file( path, netCDF::NcFile::newFile, netCDF::NcFile::nc4 );
+
+    sofa::Attributes attributes;
+    attributes.ResetToDefault();
+    attributes.Set( sofa::Attributes::kTitle, "sofatests" );
+    attributes.Set( sofa::Attributes::kDateCreated, "2026-10-16 00:00:00" );
+    attributes.Set( sofa::Attributes::kDateModified, "2026-10-16 00:00:00" );
+    attributes.Set( sofa::Attributes::kAuthorContact, "sofatests" );
+    attributes.Set( sofa::Attributes::kOrganization, "sofatests" );
+    attributes.Set( sofa::Attributes::kListenerShortName, "sofatests" );
+
+    for( unsigned int i = 0; i < sofa::Attributes::kNumAttributes; i++ )
+    {
+        const sofa::Attributes::Type attributeType = (sofa::Attributes::Type) i;
+        file.putAtt( sofa::Attributes::GetName( attributeType ), attributes.Get( attributeType ) );
+    }
+    file.putAtt( "DatabaseName", "sofatests" );
+
+    const std::size_t M = 4;
+    const std::size_t R = 2;
+    const std::size_t N = 16;
+
+    file.addDim( "C", 3 );
+    file.addDim( "I", 1 );
+    file.addDim( "M", M );
+    file.addDim( "R", R );
+    file.addDim( "E", 1 );
+    file.addDim( "N", N );
+
+    const double origin[3]    = { 0.0, 0.0, 0.0 };
+    const double view[3]      = { 1.0, 0.0, 0.0 };
+    const double up[3]        = { 0.0, 0.0, 1.0 };
+    const double receivers[6] = { 0.0, 0.09, 0.0, 0.0, -0.09, 0.0 };
+    const double sources[M*3] = { 0.0, 0.0, 1.2, 90.0, 0.0, 1.2, 180.0, 0.0, 1.2, 270.0, 0.0, 1.2 };
+
+    std::vector< double > ir( M * R * N, 0.0 );
+    std::vector< double > delay( M * R, 0.0 );
+    for( std::size_t i = 0; i < M * R; i++ )
+    {
+        ir[ i * N + i % N ] = 1.0;
+    }
+
+    netCDF::NcVar var = file.addVar( "Data.SamplingRate", type, "I" );
+    var.putVar( &samplingRate );
+    var.putAtt( "Units", "hertz" );
+
+    var = file.addVar( "Data.IR", type, std::vector< std::string >{ "M", "R", "N" } );
+    var.putVar( ir.data() );
+
+    var = file.addVar( "Data.Delay", type, std::vector< std::string >{ "M", "R" } );
+    var.putVar( delay.data() );
+
+    var = file.addVar( "ListenerPosition", "double", std::vector< std::string >{ "I", "C" } );
+    var.putAtt( "Type", "cartesian" );
+    var.putAtt( "Units", "metre" );
+    var.putVar( origin );
+
+    var = file.addVar( "ListenerUp", "double", std::vector< std::string >{ "I", "C" } );
+    var.putVar( up );
+
+    var = file.addVar( "ListenerView", "double", std::vector< std::string >{ "I", "C" } );
+    var.putAtt( "Type", "cartesian" );
+    var.putAtt( "Units", "metre" );
+    var.putVar( view );
+
+    var = file.addVar( "ReceiverPosition", "double", std::vector< std::string >{ "R", "C", "I" } );
+    var.putAtt( "Type", "cartesian" );
+    var.putAtt( "Units", "metre" );
+    var.putVar( receivers );
+
+    var = file.addVar( "SourcePosition", type, std::vector< std::string >{ "M", "C" } );
+    var.putAtt( "Type", "spherical" );
+    var.putAtt( "Units", "degree, degree, metre" );
+    var.putVar( sources );
+
+    var = file.addVar( "EmitterPosition", "double", std::vector< std::string >{ "E", "C", "I" } );
+    var.putAtt( "Type", "cartesian" );
+    var.putAtt( "Units", "metre" );
+    var.putVar( origin );
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          A file whose Data.SamplingRate is stored as a float is valid,
+ *                  and its sampling rate can be read back
+ *
+ */
+/************************************************************************************/
+static bool TestFloatSamplingRate(std::ostream & output)
+{
+    const std::string path = "sofatests_float.sofa";
+
+    WriteSimpleFreeFieldHRIRFile( path, "float", 44100.0 );
+
+    const sofa::SimpleFreeFieldHRIR hrir( path );
+
+    if( hrir.IsValid() == false )
+    {
+        output << "float file is not valid" << std::endl;
+        return false;
+    }
+
+    double samplingRate = 0.0;
+
+    if( hrir.GetSamplingRate( samplingRate ) == false || samplingRate != 44100.0 )
+    {
+        output << "float sampling rate read as " << samplingRate << std::endl;
+        return false;
+    }
+
+    std::remove( path.c_str() );
+
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          A file rewritten within the same second is reloaded by the dataset cache
+ *
+ */
+/************************************************************************************/
+static bool TestDatasetCacheRewrite(std::ostream & output)
+{
+    const std::string path = "sofatests_cache.sofa";
+
+    sofa::DatasetCache cache;
+
+    WriteSimpleFreeFieldHRIRFile( path, "double", 44100.0 );
+    const double before = cache.Get( path )->GetSamplingRate();
+
+    WriteSimpleFreeFieldHRIRFile( path, "double", 48000.0 );
+    const double after = cache.Get( path )->GetSamplingRate();
+
+    std::remove( path.c_str() );
+
+    if( before != 44100.0 || after != 48000.0 )
+    {
+        output << "cached sampling rate " << before << " then " << after << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          A directory with a double and a float file is loaded by HRTFDatabase,
+ *                  each subject holding the impulse responses of its file
+ *
+ */
+/************************************************************************************/
+static bool TestHRTFDatabase(std::ostream & output)
+{
+    const std::string directory = "sofatests_database";
+    const std::string paths[2]  = { directory + "/s0.sofa", directory + "/s1.sofa" };
+
+#if ( SOFA_WINDOWS == 1 )
+    _mkdir( directory.c_str() );
+#else
+    mkdir( directory.c_str(), 0755 );
+#endif
+
+    WriteSimpleFreeFieldHRIRFile( paths[0], "double", 48000.0 );
+    WriteSimpleFreeFieldHRIRFile( paths[1], "float", 48000.0 );
+
+    bool passed = true;
+
+    {
+        const sofa::HRTFDatabase database( directory, 2 );
+
+        if( database.GetNumSubjects() != 2 || database.GetSamplingRate() != 48000.0 )
+        {
+            output << "loaded " << database.GetNumSubjects() << " subject(s) at " << database.GetSamplingRate() << " Hz" << std::endl;
+            passed = false;
+        }
+
+        for( std::size_t s = 0; s < database.GetNumSubjects() && passed == true; s++ )
+        {
+            const sofa::SimpleFreeFieldHRIR hrir( paths[s] );
+
+            std::vector< float > values;
+            hrir.GetDataIR( values );
+
+            if( std::equal( values.begin(), values.end(), database.GetDataIR( s, 0, 0 ) ) == false )
+            {
+                output << "subject " << s << " differs from its file" << std::endl;
+                passed = false;
+            }
+        }
+    }
+
+    std::remove( paths[0].c_str() );
+    std::remove( paths[1].c_str() );
+    std::remove( directory.c_str() );
+
+    return passed;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Hash of the bit patterns of an array of doubles (FNV-1a)
+ *
+ */
+/************************************************************************************/
+static unsigned long long HashBits(const std::vector< double > &values)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for( std::size_t i = 0; i < values.size(); i++ )
+    {
+        unsigned long long bits = 0;
+        std::memcpy( &bits, &values[i], sizeof( bits ) );
+
+        for( unsigned int b = 0; b < 8; b++ )
+        {
+            hash ^= ( bits >> ( 8 * b ) ) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+    }
+
+    return hash;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          The array conversions of Point3 (SIMD kernels) give the same bits
+ *                  as the conversion of each point alone (scalar kernel), and these
+ *                  bits do not change from one build to the next
+ *
+ */
+/************************************************************************************/
+static bool TestPoint3Conversions(std::ostream & output)
+{
+    /// enough points for the vector paths and a remainder on the scalar path
+    const std::size_t numPoints = 11;
+
+    std::vector< double > spherical( numPoints * 3 );
+    for( std::size_t i = 0; i < numPoints; i++ )
+    {
+        spherical[ i * 3 + 0 ] = -180.0 + 37.3 * (double) i;
+        spherical[ i * 3 + 1 ] = -90.0 + 17.1 * (double) i;
+        spherical[ i * 3 + 2 ] = 0.25 + 0.7 * (double) i;
+    }
+
+    std::vector< double > cartesian = spherical;
+    sofa::Point3::ConvertTo( cartesian.data(), numPoints, sofa::Coordinates::kSpherical, sofa::Coordinates::kCartesian );
+
+    std::vector< double > roundTrip = cartesian;
+    sofa::Point3::ConvertTo( roundTrip.data(), numPoints, sofa::Coordinates::kCartesian, sofa::Coordinates::kSpherical );
+
+    for( std::size_t i = 0; i < numPoints; i++ )
+    {
+        sofa::Point3 point;
+        point.Set( sofa::Coordinates::kSpherical );
+        point.Set( &spherical[ i * 3 ] );
+        point.ConvertTo( sofa::Coordinates::kCartesian );
+
+        if( std::memcmp( point.data, &cartesian[ i * 3 ], sizeof( point.data ) ) != 0 )
+        {
+            output << "point " << i << " converts to cartesian differently alone" << std::endl;
+            return false;
+        }
+
+        point.ConvertTo( sofa::Coordinates::kSpherical );
+
+        if( std::memcmp( point.data, &roundTrip[ i * 3 ], sizeof( point.data ) ) != 0 )
+        {
+            output << "point " << i << " converts to spherical differently alone" << std::endl;
+            return false;
+        }
+    }
+
+    /// the kernels only use +, -, *, / and sqrt, which are exactly rounded
+    const unsigned long long expectedCartesian = 0x8dc1b097510ab548ULL;
+    const unsigned long long expectedRoundTrip = 0x340bbb47b098f600ULL;
+
+    if( HashBits( cartesian ) != expectedCartesian || HashBits( roundTrip ) != expectedRoundTrip )
+    {
+        output << std::hex << "conversions hash to " << HashBits( cartesian ) << " and " << HashBits( roundTrip ) << std::dec << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************************/
+/*!
+ *  @brief          Runs a test and prints its outcome
+ *
+ */
+/************************************************************************************/
+static bool RunTest(const std::string &name,
+                    bool (*test)(std::ostream &),
+                    std::ostream & output)
+{
+    bool passed = false;
+
+    try
+    {
+        passed = test( output );
+    }
+    catch( std::exception &e )
+    {
+        output << "exception occured : " << e.what() << std::endl;
+    }
+
+    output << ( passed == true ? "[ OK ]   " : "[ FAIL ] " ) << name << std::endl;
+
+    return passed;
+}
+
+int main(int argc, char *argv[])
+{
+    std::ostream & output = std::cout;
+
+    /// the errors are reported by the tests themselves
+    sofa::Exception::LogToCerr( false );
+
+    bool passed = true;
+
+    passed = RunTest( "float sampling rate", TestFloatSamplingRate, output ) && passed;
+    passed = RunTest( "dataset cache rewrite", TestDatasetCacheRewrite, output ) && passed;
+    passed = RunTest( "HRTF database", TestHRTFDatabase, output ) && passed;
+    passed = RunTest( "Point3 conversions", TestPoint3Conversions, output ) && passed;
+
+    sofa::String::PrintSeparationLine( output );
+
+    return ( passed == true ) ? 0 : 1;
+}